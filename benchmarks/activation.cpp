@@ -0,0 +1,146 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* Copyright © 2025      GSI Helmholtzzentrum fuer Schwerionenforschung GmbH
+ *                       Matthias Kretz <m.kretz@gsi.de>
+ */
+
+#include "bench.h"
+#include "../simd_math.h"
+#include <cmath>
+
+MAKE_VECTORMATH_OVERLOAD(tanh)
+
+namespace my
+{
+  template <typename T>
+    T
+    load(const value_type_t<T>* mem)
+    {
+      if constexpr (requires { std::simd_unchecked_load<T>(mem, T::size()); })
+        return std::simd_unchecked_load<T>(mem, T::size());
+      else
+        {
+          T r;
+          std::memcpy(&r, mem, sizeof(T));
+          return r;
+        }
+    }
+
+  template <typename T>
+    void
+    store(const T& x, value_type_t<T>* mem)
+    {
+      if constexpr (requires { std::simd_unchecked_store(x, mem, T::size()); })
+        std::simd_unchecked_store(x, mem, T::size());
+      else
+        std::memcpy(mem, &x, sizeof(T));
+    }
+
+  // the simd extensions, or the scalar definition applied per element
+  template <typename T, typename F, typename G>
+    [[gnu::always_inline]] inline T
+    activation(const T& x, F&& simd_fun, G&& scalar_fun)
+    {
+      if constexpr (requires { simd_fun(x); })
+        return simd_fun(x);
+      else if constexpr (std::is_arithmetic_v<T>)
+        return scalar_fun(x);
+      else
+        {
+          T r;
+          for (int i = 0; i < size_v<T>; ++i)
+            r[i] = scalar_fun(x[i]);
+          return r;
+        }
+    }
+
+  template <typename T>
+    T
+    sigmoid(const T& x)
+    {
+      return activation(x, [](const auto& v) -> decltype(std::simd_sigmoid(v)) {
+                          return std::simd_sigmoid(v);
+                        }, []<typename U>(U v) { return U(1) / (U(1) + std::exp(-v)); });
+    }
+
+  template <typename T>
+    T
+    sigmoid_fast(const T& x)
+    {
+      return activation(x, [](const auto& v) -> decltype(std::simd_sigmoid_fast(v)) {
+                          return std::simd_sigmoid_fast(v);
+                        }, []<typename U>(U v) { return U(1) / (U(1) + std::exp(-v)); });
+    }
+
+  template <typename T>
+    T
+    gelu(const T& x)
+    {
+      return activation(x, [](const auto& v) -> decltype(std::simd_gelu(v)) {
+                          return std::simd_gelu(v);
+                        }, []<typename U>(U v) {
+                          return U(.5) * v * std::erfc(v * U(-0.7071067811865476));
+                        });
+    }
+
+  template <typename T>
+    T
+    gelu_fast(const T& x)
+    {
+      return activation(x, [](const auto& v) -> decltype(std::simd_gelu_fast(v)) {
+                          return std::simd_gelu_fast(v);
+                        }, []<typename U>(U v) {
+                          return v / (U(1) + std::exp(v * (U(-1.5957691216057308)
+                                                             - U(0.0713548162726009) * v * v)));
+                        });
+    }
+
+  using ::tanh;
+  using std::tanh;
+}
+
+/* An activation layer of a neural network inference pass: apply the nonlinearity to a buffer of
+ * pre-activations, which is throughput-bound. tanh is included as the classic alternative.
+ */
+template <>
+  struct Benchmark<>
+  {
+    static constexpr Info<5> info = {"sigmoid", "sigmoid_fast", "gelu", "gelu_fast", "tanh"};
+
+    template <typename T>
+      static constexpr bool accept = true;
+
+    static constexpr int N = 4096;
+
+    template <class T>
+      [[gnu::flatten]]
+      static Times<5>
+      run()
+      {
+        using TT = value_type_t<T>;
+        alignas(64) static TT in[N];
+        alignas(64) static TT out[N];
+        for (int i = 0; i < N; ++i)
+          in[i] = TT(i % 211 - 105) * TT(0.05);
+
+        auto time_fun = [&](auto&& fun) {
+          return time_mean<200>([&] {
+                   for (int i = 0; i < N; i += size_v<T>)
+                     my::store(fun(my::load<T>(in + i)), out + i);
+                   asm volatile("" ::: "memory");
+                 }) / (N / size_v<T>);
+        };
+
+        return { time_fun([](const T& x) { return my::sigmoid(x); }),
+                 time_fun([](const T& x) { return my::sigmoid_fast(x); }),
+                 time_fun([](const T& x) { return my::gelu(x); }),
+                 time_fun([](const T& x) { return my::gelu_fast(x); }),
+                 time_fun([](const T& x) { return my::tanh(x); }) };
+      }
+  };
+
+int
+main()
+{
+  bench_all<float>();
+  bench_all<double>();
+}
@@ -0,0 +1,98 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* Copyright © 2025      GSI Helmholtzzentrum fuer Schwerionenforschung GmbH
+ *                       Matthias Kretz <m.kretz@gsi.de>
+ */
+
+#include "bench.h"
+
+// y is 1 for all operations, which keeps the values in range (and normal for floating-point)
+#define BINARY_OP(type, op, integral_only)                                                         \
+struct type                                                                                        \
+{                                                                                                  \
+  static constexpr char name[] = "x " #op " y";                                                    \
+                                                                                                   \
+  template <typename T>                                                                            \
+    static constexpr bool accept = not integral_only or std::integral<T>;                         \
+                                                                                                   \
+  template <class T>                                                                               \
+    [[gnu::always_inline]] static T                                                                \
+    apply(const T& x, const T& y)                                                                  \
+    { return x op y; }                                                                             \
+}
+
+BINARY_OP(Plus, +, false);
+BINARY_OP(Minus, -, false);
+BINARY_OP(Multiplies, *, false);
+BINARY_OP(BitAnd, &, true);
+BINARY_OP(BitOr, |, true);
+BINARY_OP(BitXor, ^, true);
+
+struct Fma
+{
+  static constexpr char name[] = "x * y + y";
+
+  template <typename T>
+    static constexpr bool accept = true;
+
+  template <class T>
+    [[gnu::always_inline]] static T
+    apply(const T& x, const T& y)
+    { return x * y + y; }
+};
+
+template <typename Op>
+  struct Benchmark<Op>
+  {
+    static constexpr Info<2> info = {"Latency", "Throughput"};
+
+    template <typename T>
+      static constexpr bool accept = Op::template accept<value_type_t<T>>;
+
+    static constexpr int Repeat = 4;
+
+    template <class T>
+      [[gnu::flatten]]
+      static Times<2>
+      run()
+      {
+        using TT = value_type_t<T>;
+        T y = T() + TT(1);
+        fake_modify(y);
+
+        auto process_one = [&](T& inout) {
+          repeat_chain<Repeat>(inout, [&](const T& x) -> T { return Op::apply(x, y); });
+        };
+
+        auto fake_one = [&](T& inout) {
+          repeat_chain<Repeat>(inout);
+        };
+
+        T a[8] = {};
+        return { time_latency(a, process_one, fake_one) / Repeat,
+                 time_throughput(a, process_one, fake_one) / Repeat };
+      }
+  };
+
+template <typename T>
+  void
+  bench_arithmetic()
+  {
+    bench_all<T, Plus>();
+    bench_all<T, Minus>();
+    bench_all<T, Multiplies>();
+    bench_all<T, Fma>();
+    bench_all<T, BitAnd>();
+    bench_all<T, BitOr>();
+    bench_all<T, BitXor>();
+  }
+
+int
+main()
+{
+  bench_arithmetic<signed char>();
+  bench_arithmetic<signed short>();
+  bench_arithmetic<signed int>();
+  bench_arithmetic<signed long>();
+  bench_arithmetic<float>();
+  bench_arithmetic<double>();
+}
@@ -11,10 +11,14 @@
 #include "../mask_reductions.h"
 
 #include <array>
+#include <cerrno>
+#include <cstdlib>
 #include <iostream>
 #include <iomanip>
 #include <string>
+#include <string_view>
 #include <cstring>
+#include <utility>
 
 template <class T>
   auto
@@ -91,9 +95,112 @@ template <class...>
 
 struct NoRef {};
 
+// BENCH_FORMAT=csv or BENCH_FORMAT=json (one object per line) replaces the coloured table on
+// stdout with one record per measured value. BENCH_NAME and BENCH_ARCH fill in the benchmark
+// and arch fields; run.sh sets both.
+enum class OutputFormat { Table, Csv, Json };
+
+inline OutputFormat
+output_format()
+{
+  static const OutputFormat fmt = [] {
+    const char* env = std::getenv("BENCH_FORMAT");
+    const std::string_view str = env ? env : "";
+    if (str == "csv")
+      return OutputFormat::Csv;
+    else if (str == "json")
+      return OutputFormat::Json;
+    else if (not str.empty() and str != "table")
+      std::cerr << "unknown BENCH_FORMAT '" << str << "', using the table format\n";
+    return OutputFormat::Table;
+  }();
+  return fmt;
+}
+
+inline const char*
+env_or(const char* name, const char* fallback)
+{
+  const char* env = std::getenv(name);
+  return env && *env ? env : fallback;
+}
+
+// Identifies a row of results in the machine-readable formats.
+struct RecordId
+{
+  std::string type;
+  std::string abi;
+  std::string flags;
+};
+
+inline void
+print_json_string(std::string_view str)
+{
+  std::cout << '"';
+  for (char c : str)
+    {
+      if (c == '"' or c == '\\')
+        std::cout << '\\';
+      std::cout << c;
+    }
+  std::cout << '"';
+}
+
+inline void
+print_csv_string(std::string_view str)
+{
+  if (str.find_first_of(",\"") == str.npos)
+    std::cout << str;
+  else
+    {
+      std::cout << '"';
+      for (char c : str)
+        {
+          if (c == '"')
+            std::cout << '"';
+          std::cout << c;
+        }
+      std::cout << '"';
+    }
+}
+
+inline void
+print_record(const RecordId& rec, const char* metric, double value, double speedup)
+{
+  const char* benchmark = env_or("BENCH_NAME", program_invocation_short_name);
+  const char* arch = env_or("BENCH_ARCH", "unknown");
+  if (output_format() == OutputFormat::Csv)
+    {
+      static bool header_done = false;
+      if (not std::exchange(header_done, true))
+        std::cout << "benchmark,arch,type,abi,flags,metric,cycles,speedup\n";
+      for (std::string_view field : {benchmark, arch, rec.type.c_str(), rec.abi.c_str(),
+                                     rec.flags.c_str(), metric})
+        {
+          print_csv_string(field);
+          std::cout << ',';
+        }
+      std::cout << std::setprecision(6) << value << ',' << speedup << '\n';
+    }
+  else
+    {
+      std::cout << '{';
+      const std::pair<const char*, std::string_view> fields[]
+        = {{"benchmark", benchmark}, {"arch", arch}, {"type", rec.type}, {"abi", rec.abi},
+           {"flags", rec.flags}, {"metric", metric}};
+      for (auto [key, field] : fields)
+        {
+          std::cout << '"' << key << "\":";
+          print_json_string(field);
+          std::cout << ',';
+        }
+      std::cout << std::setprecision(6) << "\"cycles\":" << value << ",\"speedup\":" << speedup
+                << "}\n";
+    }
+}
+
 template <class T, class... ExtraFlags, class Ref = NoRef>
   auto
-  bench_lat_thr(const char* id, const Ref& ref = {})
+  bench_lat_thr(const char* id, const RecordId& rec, const Ref& ref = {})
   {
     using B = Benchmark<ExtraFlags...>;
     if constexpr (not B::template accept<T> or not std::default_initializable<T>)
@@ -107,13 +214,20 @@ template <class T, class... ExtraFlags, class Ref = NoRef>
         static constexpr char normal[] = "\033[0m";
 
         const Times<N> results = B::template run<T>();
-        std::cout << id;
+        const bool table = output_format() == OutputFormat::Table;
+        if (table)
+          std::cout << id;
         for (int i = 0; i < N; ++i)
           {
             double speedup = 1;
             if constexpr (!std::is_same_v<Ref, NoRef>)
               speedup = ref[i] * size_v<T> / results[i];
 
+            if (not table)
+              {
+                print_record(rec, B::info[i], results[i], speedup);
+                continue;
+              }
             std::cout << std::setprecision(3) << std::setw(15) << results[i];
             if (speedup >= speedup_size_v<T> * 0.90 && speedup >= 1.5)
               std::cout << green;
@@ -123,7 +237,10 @@ template <class T, class... ExtraFlags, class Ref = NoRef>
               std::cout << red;
             std::cout << std::setw(12) << speedup << normal;
           }
-        std::cout << std::endl;
+        if (table)
+          std::cout << std::endl;
+        else
+          std::cout.flush();
         if constexpr (std::same_as<Ref, NoRef>)
           return results;
         else
@@ -164,7 +281,8 @@ template <class T, class... ExtraFlags>
     std::memset(id, ' ', id_size - 1);
     id[id_size - 1] = '\0';
     std::strncpy(id + id_size/2 - 2, "TYPE", 4);
-    print_header<Benchmark<ExtraFlags...>>(id);
+    if (output_format() == OutputFormat::Table)
+      print_header<Benchmark<ExtraFlags...>>(id);
     std::strncpy(id + id_size/2 - 2, "    ", 4);
     char* const typestr = id;
     char* const abistr  = id + value_type_field + 2;
@@ -225,6 +343,15 @@ template <class T, class... ExtraFlags>
       extraflags += sizeof(ExtraFlags::name) + 1;
     }(), ...);
 
+    RecordId rec;
+    rec.type = std::string_view(typestr, value_type_field);
+    rec.type.erase(0, rec.type.find_first_not_of(' '));
+    ([&] {
+      if (not rec.flags.empty())
+        rec.flags += ' ';
+      rec.flags += ExtraFlags::name;
+    }(), ...);
+
     auto set_abistr = [&](const char* str) {
       std::size_t len = std::strlen(str);
       if (len > abi_field)
@@ -236,27 +363,28 @@ template <class T, class... ExtraFlags>
       std::memcpy(abistr, str, ncpy);
       if (len < abi_field)
         std::memset(abistr + ncpy, ' ', abi_field - ncpy);
+      rec.abi = len == 0 ? "scalar" : str;
     };
 
     set_abistr("");
-    auto ref0 = bench_lat_thr<T, ExtraFlags...>(id);
+    auto ref0 = bench_lat_thr<T, ExtraFlags...>(id, rec);
     using V16 [[gnu::vector_size(16)]] = T;
     set_abistr("[[gnu::vector_size(16)]]");
-    auto ref_vec = bench_lat_thr<V16, ExtraFlags...>(id, ref0);
+    auto ref_vec = bench_lat_thr<V16, ExtraFlags...>(id, rec, ref0);
     set_abistr("1");
-    auto ref1 = bench_lat_thr<std::simd<T, 1>, ExtraFlags...>(id, ref_vec);
+    auto ref1 = bench_lat_thr<std::simd<T, 1>, ExtraFlags...>(id, rec, ref_vec);
     set_abistr("2");
-    auto ref2 = bench_lat_thr<std::simd<T, 2>, ExtraFlags...>(id, ref1);
+    auto ref2 = bench_lat_thr<std::simd<T, 2>, ExtraFlags...>(id, rec, ref1);
     set_abistr("4");
-    const auto ref = bench_lat_thr<std::simd<T, 4>, ExtraFlags...>(id, ref2);
+    const auto ref = bench_lat_thr<std::simd<T, 4>, ExtraFlags...>(id, rec, ref2);
     set_abistr("8");
-    bench_lat_thr<std::simd<T, 8>, ExtraFlags...>(id, ref);
+    bench_lat_thr<std::simd<T, 8>, ExtraFlags...>(id, rec, ref);
     set_abistr("16");
-    bench_lat_thr<std::simd<T, 16>, ExtraFlags...>(id, ref);
+    bench_lat_thr<std::simd<T, 16>, ExtraFlags...>(id, rec, ref);
     set_abistr("32");
-    bench_lat_thr<std::simd<T, 32>, ExtraFlags...>(id, ref);
+    bench_lat_thr<std::simd<T, 32>, ExtraFlags...>(id, rec, ref);
     set_abistr("64");
-    bench_lat_thr<std::simd<T, 64>, ExtraFlags...>(id, ref);
+    bench_lat_thr<std::simd<T, 64>, ExtraFlags...>(id, rec, ref);
     //set_abistr("fixed_size<12>");
     //bench_lat_thr<std::simd<T, fixed_size<12>>, ExtraFlags...>(id, ref);
     //set_abistr("fixed_size<16>");
@@ -266,19 +394,20 @@ template <class T, class... ExtraFlags>
     if constexpr (alignof(V32) == sizeof(V32))
       {
         set_abistr("[[gnu::vector_size(32)]]");
-        bench_lat_thr<V32, ExtraFlags...>(id, ref);
+        bench_lat_thr<V32, ExtraFlags...>(id, rec, ref);
       }
     using V64 [[gnu::vector_size(64)]] = T;
     if constexpr (alignof(V64) == sizeof(V64))
       {
         set_abistr("[[gnu::vector_size(64)]]");
-        bench_lat_thr<V64, ExtraFlags...>(id, ref);
+        bench_lat_thr<V64, ExtraFlags...>(id, rec, ref);
       }
 
     char sep[id_size + 2 * 15 + 2 * 12];
     std::memset(sep, '-', sizeof(sep) - 1);
     sep[sizeof(sep) - 1] = '\0';
-    std::cout << sep << std::endl;
+    if (output_format() == OutputFormat::Table)
+      std::cout << sep << std::endl;
   }
 
 template <long Iterations, int Retries = 10, class F>
@@ -392,6 +521,30 @@ template <typename... Ts>
   fake_read(const Ts&... more)
   { (fake_read_one(more), ...); }
 
+// Applies fun Repeat times in a dependency chain. time_latency rejects results below one cycle,
+// so operations that can be that fast are timed in chains and the result divided by Repeat.
+template <int Repeat, typename T, typename F>
+  [[gnu::always_inline]] inline void
+  repeat_chain(T& inout, F&& fun)
+  {
+    for (int i = 0; i < Repeat; ++i)
+      {
+        inout = fun(inout);
+        fake_modify(inout);
+      }
+  }
+
+// The matching fake_one for repeat_chain. It must not copy inout: copies of types that are
+// stored as arrays of vectors can incur store-forwarding stalls, which are more expensive than
+// the operations under test.
+template <int Repeat, typename T>
+  [[gnu::always_inline]] inline void
+  repeat_chain(T& inout)
+  {
+    for (int i = 0; i < Repeat; ++i)
+      fake_modify(inout);
+  }
+
 template <typename T, std::size_t N>
   using carray = T[N];
 
@@ -442,12 +595,11 @@ template <typename T>
   }
 
 #define MAKE_VECTORMATH_OVERLOAD(name)                                         \
-template <class T, class... More,                                              \
-	  class VT = std::experimental::_VectorTraits<T>>                      \
+template <vec_builtin T, class... More>                                        \
   T name(T a, More... more)                                                    \
   {                                                                            \
     T r;                                                                       \
-    for (int i = 0; i < VT::_S_full_size; ++i)                                 \
+    for (int i = 0; i < size_v<T>; ++i)                                        \
       r[i] = std::name(a[i], subscript_or_value(more, i)...);                  \
     return r;                                                                  \
   }
@@ -0,0 +1,87 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* Copyright © 2025      GSI Helmholtzzentrum fuer Schwerionenforschung GmbH
+ *                       Matthias Kretz <m.kretz@gsi.de>
+ */
+
+#include "bench.h"
+#include "../simd_chunk.h"
+
+// Both operations are measured as round trips that return the input type, so that they can
+// form a dependency chain.
+struct ChunkCat
+{
+  static constexpr char name[] = "simd_cat(simd_chunk<N/2>(x))";
+
+  template <class T>
+    [[gnu::always_inline]] static T
+    apply(const T& x)
+    {
+      using H = std::resize_simd_t<T::size() / 2, T>;
+      auto [lo, hi] = std::simd_chunk<H>(x);
+      fake_modify(lo, hi);
+      return std::simd_cat(lo, hi);
+    }
+};
+
+struct CatChunk
+{
+  static constexpr char name[] = "simd_chunk<N>(simd_cat(x, x))[0]";
+
+  template <class T>
+    [[gnu::always_inline]] static T
+    apply(const T& x)
+    {
+      auto c = std::simd_cat(x, x);
+      fake_modify(c);
+      return std::simd_chunk<T>(c)[0];
+    }
+};
+
+template <typename Op>
+  struct Benchmark<Op>
+  {
+    static constexpr Info<2> info = {"Latency", "Throughput"};
+
+    template <typename T>
+      static constexpr bool accept = not vec_builtin<T> and size_v<T> >= 2 and size_v<T> % 2 == 0;
+
+    template <class T>
+      [[gnu::flatten]]
+      static Times<2>
+      run()
+      {
+        using TT = value_type_t<T>;
+
+        auto process_one = [&](T& inout) {
+          inout = Op::apply(inout);
+        };
+
+        auto fake_one = [&](T& inout) {
+          fake_modify(inout);
+        };
+
+        T a[8] = {};
+        for (T& x : a)
+          x = T() + TT(1);
+        return { time_latency(a, process_one, fake_one),
+                 time_throughput(a, process_one, fake_one) };
+      }
+  };
+
+template <typename T>
+  void
+  bench_cat_chunk()
+  {
+    bench_all<T, ChunkCat>();
+    bench_all<T, CatChunk>();
+  }
+
+int
+main()
+{
+  bench_cat_chunk<signed char>();
+  bench_cat_chunk<signed short>();
+  bench_cat_chunk<signed int>();
+  bench_cat_chunk<float>();
+  bench_cat_chunk<double>();
+}
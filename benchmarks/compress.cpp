@@ -0,0 +1,103 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* Copyright © 2025      GSI Helmholtzzentrum fuer Schwerionenforschung GmbH
+ *                       Matthias Kretz <m.kretz@gsi.de>
+ */
+
+#include "bench.h"
+#include "../permute.h"
+
+namespace my
+{
+  template <typename T>
+    T
+    load(const value_type_t<T>* mem)
+    {
+      if constexpr (requires { std::simd_unchecked_load<T>(mem, T::size()); })
+        return std::simd_unchecked_load<T>(mem, T::size());
+      else
+        {
+          T r;
+          std::memcpy(&r, mem, sizeof(T));
+          return r;
+        }
+    }
+
+  // the scalar reference: a branchy loop
+  template <typename T>
+    requires(std::integral<T> or std::floating_point<T>)
+    int
+    compress_store(T x, bool k, T* out)
+    {
+      if (k)
+        {
+          *out = x;
+          return 1;
+        }
+      return 0;
+    }
+
+  template <vec_builtin V, vec_builtin K, typename T>
+    int
+    compress_store(const V v, const K k, T* out)
+    {
+      int n = 0;
+      for (int i = 0; i < size_v<V>; ++i)
+        if (k[i])
+          out[n++] = v[i];
+      return n;
+    }
+
+  using std::compress_store;
+}
+
+template <>
+  struct Benchmark<>
+  {
+    static constexpr Info<1> info = {"Throughput"};
+
+    template <typename T>
+      static constexpr bool accept = true;
+
+    static constexpr int N = 4096;
+
+    template <class T>
+      [[gnu::flatten]]
+      static Times<1>
+      run()
+      {
+        using TT = value_type_t<T>;
+        // pseudo-random input, about half of the values are selected; the selection pattern is
+        // unpredictable for the branch predictor
+        alignas(64) static TT in[N];
+        alignas(64) static TT out[N + size_v<T>];
+        unsigned state = 1;
+        for (TT& x : in)
+          {
+            state = state * 1103515245u + 12345u;
+            x = TT((state >> 16) & 0x3f);
+          }
+        T threshold = T() + TT(0x20);
+        fake_modify(threshold);
+
+        return { time_mean<200>([&] {
+                   int n = 0;
+                   for (int i = 0; i < N; i += size_v<T>)
+                     {
+                       T x = my::load<T>(in + i);
+                       n += my::compress_store(x, x >= threshold, out + n);
+                     }
+                   fake_read(n);
+                 }) / (N / size_v<T>) };
+      }
+  };
+
+int
+main()
+{
+  bench_all<signed char>();
+  bench_all<signed short>();
+  bench_all<signed int>();
+  bench_all<signed long>();
+  bench_all<float>();
+  bench_all<double>();
+}
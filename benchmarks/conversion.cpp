@@ -0,0 +1,119 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* Copyright © 2025      GSI Helmholtzzentrum fuer Schwerionenforschung GmbH
+ *                       Matthias Kretz <m.kretz@gsi.de>
+ */
+
+#include "bench.h"
+
+template <typename U, int N>
+  struct vec_of
+  { using type [[gnu::vector_size(sizeof(U) * N)]] = U; };
+
+// Converts x to the same number of U elements.
+template <typename U, typename T>
+  [[gnu::always_inline]] inline auto
+  convert_to(const T& x)
+  {
+    if constexpr (vec_builtin<T>)
+      return __builtin_convertvector(x, typename vec_of<U, size_v<T>>::type);
+    else if constexpr (std::is_arithmetic_v<T>)
+      return static_cast<U>(x);
+    else
+      return std::rebind_simd_t<U, T>(x);
+  }
+
+// Measures the round trip T -> U -> T, which is the only way to keep a dependency chain
+// through a conversion.
+#define CONVERSION(U)                                                                              \
+struct To_##U                                                                                      \
+{                                                                                                  \
+  static constexpr char name[] = "-> " #U " -> T";                                                 \
+                                                                                                   \
+  using type = U;                                                                                  \
+                                                                                                   \
+  template <class T>                                                                               \
+    [[gnu::always_inline]] static T                                                                \
+    apply(const T& x)                                                                              \
+    {                                                                                              \
+      auto u = convert_to<U>(x);                                                                   \
+      fake_modify(u);                                                                              \
+      return convert_to<value_type_t<T>>(u);                                                       \
+    }                                                                                              \
+}
+
+using schar = signed char;
+
+CONVERSION(schar);
+CONVERSION(short);
+CONVERSION(int);
+CONVERSION(long);
+CONVERSION(float);
+CONVERSION(double);
+
+template <typename Op>
+  struct Benchmark<Op>
+  {
+    static constexpr Info<2> info = {"Latency", "Throughput"};
+
+    using U = typename Op::type;
+
+    // the vector builtin needs a matching vector type for U that fits into a register
+    template <typename T>
+      static constexpr bool accept = []{
+        if constexpr (vec_builtin<T>)
+          {
+            using UV = typename vec_of<U, size_v<T>>::type;
+            return sizeof(UV) >= 8 and alignof(UV) == sizeof(UV);
+          }
+        else
+          return true;
+      }();
+
+    template <class T>
+      [[gnu::flatten]]
+      static Times<2>
+      run()
+      {
+        using TT = value_type_t<T>;
+
+        auto process_one = [&](T& inout) {
+          inout = Op::apply(inout);
+        };
+
+        auto fake_one = [&](T& inout) {
+          fake_modify(inout);
+        };
+
+        T a[8] = {};
+        for (T& x : a)
+          x = T() + TT(1);
+        return { time_latency(a, process_one, fake_one),
+                 time_throughput(a, process_one, fake_one) };
+      }
+  };
+
+int
+main()
+{
+  bench_all<float, To_double>();
+  bench_all<float, To_int>();
+  bench_all<float, To_short>();
+  bench_all<float, To_schar>();
+
+  bench_all<double, To_float>();
+  bench_all<double, To_int>();
+  bench_all<double, To_long>();
+
+  bench_all<int, To_float>();
+  bench_all<int, To_double>();
+  bench_all<int, To_long>();
+  bench_all<int, To_short>();
+  bench_all<int, To_schar>();
+
+  bench_all<short, To_int>();
+  bench_all<short, To_float>();
+
+  bench_all<schar, To_short>();
+  bench_all<schar, To_int>();
+  bench_all<schar, To_float>();
+}
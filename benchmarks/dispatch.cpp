@@ -0,0 +1,97 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* Copyright © 2025      GSI Helmholtzzentrum fuer Schwerionenforschung GmbH
+ *                       Matthias Kretz <m.kretz@gsi.de>
+ */
+
+#include "bench.h"
+#include "../simd_algorithm.h"
+#include "../simd_dispatch.h"
+
+#include <numeric>
+#include <span>
+
+// Compares a direct call of a (non-inlined) kernel against the same call through
+// std::simd_dispatch. The difference is the cost of the dispatch (the check of the static guard
+// and the indirect call); it is constant per call and thus amortized by the work of the kernel.
+//
+// run.sh compiles for a single -march, therefore the kernel for the ISA level of this TU also
+// stands in for the higher levels.
+
+template <typename T>
+  [[gnu::noinline]] value_type_t<T>
+  kernel(std::span<const value_type_t<T>> in)
+  {
+    using TT = value_type_t<T>;
+    if constexpr (std::is_same_v<T, TT>)
+      return std::accumulate(in.begin(), in.end(), TT());
+    else
+      return std::simd_reduce<T>(in);
+  }
+
+template <typename T>
+  [[gnu::noinline]] value_type_t<T>
+  generic_kernel(std::span<const value_type_t<T>> in)
+  { return std::accumulate(in.begin(), in.end(), value_type_t<T>()); }
+
+template <>
+  struct Benchmark<>
+  {
+    static constexpr Info<4> info = {"Direct 64", "Dispatch 64", "Direct 4096", "Dispatch 4096"};
+
+    // the range reductions need a basic_simd type for the chunks
+    template <typename T>
+      static constexpr bool accept = not vec_builtin<T>;
+
+    static constexpr int N = 4096;
+
+    template <class T>
+      [[gnu::flatten]]
+      static Times<4>
+      run()
+      {
+        using TT = value_type_t<T>;
+        alignas(64) static TT in[N];
+        for (int i = 0; i < N; ++i)
+          in[i] = TT(i & 3);
+
+        constexpr auto fn = &kernel<T>;
+        constexpr auto generic = &generic_kernel<T>;
+
+        auto direct = [&](int n) {
+          asm volatile("" ::: "memory");
+          TT r = fn(std::span<const TT>(in, n));
+          fake_read(r);
+        };
+
+        auto dispatched = [&](int n) {
+          asm volatile("" ::: "memory");
+          TT r;
+          if constexpr (std::simd_compiled_isa == std::simd_isa::generic)
+            r = std::simd_dispatch<fn>(std::span<const TT>(in, n));
+          else if constexpr (std::simd_compiled_isa == std::simd_isa::x86_64_v2)
+            r = std::simd_dispatch<generic, fn, fn, fn>(std::span<const TT>(in, n));
+          else if constexpr (std::simd_compiled_isa == std::simd_isa::x86_64_v3)
+            r = std::simd_dispatch<generic, nullptr, fn, fn>(std::span<const TT>(in, n));
+          else
+            r = std::simd_dispatch<generic, nullptr, nullptr, fn>(std::span<const TT>(in, n));
+          fake_read(r);
+        };
+
+        // select the kernel before measuring
+        dispatched(1);
+
+        return { time_mean<2000>(direct, 64), time_mean<2000>(dispatched, 64),
+                 time_mean<200>(direct, N), time_mean<200>(dispatched, N) };
+      }
+  };
+
+int
+main()
+{
+  bench_all<signed char>();
+  bench_all<signed short>();
+  bench_all<signed int>();
+  bench_all<signed long>();
+  bench_all<float>();
+  bench_all<double>();
+}
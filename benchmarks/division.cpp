@@ -0,0 +1,151 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* Copyright © 2025      GSI Helmholtzzentrum fuer Schwerionenforschung GmbH
+ *                       Matthias Kretz <m.kretz@gsi.de>
+ */
+
+#include "bench.h"
+#include "../simd_divisor.h"
+
+// x / 1 and x % 7 are fixed points for the inputs used below, so the dependency chain never
+// leaves the initial value range
+struct Divides
+{
+  static constexpr char name[] = "x / y";
+
+  static constexpr int divisor = 1;
+
+  static constexpr bool invariant = false;
+
+  template <typename T>
+    static constexpr bool accept = true;
+
+  template <class T>
+    [[gnu::always_inline]] static T
+    apply(const T& x, const T& y)
+    { return x / y; }
+};
+
+struct Modulus
+{
+  static constexpr char name[] = "x % y";
+
+  static constexpr int divisor = 7;
+
+  static constexpr bool invariant = false;
+
+  template <typename T>
+    static constexpr bool accept = std::integral<T>;
+
+  template <class T>
+    [[gnu::always_inline]] static T
+    apply(const T& x, const T& y)
+    { return x % y; }
+};
+
+// The same operations with a std::simd_divisor. The divisor is unknown to the compiler, but the
+// multiplier and shifts are computed outside of the measured loop.
+struct InvariantDivides
+{
+  static constexpr char name[] = "x / simd_divisor(y)";
+
+  static constexpr int divisor = 1;
+
+  static constexpr bool invariant = true;
+
+  template <typename T>
+    static constexpr bool accept = std::integral<T>;
+
+  template <class T, class D>
+    [[gnu::always_inline]] static T
+    apply(const T& x, const D& y)
+    { return x / y; }
+};
+
+struct InvariantModulus
+{
+  static constexpr char name[] = "x % simd_divisor(y)";
+
+  static constexpr int divisor = 7;
+
+  static constexpr bool invariant = true;
+
+  template <typename T>
+    static constexpr bool accept = std::integral<T>;
+
+  template <class T, class D>
+    [[gnu::always_inline]] static T
+    apply(const T& x, const D& y)
+    { return x % y; }
+};
+
+template <typename Op>
+  struct Benchmark<Op>
+  {
+    static constexpr Info<2> info = {"Latency", "Throughput"};
+
+    // simd_divisor only works with basic_simd and vectorizable types
+    template <typename T>
+      static constexpr bool accept
+        = Op::template accept<value_type_t<T>> and not (Op::invariant and vec_builtin<T>);
+
+    template <class T>
+      [[gnu::flatten]]
+      static Times<2>
+      run()
+      {
+        using TT = value_type_t<T>;
+        const auto y = [] {
+          if constexpr (Op::invariant)
+            {
+              TT d = TT(Op::divisor);
+              fake_modify(d);
+              return std::simd_divisor<TT>(d);
+            }
+          else
+            {
+              T d = T() + TT(Op::divisor);
+              fake_modify(d);
+              return d;
+            }
+        }();
+
+        auto process_one = [&](T& inout) {
+          inout = Op::apply(inout, y);
+        };
+
+        auto fake_one = [&](T& inout) {
+          fake_modify(inout);
+        };
+
+        T a[8] = {};
+        for (T& x : a)
+          x = T() + TT(5);
+        return { time_latency(a, process_one, fake_one),
+                 time_throughput(a, process_one, fake_one) };
+      }
+  };
+
+template <typename T>
+  void
+  bench_division()
+  {
+    bench_all<T, Divides>();
+    bench_all<T, Modulus>();
+    bench_all<T, InvariantDivides>();
+    bench_all<T, InvariantModulus>();
+  }
+
+int
+main()
+{
+  bench_division<signed char>();
+  bench_division<unsigned char>();
+  bench_division<signed short>();
+  bench_division<unsigned short>();
+  bench_division<signed int>();
+  bench_division<unsigned int>();
+  bench_division<signed long>();
+  bench_division<unsigned long>();
+  bench_division<float>();
+  bench_division<double>();
+}
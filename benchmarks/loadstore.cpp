@@ -0,0 +1,117 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* Copyright © 2025      GSI Helmholtzzentrum fuer Schwerionenforschung GmbH
+ *                       Matthias Kretz <m.kretz@gsi.de>
+ */
+
+#include "bench.h"
+
+template <>
+  struct Benchmark<>
+  {
+    static constexpr Info<4> info = {"Masked load", "Masked store", "Partial load", "Partial store"};
+
+    // the masked and partial loads/stores need a basic_simd type
+    template <typename T>
+      static constexpr bool accept = not vec_builtin<T>;
+
+    static constexpr int N = 4096;
+
+    template <class T>
+      [[gnu::flatten]]
+      static Times<4>
+      run()
+      {
+        using TT = value_type_t<T>;
+        alignas(64) static TT mem[N];
+        for (int i = 0; i < N; ++i)
+          mem[i] = TT(i & 3);
+
+        constexpr bool is_scalar = std::is_same_v<T, TT>;
+
+        // every other element is selected; the scalar reference branches on a bool instead
+        auto k = [] {
+          if constexpr (is_scalar)
+            return true;
+          else
+            return T([](int i) { return TT(i & 1); }) == TT();
+        }();
+        fake_modify(k);
+
+        // all but the last element, but at least one
+        int n = std::max(1, size_v<T> - 1);
+        fake_modify(n);
+
+        T v = T() + TT(1);
+        fake_modify(v);
+
+        auto masked_load = [&] {
+          asm volatile("" ::: "memory");
+          for (int i = 0; i < N; i += size_v<T>)
+            {
+              T x;
+              if constexpr (is_scalar)
+                x = k ? mem[i] : TT();
+              else
+                x = std::simd_unchecked_load<T>(mem + i, size_v<T>, k);
+              fake_read(x);
+            }
+        };
+
+        auto masked_store = [&] {
+          for (int i = 0; i < N; i += size_v<T>)
+            {
+              if constexpr (is_scalar)
+                {
+                  if (k)
+                    mem[i] = v;
+                }
+              else
+                std::simd_unchecked_store(v, mem + i, size_v<T>, k);
+            }
+          asm volatile("" ::: "memory");
+        };
+
+        auto partial_load = [&] {
+          asm volatile("" ::: "memory");
+          for (int i = 0; i < N; i += size_v<T>)
+            {
+              T x;
+              if constexpr (is_scalar)
+                x = n > 0 ? mem[i] : TT();
+              else
+                x = std::simd_partial_load<T>(mem + i, n);
+              fake_read(x);
+            }
+        };
+
+        auto partial_store = [&] {
+          for (int i = 0; i < N; i += size_v<T>)
+            {
+              if constexpr (is_scalar)
+                {
+                  if (n > 0)
+                    mem[i] = v;
+                }
+              else
+                std::simd_partial_store(v, mem + i, n);
+            }
+          asm volatile("" ::: "memory");
+        };
+
+        return { time_mean<200>(masked_load) / (N / size_v<T>),
+                 time_mean<200>(masked_store) / (N / size_v<T>),
+                 time_mean<200>(partial_load) / (N / size_v<T>),
+                 time_mean<200>(partial_store) / (N / size_v<T>) };
+      }
+  };
+
+int
+main()
+{
+  bench_all<signed char>();
+  bench_all<signed short>();
+  bench_all<signed int>();
+  bench_all<signed long>();
+  bench_all<float>();
+  bench_all<double>();
+}
@@ -0,0 +1,90 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* Copyright © 2025      GSI Helmholtzzentrum fuer Schwerionenforschung GmbH
+ *                       Matthias Kretz <m.kretz@gsi.de>
+ */
+
+#include "bench.h"
+
+// Each operation is measured together with the comparison producing its mask, since that is
+// how mask reductions are used (and the scalar reference needs the same work).
+#define MASK_REDUCTION(type, fun)                                                                  \
+struct type                                                                                        \
+{                                                                                                  \
+  static constexpr char name[] = #fun "(x >= y)";                                                  \
+                                                                                                   \
+  template <class T>                                                                               \
+    [[gnu::always_inline]] static auto                                                             \
+    apply(const T& x, const T& y)                                                                  \
+    { return std::fun(x >= y); }                                                                   \
+}
+
+MASK_REDUCTION(AllOf, all_of);
+MASK_REDUCTION(AnyOf, any_of);
+MASK_REDUCTION(NoneOf, none_of);
+MASK_REDUCTION(ReduceCount, reduce_count);
+MASK_REDUCTION(ReduceMinIndex, reduce_min_index);
+MASK_REDUCTION(ReduceMaxIndex, reduce_max_index);
+
+template <typename Op>
+  struct Benchmark<Op>
+  {
+    static constexpr Info<2> info = {"Latency", "Throughput"};
+
+    // there are no mask reductions for the results of vector builtin comparisons
+    template <typename T>
+      static constexpr bool accept = not vec_builtin<T>;
+
+    template <class T>
+      [[gnu::flatten]]
+      static Times<2>
+      run()
+      {
+        using TT = value_type_t<T>;
+        // y <= x for all elements, so that reduce_min_index and reduce_max_index have a set
+        // element; zero feeds the result back into the chain without changing x
+        T y = T();
+        T zero = T();
+        fake_modify(y, zero);
+
+        auto process_one = [&](T& inout) {
+          const auto r = Op::apply(inout, y);
+          inout = T(inout + TT(r) * zero);
+        };
+
+        // same feedback as above, with the mask reduction replaced by an opaque value
+        auto fake_one = [&](T& inout) {
+          decltype(Op::apply(inout, y)) r = {};
+          fake_modify(r);
+          inout = T(inout + TT(r) * zero);
+        };
+
+        T a[8] = {};
+        for (T& x : a)
+          x = T() + TT(1);
+        return { time_latency(a, process_one, fake_one),
+                 time_throughput(a, process_one, fake_one) };
+      }
+  };
+
+template <typename T>
+  void
+  bench_mask_reductions()
+  {
+    bench_all<T, AllOf>();
+    bench_all<T, AnyOf>();
+    bench_all<T, NoneOf>();
+    bench_all<T, ReduceCount>();
+    bench_all<T, ReduceMinIndex>();
+    bench_all<T, ReduceMaxIndex>();
+  }
+
+int
+main()
+{
+  bench_mask_reductions<signed char>();
+  bench_mask_reductions<signed short>();
+  bench_mask_reductions<signed int>();
+  bench_mask_reductions<signed long>();
+  bench_mask_reductions<float>();
+  bench_mask_reductions<double>();
+}
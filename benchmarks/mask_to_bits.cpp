@@ -0,0 +1,79 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* Copyright © 2025      GSI Helmholtzzentrum fuer Schwerionenforschung GmbH
+ *                       Matthias Kretz <m.kretz@gsi.de>
+ */
+
+#include "bench.h"
+
+template <>
+  struct Benchmark<>
+  {
+    static constexpr Info<2> info = {"simd_mask_to_bits", "Per-lane"};
+
+    // vector builtins have no mask type
+    template <typename T>
+      static constexpr bool accept = not vec_builtin<T>;
+
+    static constexpr int N = 1024;
+
+    template <class T>
+      [[gnu::flatten]]
+      static Times<2>
+      run()
+      {
+        using TT = value_type_t<T>;
+        constexpr int Size = size_v<T>;
+        using M = decltype(T() == T());
+        alignas(64) static M masks[N];
+        alignas(64) static std::uint64_t bits[(N * Size + 63) / 64];
+        for (int i = 0; i < N; ++i)
+          masks[i] = T([&](int j) { return TT((i + j) % 3); }) == T();
+
+        // the scalar reference and the "Per-lane" column extract one element at a time
+        auto per_lane = [&] {
+          asm volatile("" ::: "memory");
+          std::uint64_t word = 0;
+          int fill = 0;
+          std::uint64_t* out = bits;
+          for (const M& k : masks)
+            for (int j = 0; j < Size; ++j)
+              {
+                if constexpr (std::is_same_v<T, TT>)
+                  word |= std::uint64_t(k) << fill;
+                else
+                  word |= std::uint64_t(k[j]) << fill;
+                if (++fill == 64)
+                  {
+                    *out++ = word;
+                    word = 0;
+                    fill = 0;
+                  }
+              }
+          if (fill > 0)
+            *out = word;
+          asm volatile("" ::: "memory");
+        };
+
+        auto bulk = [&] {
+          asm volatile("" ::: "memory");
+          if constexpr (std::is_same_v<T, TT>)
+            per_lane();
+          else
+            std::simd_mask_to_bits(masks, bits);
+          asm volatile("" ::: "memory");
+        };
+
+        return { time_mean<200>(bulk) / N, time_mean<200>(per_lane) / N };
+      }
+  };
+
+int
+main()
+{
+  bench_all<signed char>();
+  bench_all<signed short>();
+  bench_all<signed int>();
+  bench_all<signed long>();
+  bench_all<float>();
+  bench_all<double>();
+}
@@ -0,0 +1,250 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* Copyright © 2025      GSI Helmholtzzentrum fuer Schwerionenforschung GmbH
+ *                       Matthias Kretz <m.kretz@gsi.de>
+ */
+
+#include "bench.h"
+#include "../simd_math.h"
+#include <cmath>
+
+FUN1(exp);
+FUN1(exp2);
+FUN1(expm1);
+FUN1(log);
+FUN1(log2);
+FUN1(log10);
+FUN1(log1p);
+FUN1(sin);
+FUN1(cos);
+FUN1(tan);
+FUN1(asin);
+FUN1(acos);
+FUN1(atan);
+FUN1(sinh);
+FUN1(cosh);
+FUN1(tanh);
+FUN1(sqrt);
+FUN1(cbrt);
+FUN1(erf);
+FUN1(erfc);
+FUN1(lgamma);
+FUN1(tgamma);
+FUN1(logb);
+FUN2(pow);
+FUN2(hypot);
+FUN2(atan2);
+FUN1(floor);
+FUN1(ceil);
+FUN1(round);
+FUN1(trunc);
+
+MAKE_VECTORMATH_OVERLOAD(ilogb)
+MAKE_VECTORMATH_OVERLOAD(ldexp)
+MAKE_VECTORMATH_OVERLOAD(scalbln)
+
+// the type of exponent arguments: Int for scalars and vector builtins, simd<Int> otherwise
+template <typename Int, typename T>
+  struct exponent_type
+  { using type = Int; };
+
+template <typename Int, typename T>
+  requires (not std::is_arithmetic_v<T> and not vec_builtin<T>)
+  struct exponent_type<Int, T>
+  { using type = std::rebind_simd_t<Int, T>; };
+
+// The following return T, which keeps the dependency chain of the latency benchmark intact. The
+// int exponents are therefore converted back to T.
+struct F_ilogb
+{
+  static constexpr char name[] = "ilogb(x)";
+
+  template <class T>
+    [[gnu::always_inline]] static T
+    apply(const T& x)
+    {
+      using ::ilogb;
+      using std::ilogb;
+      return T(ilogb(x));
+    }
+};
+
+struct F_frexp
+{
+  static constexpr char name[] = "frexp(x)";
+
+  template <class T>
+    [[gnu::always_inline]] static T
+    apply(const T& x)
+    {
+      if constexpr (vec_builtin<T>)
+        {
+          T r;
+          for (int i = 0; i < size_v<T>; ++i)
+            {
+              int e;
+              r[i] = std::frexp(x[i], &e) + e;
+            }
+          return r;
+        }
+      else
+        {
+          using std::frexp;
+          typename exponent_type<int, T>::type e;
+          const T m = frexp(x, &e);
+          return m + T(e);
+        }
+    }
+};
+
+// the exponent is opaque to the compiler, otherwise ldexp could turn into a multiplication
+template <typename Int>
+  struct F_ldexp_impl
+  {
+    static constexpr char name[] = "ldexp(x, n)";
+
+    template <class T>
+      [[gnu::always_inline]] static T
+      apply(const T& x)
+      {
+        typename exponent_type<Int, T>::type n = 3;
+        fake_modify(n);
+        if constexpr (std::same_as<Int, int>)
+          {
+            using ::ldexp;
+            using std::ldexp;
+            return ldexp(x, n);
+          }
+        else
+          {
+            using ::scalbln;
+            using std::scalbln;
+            return scalbln(x, n);
+          }
+      }
+  };
+
+using F_ldexp = F_ldexp_impl<int>;
+
+struct F_scalbln : F_ldexp_impl<long>
+{ static constexpr char name[] = "scalbln(x, n)"; };
+
+struct F_modf
+{
+  static constexpr char name[] = "modf(x)";
+
+  template <class T>
+    [[gnu::always_inline]] static T
+    apply(const T& x)
+    {
+      if constexpr (vec_builtin<T>)
+        {
+          T r;
+          for (int i = 0; i < size_v<T>; ++i)
+            {
+              value_type_t<T> ip;
+              r[i] = std::modf(x[i], &ip) + ip;
+            }
+          return r;
+        }
+      else
+        {
+          using std::modf;
+          T ip;
+          const T f = modf(x, &ip);
+          return f + ip;
+        }
+    }
+};
+
+template <typename F>
+  struct Benchmark<F>
+  {
+    static constexpr Info<2> info = {"Latency", "Throughput"};
+
+    template <typename T>
+      static constexpr bool accept = true;
+
+    template <class T>
+      [[gnu::flatten]]
+      static Times<2>
+      run()
+      {
+        using TT = value_type_t<T>;
+        // every function in this benchmark is defined and finite at 0.5 (and y = 1.5), and
+        // r * 0 + x0 keeps the dependency chain intact without letting the input drift out of the
+        // domain
+        T x0 = T() + TT(0.5);
+        T y0 = T() + TT(1.5);
+        T zero = T();
+        fake_modify(x0, y0, zero);
+
+        auto process_one = [&](T& inout) {
+          T r;
+          if constexpr (requires { F::apply(inout); })
+            r = F::apply(inout);
+          else
+            r = F::apply(inout, y0);
+          fake_modify(r);
+          inout = r * zero + x0;
+        };
+
+        auto fake_one = [&](T& inout) {
+          fake_modify(inout);
+          inout = inout * zero + x0;
+        };
+
+        T a[8] = {};
+        for (T& x : a)
+          x = x0;
+        return { time_latency(a, process_one, fake_one),
+                 time_throughput(a, process_one, fake_one) };
+      }
+  };
+
+template <typename T>
+  void
+  bench_math()
+  {
+    bench_all<T, F_exp>();
+    bench_all<T, F_exp2>();
+    bench_all<T, F_expm1>();
+    bench_all<T, F_log>();
+    bench_all<T, F_log2>();
+    bench_all<T, F_log10>();
+    bench_all<T, F_log1p>();
+    bench_all<T, F_sin>();
+    bench_all<T, F_cos>();
+    bench_all<T, F_tan>();
+    bench_all<T, F_asin>();
+    bench_all<T, F_acos>();
+    bench_all<T, F_atan>();
+    bench_all<T, F_sinh>();
+    bench_all<T, F_cosh>();
+    bench_all<T, F_tanh>();
+    bench_all<T, F_sqrt>();
+    bench_all<T, F_cbrt>();
+    bench_all<T, F_erf>();
+    bench_all<T, F_erfc>();
+    bench_all<T, F_lgamma>();
+    bench_all<T, F_tgamma>();
+    bench_all<T, F_logb>();
+    bench_all<T, F_ilogb>();
+    bench_all<T, F_frexp>();
+    bench_all<T, F_ldexp>();
+    bench_all<T, F_scalbln>();
+    bench_all<T, F_modf>();
+    bench_all<T, F_pow>();
+    bench_all<T, F_hypot>();
+    bench_all<T, F_atan2>();
+    bench_all<T, F_floor>();
+    bench_all<T, F_ceil>();
+    bench_all<T, F_round>();
+    bench_all<T, F_trunc>();
+  }
+
+int
+main()
+{
+  bench_math<float>();
+  bench_math<double>();
+}
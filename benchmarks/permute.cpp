@@ -0,0 +1,80 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* Copyright © 2025      GSI Helmholtzzentrum fuer Schwerionenforschung GmbH
+ *                       Matthias Kretz <m.kretz@gsi.de>
+ */
+
+#include "bench.h"
+#include "../permute.h"
+
+#define PERMUTATION(type, perm)                                                                    \
+struct type                                                                                        \
+{                                                                                                  \
+  static constexpr char name[] = #perm;                                                            \
+                                                                                                   \
+  template <class T>                                                                               \
+    [[gnu::always_inline]] static T                                                                \
+    apply(const T& x)                                                                              \
+    { return std::permute(x, std::permutations::perm); }                                          \
+}
+
+PERMUTATION(Reverse, reverse);
+PERMUTATION(SwapNeighbors, swap_neighbors<1>);
+PERMUTATION(DuplicateEven, duplicate_even);
+PERMUTATION(BroadcastLast, broadcast_last);
+PERMUTATION(Rotate, rotate<1>);
+PERMUTATION(Shift, shift<1>);
+
+template <typename Op>
+  struct Benchmark<Op>
+  {
+    static constexpr Info<2> info = {"Latency", "Throughput"};
+
+    template <typename T>
+      static constexpr bool accept = not vec_builtin<T> and size_v<T> >= 2;
+
+    static constexpr int Repeat = 4;
+
+    template <class T>
+      [[gnu::flatten]]
+      static Times<2>
+      run()
+      {
+        using TT = value_type_t<T>;
+
+        auto process_one = [&](T& inout) {
+          repeat_chain<Repeat>(inout, [](const T& x) { return Op::apply(x); });
+        };
+
+        auto fake_one = [&](T& inout) {
+          repeat_chain<Repeat>(inout);
+        };
+
+        T a[8] = {};
+        for (T& x : a)
+          x = T([](int i) { return TT(i); });
+        return { time_latency(a, process_one, fake_one) / Repeat,
+                 time_throughput(a, process_one, fake_one) / Repeat };
+      }
+  };
+
+template <typename T>
+  void
+  bench_permute()
+  {
+    bench_all<T, Reverse>();
+    bench_all<T, SwapNeighbors>();
+    bench_all<T, DuplicateEven>();
+    bench_all<T, BroadcastLast>();
+    bench_all<T, Rotate>();
+    bench_all<T, Shift>();
+  }
+
+int
+main()
+{
+  bench_permute<signed char>();
+  bench_permute<signed short>();
+  bench_permute<signed int>();
+  bench_permute<float>();
+  bench_permute<double>();
+}
@@ -0,0 +1,102 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* Copyright © 2025      GSI Helmholtzzentrum fuer Schwerionenforschung GmbH
+ *                       Matthias Kretz <m.kretz@gsi.de>
+ */
+
+#include "bench.h"
+#include "../simd_math.h"
+#include <cmath>
+
+MAKE_VECTORMATH_OVERLOAD(pow)
+
+namespace my
+{
+  template <typename T>
+    T
+    load(const value_type_t<T>* mem)
+    {
+      if constexpr (requires { std::simd_unchecked_load<T>(mem, T::size()); })
+        return std::simd_unchecked_load<T>(mem, T::size());
+      else
+        {
+          T r;
+          std::memcpy(&r, mem, sizeof(T));
+          return r;
+        }
+    }
+
+  template <typename T>
+    void
+    store(const T& x, value_type_t<T>* mem)
+    {
+      if constexpr (requires { std::simd_unchecked_store(x, mem, T::size()); })
+        std::simd_unchecked_store(x, mem, T::size());
+      else
+        std::memcpy(mem, &x, sizeof(T));
+    }
+
+  using ::pow;
+  using std::pow;
+}
+
+/* The inner loop of a grey radiative-transfer sweep: per cell, a Kramers-type opacity
+ * κ = κ₀ ρ T^-3.5 and the source function σT⁴/π with a per-cell exponent correction, i.e. one pow
+ * with a constant and one with a varying exponent.
+ */
+template <>
+  struct Benchmark<>
+  {
+    static constexpr Info<2> info = {"Opacity", "Source"};
+
+    template <typename T>
+      static constexpr bool accept = true;
+
+    static constexpr int N = 4096;
+
+    template <class T>
+      [[gnu::flatten]]
+      static Times<2>
+      run()
+      {
+        using TT = value_type_t<T>;
+        alignas(64) static TT rho[N];
+        alignas(64) static TT temp[N];
+        alignas(64) static TT expo[N];
+        alignas(64) static TT out[N];
+        for (int i = 0; i < N; ++i)
+          {
+            rho[i] = TT(0.5) + TT(i % 97) * TT(0.01);
+            temp[i] = TT(1) + TT(i % 113) * TT(0.07);
+            expo[i] = TT(4) - TT(i % 7) * TT(0.01);
+          }
+        T kappa0 = T() + TT(0.3);
+        T sigma = T() + TT(1.8e-2);
+        fake_modify(kappa0, sigma);
+
+        return { time_mean<200>([&] {
+                   for (int i = 0; i < N; i += size_v<T>)
+                     {
+                       const T r = my::load<T>(rho + i);
+                       const T t = my::load<T>(temp + i);
+                       my::store(kappa0 * r * my::pow(t, T() + TT(-3.5)), out + i);
+                     }
+                   asm volatile("" ::: "memory");
+                 }) / (N / size_v<T>),
+                 time_mean<200>([&] {
+                   for (int i = 0; i < N; i += size_v<T>)
+                     {
+                       const T t = my::load<T>(temp + i);
+                       const T e = my::load<T>(expo + i);
+                       my::store(sigma * my::pow(t, e), out + i);
+                     }
+                   asm volatile("" ::: "memory");
+                 }) / (N / size_v<T>) };
+      }
+  };
+
+int
+main()
+{
+  bench_all<float>();
+  bench_all<double>();
+}
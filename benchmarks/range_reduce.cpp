@@ -0,0 +1,58 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* Copyright © 2025      GSI Helmholtzzentrum fuer Schwerionenforschung GmbH
+ *                       Matthias Kretz <m.kretz@gsi.de>
+ */
+
+#include "bench.h"
+#include "../simd_algorithm.h"
+
+#include <numeric>
+
+template <>
+  struct Benchmark<>
+  {
+    static constexpr Info<2> info = {"Throughput", "Ordered"};
+
+    // the range reductions need a basic_simd type for the chunks
+    template <typename T>
+      static constexpr bool accept = not vec_builtin<T>;
+
+    static constexpr int N = 4096;
+
+    template <class T>
+      [[gnu::flatten]]
+      static Times<2>
+      run()
+      {
+        using TT = value_type_t<T>;
+        alignas(64) static TT in[N];
+        for (int i = 0; i < N; ++i)
+          in[i] = TT(i & 3);
+
+        // the scalar reference is std::accumulate, i.e. a single accumulator
+        auto reduce = [&](auto order) {
+          asm volatile("" ::: "memory");
+          TT r;
+          if constexpr (std::is_same_v<T, TT>)
+            r = std::accumulate(in, in + N, TT());
+          else
+            r = std::simd_reduce<T>(order, in);
+          fake_read(r);
+        };
+
+        return { time_mean<200>([&] { reduce(std::simd_reduction_reassociated); })
+                   / (N / size_v<T>),
+                 time_mean<200>([&] { reduce(std::simd_reduction_ordered); }) / (N / size_v<T>) };
+      }
+  };
+
+int
+main()
+{
+  bench_all<signed char>();
+  bench_all<signed short>();
+  bench_all<signed int>();
+  bench_all<signed long>();
+  bench_all<float>();
+  bench_all<double>();
+}
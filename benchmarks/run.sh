@@ -8,14 +8,22 @@ dir="${0%/*}"
 usage() {
   archlist=$($CXX -x c++ -march=xxx - 2>&1 </dev/null|grep 'valid arguments'|sed 's/^.*are: //')
   cat <<EOF
-Usage: $0 <name> [<compiler -std -f -O -I or -D flags>] [<arch list>]
+Usage: $0 <name> [<options>] [<compiler -std -f -O -I or -D flags>] [<arch list>]
 
-<name> must be one of:
+<name> must be 'all' or one of:
 $(cd "$dir"; echo *.cpp|sed 's/\.cpp\>//g')
 
 <arch list> can be any combination of:
 $archlist
 
+<options>:
+  --format=csv|json   print one record per measured value instead of the table
+                      (sets BENCH_FORMAT; json writes one object per line)
+  --output=<file>     write the results to <file> (CSV unless --format=json)
+  --baseline=<file>   compare the results against a CSV file written by an earlier
+                      --output run and exit with status 2 if any value is slower
+  --threshold=<pct>   slowdown in percent tolerated by --baseline (default: 10)
+
 The arguments can be given in any order.
 EOF
 }
@@ -27,7 +35,7 @@ set_name() {
     echo
     usage
     exit 1
-  elif [[ ! -r "$dir/${1}.cpp" ]]; then
+  elif [[ "$1" != "all" && ! -r "$dir/${1}.cpp" ]]; then
     echo "ERROR: benchmark '$1' not found."
     echo
     usage
@@ -40,12 +48,28 @@ set_name() {
 std=-std=gnu++23
 opt=-O3
 flags=("-static-libstdc++" "-Wno-psabi")
+format=
+output=
+baseline=
+threshold=10
 while (($# > 0)); do
   case "$1" in
     -h|--help)
       usage
       exit 0
       ;;
+    --format=*)
+      format="${1#--format=}"
+      ;;
+    --output=*)
+      output="${1#--output=}"
+      ;;
+    --baseline=*)
+      baseline="${1#--baseline=}"
+      ;;
+    --threshold=*)
+      threshold="${1#--threshold=}"
+      ;;
     -O*)
       opt="$1"
       ;;
@@ -66,7 +90,7 @@ while (($# > 0)); do
       set_name "${1%.cpp}"
       ;;
     *)
-      if [[ -r "$dir/${1}.cpp" ]]; then
+      if [[ "$1" == "all" || -r "$dir/${1}.cpp" ]]; then
         set_name "$1"
       else
         arch_list="$arch_list $1"
@@ -87,16 +111,97 @@ fi
 
 CCACHE=`which ccache 2>/dev/null` || CCACHE=
 
+if [[ -n "$baseline" ]]; then
+  if [[ ! -r "$baseline" ]]; then
+    echo "ERROR: cannot read baseline '$baseline'."
+    exit 1
+  elif [[ -n "$format" && "$format" != "csv" ]]; then
+    echo "ERROR: --baseline requires CSV results."
+    exit 1
+  fi
+  format=csv
+  test -z "$output" && output=$(mktemp) && trap 'rm -f "$output"' EXIT
+fi
+test -n "$output" && test -z "$format" && format=csv
+test -n "$output" && : > "$output"
+
+if [[ "$name" == "all" ]]; then
+  names=$(cd "$dir"; echo *.cpp|sed 's/\.cpp\>//g')
+else
+  names="$name"
+fi
+
 mkdir -p "$dir/bin"
-for arch in ${arch_list}; do
-  CXXFLAGS="-g0 $opt $std -march=$arch -lmvec"
-
-  echo $CCACHE $CXX $CXXFLAGS "${flags[@]}" "$dir/${name}.cpp" -o "$dir/bin/$name-$arch"
-  $CCACHE $CXX $CXXFLAGS "${flags[@]}" "$dir/${name}.cpp" -o "$dir/bin/$name-$arch" && \
-    echo "-march=$arch $flags:" && \
-    "$dir/benchmark-mode.sh" on && \
-    sudo chrt --fifo 50 "$dir/bin/$name-$arch"
-  "$dir/benchmark-mode.sh" off
+for name in ${names}; do
+  for arch in ${arch_list}; do
+    CXXFLAGS="-g0 $opt $std -march=$arch -lmvec"
+
+    echo $CCACHE $CXX $CXXFLAGS "${flags[@]}" "$dir/${name}.cpp" -o "$dir/bin/$name-$arch"
+    $CCACHE $CXX $CXXFLAGS "${flags[@]}" "$dir/${name}.cpp" -o "$dir/bin/$name-$arch" && \
+      echo "$name -march=$arch $flags:" && \
+      "$dir/benchmark-mode.sh" on && \
+      if [[ -n "$output" ]]; then
+        # only the first program writes the CSV header
+        sudo env BENCH_FORMAT=$format BENCH_NAME=$name BENCH_ARCH=$arch \
+          chrt --fifo 50 "$dir/bin/$name-$arch" \
+          | if [[ -s "$output" && "$format" == "csv" ]]; then tail -n +2; else cat; fi \
+          >> "$output"
+      else
+        sudo env BENCH_FORMAT=$format BENCH_NAME=$name BENCH_ARCH=$arch \
+          chrt --fifo 50 "$dir/bin/$name-$arch"
+      fi
+    "$dir/benchmark-mode.sh" off
+  done
 done
 
+test -z "$baseline" && exit 0
+
+# Compare the "cycles" column for every benchmark/arch/type/abi/flags/metric key present in both
+# files. New or vanished entries are listed but do not fail the comparison.
+awk -v threshold="$threshold" '
+  # splits a CSV line into f[1..7]; fields may be quoted with "" as escaped quote
+  function parse(line,    n, c, q, i, field) {
+    n = 1; q = 0; field = ""
+    for (i = 1; i <= length(line); ++i) {
+      c = substr(line, i, 1)
+      if (q && c == "\"" && substr(line, i + 1, 1) == "\"") { field = field c; ++i }
+      else if (c == "\"") q = !q
+      else if (!q && c == ",") { f[n++] = field; field = "" }
+      else field = field c
+    }
+    f[n] = field
+    return f[1] SUBSEP f[2] SUBSEP f[3] SUBSEP f[4] SUBSEP f[5] SUBSEP f[6]
+  }
+  function show(k) {
+    gsub(SUBSEP, ", ", k)
+    return k
+  }
+  FNR == 1 { next }
+  NR == FNR { base[parse($0)] = f[7]; next }
+  {
+    k = parse($0)
+    v = f[7] + 0
+    seen[k] = 1
+    if (!(k in base))
+      printf "new:     %s: %g cycles\n", show(k), v
+    else if (base[k] > 0 && v > base[k] * (1 + threshold / 100)) {
+      printf "SLOWER:  %s: %g -> %g cycles (%+.1f%%)\n", show(k), base[k], v,
+             (v / base[k] - 1) * 100
+      ++slower
+    }
+    else if (base[k] > 0 && v < base[k] / (1 + threshold / 100))
+      printf "faster:  %s: %g -> %g cycles (%+.1f%%)\n", show(k), base[k], v,
+             (v / base[k] - 1) * 100
+  }
+  END {
+    for (k in base)
+      if (!(k in seen))
+        printf "missing: %s\n", show(k)
+    if (slower) {
+      printf "%d results are more than %g%% slower than the baseline\n", slower, threshold
+      exit 2
+    }
+    print "no result is more than " threshold "% slower than the baseline"
+  }' "$baseline" "$output"
+
 # vim: tw=0 si
@@ -0,0 +1,53 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* Copyright © 2025      GSI Helmholtzzentrum fuer Schwerionenforschung GmbH
+ *                       Matthias Kretz <m.kretz@gsi.de>
+ */
+
+#include "bench.h"
+#include "../simd_scan.h"
+
+#include <numeric>
+
+template <>
+  struct Benchmark<>
+  {
+    static constexpr Info<1> info = {"Throughput"};
+
+    // the range scan needs a basic_simd type for the chunks
+    template <typename T>
+      static constexpr bool accept = not vec_builtin<T>;
+
+    static constexpr int N = 4096;
+
+    template <class T>
+      [[gnu::flatten]]
+      static Times<1>
+      run()
+      {
+        using TT = value_type_t<T>;
+        alignas(64) static TT in[N];
+        alignas(64) static TT out[N];
+        for (int i = 0; i < N; ++i)
+          in[i] = TT(i & 3);
+
+        return { time_mean<200>([&] {
+                   asm volatile("" ::: "memory");
+                   if constexpr (std::is_same_v<T, TT>)
+                     std::inclusive_scan(in, in + N, out);
+                   else
+                     std::simd_inclusive_scan<T>(in, out);
+                   asm volatile("" ::: "memory");
+                 }) / (N / size_v<T>) };
+      }
+  };
+
+int
+main()
+{
+  bench_all<signed char>();
+  bench_all<signed short>();
+  bench_all<signed int>();
+  bench_all<signed long>();
+  bench_all<float>();
+  bench_all<double>();
+}
@@ -0,0 +1,79 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* Copyright © 2025      GSI Helmholtzzentrum fuer Schwerionenforschung GmbH
+ *                       Matthias Kretz <m.kretz@gsi.de>
+ */
+
+#include "bench.h"
+
+// shifts by a constant (immediate operand) and by a simd/vector of counts
+#define SHIFT_OP(type, op, rhs)                                                                    \
+struct type                                                                                        \
+{                                                                                                  \
+  static constexpr char name[] = "x " #op " " #rhs;                                               \
+                                                                                                   \
+  template <class T>                                                                               \
+    [[gnu::always_inline]] static T                                                                \
+    apply(const T& x, [[maybe_unused]] const T& y)                                                 \
+    { return static_cast<T>(x op rhs); }                                                           \
+}
+
+SHIFT_OP(ShiftLeftImm, <<, 1);
+SHIFT_OP(ShiftRightImm, >>, 1);
+SHIFT_OP(ShiftLeft, <<, y);
+SHIFT_OP(ShiftRight, >>, y);
+
+template <typename Op>
+  struct Benchmark<Op>
+  {
+    static constexpr Info<2> info = {"Latency", "Throughput"};
+
+    template <typename T>
+      static constexpr bool accept = std::integral<value_type_t<T>>;
+
+    static constexpr int Repeat = 4;
+
+    template <class T>
+      [[gnu::flatten]]
+      static Times<2>
+      run()
+      {
+        using TT = value_type_t<T>;
+        T y = T() + TT(1);
+        fake_modify(y);
+
+        auto process_one = [&](T& inout) {
+          repeat_chain<Repeat>(inout, [&](const T& x) -> T { return Op::apply(x, y); });
+        };
+
+        auto fake_one = [&](T& inout) {
+          repeat_chain<Repeat>(inout);
+        };
+
+        T a[8] = {};
+        return { time_latency(a, process_one, fake_one) / Repeat,
+                 time_throughput(a, process_one, fake_one) / Repeat };
+      }
+  };
+
+template <typename T>
+  void
+  bench_shift()
+  {
+    bench_all<T, ShiftLeftImm>();
+    bench_all<T, ShiftRightImm>();
+    bench_all<T, ShiftLeft>();
+    bench_all<T, ShiftRight>();
+  }
+
+int
+main()
+{
+  bench_shift<signed char>();
+  bench_shift<unsigned char>();
+  bench_shift<signed short>();
+  bench_shift<unsigned short>();
+  bench_shift<signed int>();
+  bench_shift<unsigned int>();
+  bench_shift<signed long>();
+  bench_shift<unsigned long>();
+}
@@ -0,0 +1,193 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* Copyright © 2025      GSI Helmholtzzentrum fuer Schwerionenforschung GmbH
+ *                       Matthias Kretz <m.kretz@gsi.de>
+ */
+
+#include "bench.h"
+#include "../simd_math.h"
+#include <cmath>
+#include <numbers>
+
+MAKE_VECTORMATH_OVERLOAD(lgamma)
+MAKE_VECTORMATH_OVERLOAD(tgamma)
+MAKE_VECTORMATH_OVERLOAD(expint)
+MAKE_VECTORMATH_OVERLOAD(comp_ellint_1)
+MAKE_VECTORMATH_OVERLOAD(comp_ellint_2)
+
+namespace my
+{
+  template <typename T>
+    T
+    load(const value_type_t<T>* mem)
+    {
+      if constexpr (requires { std::simd_unchecked_load<T>(mem, T::size()); })
+        return std::simd_unchecked_load<T>(mem, T::size());
+      else
+        {
+          T r;
+          std::memcpy(&r, mem, sizeof(T));
+          return r;
+        }
+    }
+
+  template <typename T>
+    void
+    store(const T& x, value_type_t<T>* mem)
+    {
+      if constexpr (requires { std::simd_unchecked_store(x, mem, T::size()); })
+        std::simd_unchecked_store(x, mem, T::size());
+      else
+        std::memcpy(mem, &x, sizeof(T));
+    }
+
+  using ::lgamma;
+  using std::lgamma;
+  using ::tgamma;
+  using std::tgamma;
+  using ::expint;
+  using std::expint;
+  using ::comp_ellint_1;
+  using std::comp_ellint_1;
+  using ::comp_ellint_2;
+  using std::comp_ellint_2;
+
+  // K(k) and E(k) via the arithmetic-geometric mean, which converges quadratically and does not
+  // lose accuracy towards |k| = 1 (unlike the long double std::comp_ellint_2)
+  inline long double
+  agm_ellint(long double k, bool second_kind)
+  {
+    long double a = 1;
+    long double b = std::sqrt((1 - k) * (1 + k));
+    long double c = k;
+    long double sum = c * c / 2;
+    long double pow2 = .5L;
+    while (std::fabs(c) > a * 0x1p-40L)
+      {
+        c = (a - b) / 2;
+        const long double an = (a + b) / 2;
+        b = std::sqrt(a * b);
+        a = an;
+        pow2 *= 2;
+        sum += pow2 * c * c;
+      }
+    const long double K = std::numbers::pi_v<long double> / (2 * a);
+    return second_kind ? K * (1 - sum) : K;
+  }
+}
+
+// inputs for lgamma, tgamma, expint, and the elliptic integrals
+template <typename T>
+  T
+  special_input(int f, int i, int n)
+  {
+    const T t = (T(i) + T(.5)) / T(n);
+    switch (f)
+      {
+      case 0: // (0, 100]
+        return t * T(100);
+      case 1: // [-20, 20], avoiding the poles
+        return (t * T(40) - T(20)) + (i % 2 ? T(.25) : T(-.25)) * T(i % 3 == 0);
+      case 2: // [-20, 50]
+        return t * T(70) - T(20);
+      default: // (-0.99, 0.99)
+        return (t * T(2) - T(1)) * T(.99);
+      }
+  }
+
+template <typename T>
+  double
+  special_ulp(T x, long double ref)
+  {
+    const T r = T(ref);
+    if (std::isnan(ref) or std::isinf(r))
+      return x == r or (std::isnan(x) and std::isnan(r)) ? 0 : INFINITY;
+    const long double ulp = std::nextafter(std::fabs(r), std::numeric_limits<T>::infinity())
+                              - std::fabs(r);
+    return double(std::fabs(x - ref) / ulp);
+  }
+
+/* Throughput of the gamma functions, the exponential integral, and the complete elliptic
+ * integrals over a buffer of arguments. The scalar std:: special functions are iterative and
+ * therefore much slower than the vector implementations.
+ */
+template <>
+  struct Benchmark<>
+  {
+    static constexpr Info<5> info = {"lgamma", "tgamma", "expint", "ellint_1", "ellint_2"};
+
+    template <typename T>
+      static constexpr bool accept = true;
+
+    static constexpr int N = 4096;
+
+    template <class T>
+      [[gnu::flatten]]
+      static Times<5>
+      run()
+      {
+        using TT = value_type_t<T>;
+        alignas(64) static TT in[4][N];
+        alignas(64) static TT out[N];
+        for (int f = 0; f < 4; ++f)
+          for (int i = 0; i < N; ++i)
+            in[f][i] = special_input<TT>(f, i, N);
+
+        auto time_fun = [&](const TT* input, auto&& fun) {
+          return time_mean<200>([&] {
+                   for (int i = 0; i < N; i += size_v<T>)
+                     my::store(fun(my::load<T>(input + i)), out + i);
+                   asm volatile("" ::: "memory");
+                 }) / (N / size_v<T>);
+        };
+
+        return { time_fun(in[0], [](const T& x) { return my::lgamma(x); }),
+                 time_fun(in[1], [](const T& x) { return my::tgamma(x); }),
+                 time_fun(in[2], [](const T& x) { return my::expint(x); }),
+                 time_fun(in[3], [](const T& x) { return my::comp_ellint_1(x); }),
+                 time_fun(in[3], [](const T& x) { return my::comp_ellint_2(x); }) };
+      }
+  };
+
+// Maximum error of std::simd<T> over the benchmark inputs with respect to long double references.
+template <typename T>
+  void
+  print_accuracy()
+  {
+    using V = std::simd<T>;
+    constexpr int N = Benchmark<>::N;
+    using Ref = long double (*)(long double);
+    const Ref refs[5] = {
+      [](long double x) { return std::lgamma(x); },
+      [](long double x) { return std::tgamma(x); },
+      [](long double x) { return std::expint(x); },
+      [](long double k) { return my::agm_ellint(k, false); },
+      [](long double k) { return my::agm_ellint(k, true); }
+    };
+    std::cout << "max error [ulp] " << (std::is_same_v<T, float> ? " float" : "double") << ':';
+    for (int f = 0; f < 5; ++f)
+      {
+        double max_ulp = 0;
+        for (int i = 0; i < N; i += V::size())
+          {
+            const V x([&](int j) { return special_input<T>(f < 4 ? f : 3, i + j, N); });
+            const V r = f == 0 ? lgamma(x) : f == 1 ? tgamma(x) : f == 2 ? expint(x)
+                                           : f == 3 ? comp_ellint_1(x) : comp_ellint_2(x);
+            for (int j = 0; j < V::size(); ++j)
+              max_ulp = std::max(max_ulp, special_ulp(r[j], refs[f](x[j])));
+          }
+        std::cout << ' ' << Benchmark<>::info[f] << ' ' << std::setprecision(3) << max_ulp;
+      }
+    std::cout << '\n';
+  }
+
+int
+main()
+{
+  bench_all<float>();
+  bench_all<double>();
+  if (output_format() == OutputFormat::Table)
+    {
+      print_accuracy<float>();
+      print_accuracy<double>();
+    }
+}
@@ -0,0 +1,133 @@
+#include "../simd"
+namespace simd = std;
+
+using V = simd::simd<float, 4>;
+
+/* codegen
+^load2(
+vmovups	xmm
+vmovups	xmm
+vshufps	.*, 136
+vshufps	.*, 221
+vmovaps
+vmovaps
+ret
+ */
+auto
+load2(const float* p)
+{ return simd::simd_load_interleaved<2, V>(std::span<const float, 8>(p, 8)); }
+
+/* codegen
+^load3(
+vmovups	xmm
+vmovups	xmm
+vmovups	xmm
+vpermilps	.*, 236
+vpermilps	.*, 100
+vblendps	.*, 4
+vblendps	.*, 8
+vmovaps	XMMWORD PTR .rdi.
+vpshufb
+vpshufb
+vpor
+vpalignr	.*, 8
+vpermilps	.*, 164
+vblendps	.*, 8
+vpermilps	.*, 76
+vshufps	.*, 196
+vmovaps	XMMWORD PTR 16.rdi.
+vmovaps	XMMWORD PTR 32.rdi.
+ret
+ */
+auto
+load3(const float* p)
+{ return simd::simd_load_interleaved<3, V>(std::span<const float, 12>(p, 12)); }
+
+/* codegen
+^load4(
+vmovups	xmm
+vmovups	xmm
+vmovups	xmm
+vmovups	xmm
+vshufps	.*, 136
+vshufps	.*, 221
+vshufps	.*, 136
+vshufps	.*, 221
+vshufps	.*, 136
+vshufps	.*, 221
+vmovaps
+vmovaps
+vshufps	.*, 136
+vshufps	.*, 221
+vmovaps
+vmovaps
+ret
+ */
+auto
+load4(const float* p)
+{ return simd::simd_load_interleaved<4, V>(std::span<const float, 16>(p, 16)); }
+
+/* codegen
+^store2(
+vmovaps	xmm
+vmovaps	xmm
+vunpcklps
+vunpckhps
+vmovups
+vmovups
+ret
+ */
+void
+store2(const std::array<V, 2>& v, float* p)
+{ simd::simd_store_interleaved(v, std::span<float, 8>(p, 8)); }
+
+/* codegen
+^store3(
+vmovaps	xmm
+vmovaps	xmm
+vmovaps	xmm
+vpshufb
+vpshufb
+vpor
+vpermilps	.*, 196
+vblendps	.*, 4
+vmovups	XMMWORD PTR .rsi.
+vpermilps	.*, 165
+vblendps	.*, 6
+vpshufb
+vpshufb
+vblendps	.*, 2
+vpor
+vpermilps	.*, 230
+vblendps	.*, 6
+vmovups	XMMWORD PTR 16.rsi.
+vmovups	XMMWORD PTR 32.rsi.
+ret
+ */
+void
+store3(const std::array<V, 3>& v, float* p)
+{ simd::simd_store_interleaved(v, std::span<float, 12>(p, 12)); }
+
+/* codegen
+^store4(
+vmovaps	xmm
+vmovaps	xmm
+vmovaps	xmm
+vmovaps	xmm
+vunpcklps
+vunpckhps
+vunpcklps
+vunpckhps
+vunpcklps
+vunpckhps
+vmovups
+vunpcklps
+vunpckhps
+vmovups
+vmovups
+vmovups
+ret
+ */
+void
+store4(const std::array<V, 4>& v, float* p)
+{ simd::simd_store_interleaved(v, std::span<float, 16>(p, 16)); }
@@ -191,6 +191,13 @@ template <template <typename> class Tpl>
 
 template struct instantiate_all_vectorizable<test_usable_simd>;
 
+// only complex<float> and complex<double> are vectorizable complex types
+static_assert(std::__detail::__is_vectorizable_complex<std::complex<float>>::value);
+static_assert(std::__detail::__is_vectorizable_complex<std::complex<double>>::value);
+#ifdef __STDCPP_FLOAT16_T__
+static_assert(not std::__detail::__is_vectorizable_complex<std::complex<std::float16_t>>::value);
+#endif
+
 // simd generator ctor ///////////////
 
 namespace test_generator
@@ -607,4 +614,21 @@ namespace math_tests
                                   vir::constexpr_wrapper<2>, std::simd<float, 1>>);
   static_assert(hypot_invocable_r<std::simd<float, 1>, holder<short>,
                                   std::simd<float, 1>, float>);
+
+  // The generic _S_nearbyint is used without SSE4.1. Its shifter must have the sign of x.
+  template <typename V>
+    constexpr bool
+    generic_nearbyint_is(V x, V expected)
+    {
+      const V r = simd::__detail::_ImplBuiltinBase<simd::_VecAbi<4>>::_S_nearbyint(x);
+      for (int i = 0; i < simd::__detail::__width_of<V>; ++i)
+        if (r[i] != expected[i])
+          return false;
+      return true;
+    }
+
+  static_assert(generic_nearbyint_is(simd::__detail::__v4float{-2.5f, -.75f, 1.5f, -7.25f},
+                                     simd::__detail::__v4float{-2.f, -1.f, 2.f, -7.f}));
+  static_assert(generic_nearbyint_is(simd::__detail::__v2double{-2.5, -1.5},
+                                     simd::__detail::__v2double{-2., -2.}));
 }
@@ -205,7 +205,7 @@ namespace std::__detail
         if constexpr (_Np == 1)
           return _M_bits[0];
         else if constexpr (!_Sanitized)
-          return _M_sanitized().none();
+          return _M_sanitized().count();
         else
           {
             int __result = __builtin_popcountll(_M_bits[0]);
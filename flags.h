@@ -49,7 +49,8 @@ namespace std::__detail
           }
         else
           {
-            return static_cast<_Up*>(__builtin_assume_aligned(__ptr, simd_alignment_v<_Tp, _Up>));
+            return static_cast<_Up*>(
+                     __builtin_assume_aligned(__ptr, simd_alignment_v<_Tp, remove_cv_t<_Up>>));
           }
       }
   };
@@ -75,33 +76,36 @@ namespace std::__detail
         }
     };
 
+  /**
+   * Non-temporal loads and stores. Streaming implies an aligned pointer (and a precondition
+   * check for it).
+   */
   struct _Streaming
-  : _LoadStoreTag
+  : _Aligned
   {};
 
+  /**
+   * Software prefetch for loads and stores. A load/store at address p additionally prefetches
+   * the cache line at p + _L1 into L1 and the cache line at p + _L2 into L2. The distances are
+   * in Bytes; 0 disables the prefetch for that level.
+   */
   template <int _L1, int _L2 /*, exclusive vs. shared*/>
     struct _Prefetch
     : _LoadStoreTag
     {
-      template <typename, typename _Up>
-        _GLIBCXX_SIMD_ALWAYS_INLINE static _Up*
-        _S_adjust_pointer(_Up* __ptr)
+      static_assert(_L1 >= 0 and _L2 >= 0);
+
+      template <bool _Write, typename _Up>
+        _GLIBCXX_SIMD_ALWAYS_INLINE static void
+        _S_prefetch(const _Up* __ptr)
         {
-          // one read: 0, 0
-          // L1: 0, 1
-          // L2: 0, 2
-          // L3: 0, 3
-          // (exclusive cache line) for writing: 1, 0 / 1, 1
-          /*          constexpr int __write = 1;
-                      constexpr int __level = 0-3;
-          __builtin_prefetch(__ptr, __write, __level)
-          _mm_prefetch(reinterpret_cast<char const*>(__ptr), _MM_HINT_T0);
-          _mm_prefetch(reinterpret_cast<char const*>(__ptr), _MM_HINT_T1);
-          _mm_prefetch(reinterpret_cast<char const*>(__ptr), _MM_HINT_T2);
-          _mm_prefetch(reinterpret_cast<char const*>(__ptr), _MM_HINT_ET0);
-          _mm_prefetch(reinterpret_cast<char const*>(__ptr), _MM_HINT_ET1);
-          _mm_prefetch(reinterpret_cast<char const*>(__ptr), _MM_HINT_NTA);*/
-          return __ptr;
+          // The prefetch address may lie outside of the object __ptr points into. Compute it
+          // without pointer arithmetic on __ptr. Prefetches never fault.
+          const auto __addr = reinterpret_cast<__UINTPTR_TYPE__>(__ptr);
+          if constexpr (_L1 > 0)
+            __builtin_prefetch(reinterpret_cast<const void*>(__addr + _L1), _Write, 3);
+          if constexpr (_L2 > 0)
+            __builtin_prefetch(reinterpret_cast<const void*>(__addr + _L2), _Write, 2);
         }
     };
 
@@ -215,6 +219,25 @@ namespace std
           (_S_apply_adjust_pointer<_Flags, _Tp>(__ptr), ...);
           return __ptr;
         }
+
+      static constexpr bool _S_streaming = (is_base_of_v<__detail::_Streaming, _Flags> or ...);
+
+      /**
+       * Issues the prefetches requested via __flag_prefetch for a load (_Write = false) or store
+       * (_Write = true) at __ptr.
+       */
+      template <bool _Write, typename _Up>
+        _GLIBCXX_SIMD_ALWAYS_INLINE static constexpr void
+        _S_prefetch(const _Up* __ptr)
+        {
+          if !consteval
+            {
+              ([&] {
+                if constexpr (requires { _Flags::template _S_prefetch<_Write>(__ptr); })
+                  _Flags::template _S_prefetch<_Write>(__ptr);
+              }(), ...);
+            }
+        }
     };
 
   // [simd.simd_flags]
@@ -238,7 +261,7 @@ namespace std
 
   inline constexpr std::simd_flags<__detail::_Streaming> __flag_streaming;
 
-  template <int _L1, int _L2>
+  template <int _L1 = 16 * 64, int _L2 = 128 * 64>
     inline constexpr std::simd_flags<__detail::_Prefetch<_L1, _L2>> __flag_prefetch;
 
   [[deprecated("use simd_flag_default")]]
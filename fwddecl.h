@@ -94,7 +94,7 @@ namespace std
     template <> struct __is_vectorizable<float> : bool_constant<true> {};
     template <> struct __is_vectorizable<double> : bool_constant<true> {};
 #ifdef __STDCPP_FLOAT16_T__
-    //template <> struct __is_vectorizable<std::float16_t> : bool_constant<true> {};
+    template <> struct __is_vectorizable<std::float16_t> : bool_constant<true> {};
 #endif
 #ifdef __STDCPP_FLOAT32_T__
     template <> struct __is_vectorizable<std::float32_t> : bool_constant<true> {};
@@ -106,6 +106,12 @@ namespace std
     template <typename _Tp>
       concept __vectorizable = __is_vectorizable<_Tp>::value;
 
+    // specialized in simd_complex.h
+    template <typename _Tp>
+      struct __is_vectorizable_complex
+      : bool_constant<false>
+      {};
+
     template <typename _Tp, typename>
       struct __make_dependent
       { using type = _Tp; };
@@ -141,6 +147,9 @@ namespace std
             constexpr int __one = sizeof(_Tp) / sizeof(_Tp);
             return __native_abi_impl_recursive<__one * 256, _Tp>();
           }
+        else if constexpr (__is_vectorizable_complex<_Tp>::value)
+          // interleaved (real, imaginary) pairs in the native ABI of the real type
+          return __native_abi_impl<typename _Tp::value_type>();
         else
           return _InvalidAbi();
       }
@@ -8,6 +8,10 @@
 
 #include "simd.h"
 #include "iota.h"
+#include "loadstore.h"
+
+#include <array>
+#include <bit>
 
 namespace std
 {
@@ -44,6 +48,218 @@ namespace std
       }(std::make_index_sequence<__n>());
     }
 
+  namespace __detail
+  {
+    /**
+     * Returns {vector index, element index} of the source of element __i of output vector __r.
+     * _Deinterleave: the _Np inputs are consecutive chunks of an interleaved sequence.
+     * Otherwise: the _Np inputs are interleaved into consecutive chunks.
+     */
+    template <int _Np, int _Width, bool _Deinterleave>
+      consteval pair<int, int>
+      __interleave_source(int __r, int __i)
+      {
+        if constexpr (_Deinterleave)
+          {
+            const int __f = __i * _Np + __r;
+            return {__f / _Width, __f % _Width};
+          }
+        else
+          {
+            const int __f = __r * _Width + __i;
+            return {__f % _Np, __f / _Np};
+          }
+      }
+
+    /**
+     * Shuffle indices for step _Kp of building output vector _Rp. Step 1 combines inputs 0 and
+     * 1, every following step _Kp combines the previous result with input _Kp. Elements not
+     * coming from the inputs of the step keep their index (i.e. their value from the first
+     * operand).
+     */
+    template <int _Np, int _Width, bool _Deinterleave, int _Rp, int _Kp, int _Bp>
+      consteval array<int, _Bp>
+      __interleave_indices()
+      {
+        array<int, _Bp> __idx = {};
+        for (int __i = 0; __i < _Bp; ++__i)
+          {
+            __idx[__i] = __i;
+            if (__i < _Width)
+              {
+                const auto [__k, __e]
+                  = __interleave_source<_Np, _Width, _Deinterleave>(_Rp, __i);
+                if (__k == _Kp)
+                  __idx[__i] = _Bp + __e;
+                else if (_Kp == 1 and __k == 0)
+                  __idx[__i] = __e;
+              }
+          }
+        return __idx;
+      }
+
+    template <int _Np, int _Width, bool _Deinterleave, int _Rp, typename _TV, size_t... _Ks>
+      _GLIBCXX_SIMD_INTRINSIC constexpr _TV
+      __vec_interleave_one(const array<_TV, _Np>& __v, index_sequence<_Ks...>)
+      {
+        constexpr int _Bp = __width_of<_TV>;
+        _TV __acc = __v[0];
+        ([&] [[__gnu__::__always_inline__]] {
+          constexpr auto __idx
+            = __interleave_indices<_Np, _Width, _Deinterleave, _Rp, _Ks + 1, _Bp>();
+          __acc = _GLIBCXX_SIMD_INT_PACK(_Bp, _Is, {
+                    return __builtin_shufflevector(__acc, __v[_Ks + 1], __idx[_Is]...);
+                  });
+        }(), ...);
+        return __acc;
+      }
+
+    /**
+     * Deinterleaves (or interleaves) _Np vector builtins with _Width elements each.
+     *
+     * A power-of-2 _Np recurses on two-input (de)interleaving, which requires log2(_Np)
+     * two-input shuffles per vector. Otherwise every output is built from _Np - 1 two-input
+     * shuffles. The compiler lowers the two-input shuffles to unpack/shuffle/blend sequences or a
+     * vpermt2* (AVX-512).
+     */
+    template <bool _Deinterleave, int _Width, typename _TV, size_t _Np>
+      _GLIBCXX_SIMD_INTRINSIC constexpr array<_TV, _Np>
+      __vec_interleave(const array<_TV, _Np>& __v)
+      {
+        if constexpr (_Np == 1)
+          return __v;
+        else if constexpr (_Np == 2 or not std::has_single_bit(_Np))
+          return [&]<int... _Rs> [[__gnu__::__always_inline__]] (integer_sequence<int, _Rs...>) {
+                   return array<_TV, _Np> {
+                     __vec_interleave_one<_Np, _Width, _Deinterleave, _Rs>(
+                       __v, make_index_sequence<_Np - 1>())...
+                   };
+                 }(make_integer_sequence<int, _Np>());
+        else
+          {
+            constexpr size_t _Hp = _Np / 2;
+            array<_TV, _Hp> __even, __odd;
+            array<_TV, _Np> __r;
+            if constexpr (_Deinterleave)
+              {
+                for (size_t __p = 0; __p < _Hp; ++__p)
+                  {
+                    const auto [__e, __o] = __vec_interleave<true, _Width>(
+                                              array<_TV, 2>{__v[2 * __p], __v[2 * __p + 1]});
+                    __even[__p] = __e;
+                    __odd[__p] = __o;
+                  }
+                __even = __vec_interleave<true, _Width>(__even);
+                __odd = __vec_interleave<true, _Width>(__odd);
+                for (size_t __q = 0; __q < _Hp; ++__q)
+                  {
+                    __r[2 * __q] = __even[__q];
+                    __r[2 * __q + 1] = __odd[__q];
+                  }
+              }
+            else
+              {
+                for (size_t __q = 0; __q < _Hp; ++__q)
+                  {
+                    __even[__q] = __v[2 * __q];
+                    __odd[__q] = __v[2 * __q + 1];
+                  }
+                __even = __vec_interleave<false, _Width>(__even);
+                __odd = __vec_interleave<false, _Width>(__odd);
+                for (size_t __p = 0; __p < _Hp; ++__p)
+                  {
+                    const auto [__lo, __hi]
+                      = __vec_interleave<false, _Width>(array<_TV, 2>{__even[__p], __odd[__p]});
+                    __r[2 * __p] = __lo;
+                    __r[2 * __p + 1] = __hi;
+                  }
+              }
+            return __r;
+          }
+      }
+  }
+
+  /**
+   * Loads _Np * _Vp::size() elements of _Np interleaved sequences (e.g. xyzxyzxyz... for _Np = 3)
+   * from __r and returns one basic_simd per sequence (e.g. {xxx..., yyy..., zzz...}).
+   *
+   * Precondition: ranges::size(__r) >= _Np * _Vp::size()
+   */
+  template <int _Np, class _Vp = void, __detail::__sized_contiguous_range _Rg,
+            typename... _Flags>
+    requires (_Np >= 1)
+    _GLIBCXX_SIMD_ALWAYS_INLINE
+    constexpr array<__detail::__simd_load_return_t<_Vp, ranges::range_value_t<_Rg>>, _Np>
+    simd_load_interleaved(_Rg&& __r, simd_flags<_Flags...> __f = {})
+    {
+      using _RV = __detail::__simd_load_return_t<_Vp, ranges::range_value_t<_Rg>>;
+      using _Rp = typename _RV::value_type;
+      using _Up = ranges::range_value_t<_Rg>;
+      constexpr int __width = _RV::size();
+      __glibcxx_simd_precondition(ranges::size(__r) >= size_t(_Np * __width),
+                                  "Input range is too small.");
+      const _Up* __ptr = ranges::data(__r);
+      using _TV = std::__remove_cvref_t<decltype(__data(declval<const _RV&>()))>;
+      if constexpr (__detail::__vec_builtin<_TV>)
+        {
+          if (not __builtin_is_constant_evaluated())
+            return [&]<int... _Ks> [[__gnu__::__always_inline__]]
+                     (integer_sequence<int, _Ks...>) {
+                       const array<_TV, _Np> __chunks = {
+                         __data(simd_unchecked_load<_RV>(
+                                  span<const _Up, __width>(__ptr + _Ks * __width, __width), __f))...
+                       };
+                       const auto __r2 = __detail::__vec_interleave<true, __width>(__chunks);
+                       return array<_RV, _Np> {_RV(__detail::__private_init, __r2[_Ks])...};
+                     }(make_integer_sequence<int, _Np>());
+        }
+      return [&]<int... _Js> [[__gnu__::__always_inline__]] (integer_sequence<int, _Js...>) {
+               return array<_RV, _Np> {
+                 _RV([&](int __i) { return static_cast<_Rp>(__ptr[__i * _Np + _Js]); })...
+               };
+             }(make_integer_sequence<int, _Np>());
+    }
+
+  /**
+   * Stores the _Np basic_simd objects in __v interleaved to __r (e.g. {xxx..., yyy..., zzz...}
+   * is stored as xyzxyzxyz...). This is the inverse of simd_load_interleaved.
+   *
+   * Precondition: ranges::size(__r) >= _Np * _Vp::size()
+   */
+  template <typename _Tp, typename _Abi, size_t _Np, __detail::__sized_contiguous_range _Rg,
+            typename... _Flags>
+    requires (_Np >= 1) and indirectly_writable<ranges::iterator_t<_Rg>, _Tp>
+    _GLIBCXX_SIMD_ALWAYS_INLINE
+    constexpr void
+    simd_store_interleaved(const array<basic_simd<_Tp, _Abi>, _Np>& __v, _Rg&& __r,
+                           simd_flags<_Flags...> __f = {})
+    {
+      using _TV = basic_simd<_Tp, _Abi>;
+      using _Up = ranges::range_value_t<_Rg>;
+      constexpr int __width = _TV::size();
+      __glibcxx_simd_precondition(ranges::size(__r) >= _Np * __width,
+                                  "Output range is too small.");
+      _Up* __ptr = ranges::data(__r);
+      using _VV = std::__remove_cvref_t<decltype(__data(__v[0]))>;
+      if constexpr (__detail::__vec_builtin<_VV>)
+        {
+          if (not __builtin_is_constant_evaluated())
+            {
+              const auto __r2
+                = [&]<size_t... _Js> [[__gnu__::__always_inline__]] (index_sequence<_Js...>) {
+                    return __detail::__vec_interleave<false, __width>(
+                             array<_VV, _Np> {__data(__v[_Js])...});
+                  }(make_index_sequence<_Np>());
+              for (size_t __k = 0; __k < _Np; ++__k)
+                simd_unchecked_store(_TV(__detail::__private_init, __r2[__k]),
+                                     span<_Up, __width>(__ptr + __k * __width, __width), __f);
+              return;
+            }
+        }
+      for (int __i = 0; __i < __width; ++__i)
+        for (size_t __j = 0; __j < _Np; ++__j)
+          __ptr[__i * _Np + __j] = static_cast<_Up>(__v[__j][__i]);
+    }
 }
 
 #endif // PROTOTYPE_INTERLEAVE_H_
@@ -37,6 +37,40 @@ namespace std
 
     template <typename _Vp, typename _Tp>
       using __load_mask_type_t = typename __simd_load_return_t<_Vp, _Tp>::mask_type;
+
+    /**
+     * Checks the alignment precondition of __flag_streaming and issues the prefetches requested
+     * via __flag_prefetch for a load (_Write = false) or store (_Write = true) of _Vp at __ptr.
+     */
+    template <typename _Vp, bool _Write, typename _Up, typename... _Flags>
+      _GLIBCXX_SIMD_ALWAYS_INLINE constexpr void
+      __apply_loadstore_hints(const _Up* __ptr, simd_flags<_Flags...> __f)
+      {
+        if !consteval
+          {
+            if constexpr (simd_flags<_Flags...>::_S_streaming)
+              __glibcxx_simd_precondition(
+                reinterpret_cast<__UINTPTR_TYPE__>(__ptr) % (simd_alignment_v<_Vp, _Up>) == 0,
+                "Streaming loads and stores require a pointer aligned to "
+                "'std::simd_alignment_v'.");
+            __f.template _S_prefetch<_Write>(__ptr);
+          }
+      }
+  }
+
+  /**
+   * Orders all preceding stores, in particular the non-temporal stores issued via
+   * '__flag_streaming', before all subsequent stores. Streaming stores are weakly ordered; call
+   * this before publishing data written that way to another thread.
+   */
+  _GLIBCXX_SIMD_ALWAYS_INLINE inline void
+  __streaming_fence() noexcept
+  {
+#if _GLIBCXX_SIMD_HAVE_SSE
+    __builtin_ia32_sfence();
+#else
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+#endif
   }
 
   template <class _Vp = void, ranges::range _Rg, typename... _Flags>
@@ -105,6 +139,7 @@ namespace std
       static_assert(__static_size >= _RV::size.value or __allow_out_of_bounds
                       or __static_size == dynamic_extent, "Out-of-bounds simd load");
 
+      __detail::__apply_loadstore_hints<_RV, false>(ranges::data(__r), __f);
       const auto* __ptr = __f.template _S_adjust_pointer<_RV>(ranges::data(__r));
       constexpr __detail::__canonical_vec_type_t<_Rp>* __type_tag = nullptr;
 
@@ -128,8 +163,11 @@ namespace std
         }
       else
         {
-          if constexpr ((__static_size != dynamic_extent and __static_size >= _RV::size())
-                          or not __allow_out_of_bounds)
+          if constexpr (((__static_size != dynamic_extent and __static_size >= _RV::size())
+                           or not __allow_out_of_bounds) and simd_flags<_Flags...>::_S_streaming)
+            return _RV(__detail::__private_init, _RV::_Impl::_S_stream_load(__ptr, __type_tag));
+          else if constexpr ((__static_size != dynamic_extent and __static_size >= _RV::size())
+                               or not __allow_out_of_bounds)
             return _RV(__detail::__private_init, _RV::_Impl::_S_load(__ptr, __type_tag));
           else
             return _RV(__detail::__private_init, _RV::_Impl::_S_partial_load(__ptr, __rg_size,
@@ -250,6 +288,7 @@ namespace std
       static_assert(__static_size >= _RV::size.value or __allow_out_of_bounds
                       or __static_size == dynamic_extent, "Out-of-bounds simd load");
 
+      __detail::__apply_loadstore_hints<_RV, false>(ranges::data(__r), __f);
       const auto* __ptr = __f.template _S_adjust_pointer<_RV>(ranges::data(__r));
       constexpr __detail::__canonical_vec_type_t<_Rp>* __type_tag = nullptr;
 
@@ -274,15 +313,17 @@ namespace std
         }
       else if constexpr ((__static_size != dynamic_extent and __static_size >= _RV::size())
                       or not __allow_out_of_bounds)
-        return _RV::_Impl::_S_masked_load(__k._M_data, __ptr, __type_tag);
+        return _RV(__detail::__private_init,
+                   _RV::_Impl::_S_masked_load(__k._M_data, __ptr, __type_tag));
       else if (__rg_size >= _RV::size())
-        return _RV::_Impl::_S_masked_load(__k._M_data, __ptr, __type_tag);
+        return _RV(__detail::__private_init,
+                   _RV::_Impl::_S_masked_load(__k._M_data, __ptr, __type_tag));
       else
         {
           using _Ip = __detail::__mask_integer_from<sizeof(_Rp)>;
           auto __k2 = _RV::mask_type::_Impl::template _S_mask_with_n_true<_Ip>(__rg_size);
           __k2 = _RV::mask_type::_Impl::_S_logical_and(__k._M_data, __k2);
-          return _RV::_Impl::_S_masked_load(__k2, __ptr, __type_tag);
+          return _RV(__detail::__private_init, _RV::_Impl::_S_masked_load(__k2, __ptr, __type_tag));
         }
     }
 
@@ -352,8 +393,10 @@ namespace std
       static_assert(__static_size >= _TV::size.value or __allow_out_of_bounds
                       or __static_size == dynamic_extent, "Out-of-bounds simd store");
 
+      __detail::__apply_loadstore_hints<_TV, true>(ranges::data(__r), __f);
       auto* __ptr = __f.template _S_adjust_pointer<_TV>(ranges::data(__r));
       constexpr __detail::__canonical_vec_type_t<_Tp>* __type_tag = nullptr;
+      constexpr bool __streaming = simd_flags<_Flags...>::_S_streaming;
 
       const auto __rg_size = ranges::size(__r);
       if constexpr (not __allow_out_of_bounds)
@@ -379,9 +422,14 @@ namespace std
           _TV::_Impl::_S_masked_store(__v._M_data, __ptr, __k._M_data);
         }
 #endif
+      else if constexpr (((__static_size != dynamic_extent and __static_size >= _TV::size())
+                            or not __allow_out_of_bounds) and __streaming)
+        _TV::_Impl::_S_stream_store(__v._M_data, __ptr, __type_tag);
       else if constexpr ((__static_size != dynamic_extent and __static_size >= _TV::size())
                         or not __allow_out_of_bounds)
         _TV::_Impl::_S_store(__v._M_data, __ptr, __type_tag);
+      else if (__streaming and __rg_size >= _TV::size())
+        _TV::_Impl::_S_stream_store(__v._M_data, __ptr, __type_tag);
       else if (__rg_size >= _TV::size())
         _TV::_Impl::_S_store(__v._M_data, __ptr, __type_tag);
       else if (__builtin_constant_p(__rg_size))
@@ -456,6 +504,7 @@ namespace std
       static_assert(__static_size >= _TV::size.value or __allow_out_of_bounds
                       or __static_size == dynamic_extent, "Out-of-bounds simd store");
 
+      __detail::__apply_loadstore_hints<_TV, true>(ranges::data(__r), __f);
       auto* __ptr = __f.template _S_adjust_pointer<_TV>(ranges::data(__r));
 
       if constexpr (not __allow_out_of_bounds)
@@ -536,5 +585,303 @@ namespace std
                          const typename basic_simd<_Tp, _Abi>::mask_type& __k,
                        simd_flags<_Flags...> __f = {})
     { simd_partial_store(__v, span(__first, __last), __k, __f); }
+
+  // gather & scatter /////////////////////////////////////////////////////////////////////////////
+
+  namespace __detail
+  {
+    template <typename _Vp, typename _Tp, typename _Idx>
+      struct __simd_gather_return;
+
+    template <typename _Tp, typename _Idx>
+      struct __simd_gather_return<void, _Tp, _Idx>
+      { using type = rebind_simd_t<_Tp, _Idx>; };
+
+    template <typename _Up, typename _Abi, typename _Tp, typename _Idx>
+      requires (basic_simd<_Up, _Abi>::size() == _Idx::size())
+      struct __simd_gather_return<basic_simd<_Up, _Abi>, _Tp, _Idx>
+      { using type = basic_simd<_Up, _Abi>; };
+
+    template <typename _Vp, typename _Tp, typename _Idx>
+      using __simd_gather_return_t = typename __simd_gather_return<_Vp, _Tp, _Idx>::type;
+
+    template <typename _Vp, typename _Tp, typename _Idx>
+      using __gather_mask_type_t = typename __simd_gather_return_t<_Vp, _Tp, _Idx>::mask_type;
+
+    // Returns which elements of __idx are valid indexes into a range of size __size.
+    template <typename _Mp, typename _Ip, typename _Abi>
+      _GLIBCXX_SIMD_INTRINSIC constexpr _Mp
+      __index_in_bounds(const basic_simd<_Ip, _Abi>& __idx, size_t __size)
+      {
+        using _IMp = typename basic_simd<_Ip, _Abi>::mask_type;
+        const _IMp __nonnegative = is_signed_v<_Ip> ? __idx >= _Ip() : _IMp(true);
+        const _IMp __k = __size > size_t(numeric_limits<_Ip>::max())
+                           ? __nonnegative : __nonnegative and __idx < _Ip(__size);
+        if constexpr (is_same_v<_IMp, _Mp>)
+          return __k;
+        else
+          return _Mp([&](int __i) { return __k[__i]; });
+      }
+  }
+
+  /* Gathers __r[__idx[__i]] for every element __i. The result type is _Vp if given, otherwise
+   * basic_simd<range_value_t<_Rg>> with the size of __idx.
+   * Without __allow_partial_loadstore all indexes must be valid. With __allow_partial_loadstore
+   * out-of-bounds indexes yield a value-initialized element. With __flag_throw out-of-bounds
+   * indexes throw out_of_range.
+   */
+  template <class _Vp = void, __detail::__sized_contiguous_range _Rg, integral _Ip,
+            typename _IAbi, typename... _Flags>
+    _GLIBCXX_SIMD_ALWAYS_INLINE
+    constexpr __detail::__simd_gather_return_t<_Vp, ranges::range_value_t<_Rg>,
+                                               basic_simd<_Ip, _IAbi>>
+    simd_gather_from(_Rg&& __r, const basic_simd<_Ip, _IAbi>& __idx,
+                     const __detail::__gather_mask_type_t<_Vp, ranges::range_value_t<_Rg>,
+                                                          basic_simd<_Ip, _IAbi>>& __k,
+                     simd_flags<_Flags...> = {})
+    {
+      using _RV = __detail::__simd_gather_return_t<_Vp, ranges::range_value_t<_Rg>,
+                                                   basic_simd<_Ip, _IAbi>>;
+      using _Rp = typename _RV::value_type;
+      using _Mp = typename _RV::mask_type;
+      static_assert(__detail::__loadstore_convertible_to<
+                      ranges::range_value_t<_Rg>, _Rp, _Flags...>,
+                    "The converting gather is not value-preserving. "
+                    "Pass 'std::simd_flag_convert' if lossy conversion matches the intent.");
+
+      constexpr bool __throw_on_out_of_bounds = (is_same_v<_Flags, __detail::_Throw> or ...);
+      constexpr bool __allow_out_of_bounds
+        = (__throw_on_out_of_bounds or ... or is_same_v<_Flags, __detail::_AllowPartialLoadStore>);
+
+      const auto* __ptr = ranges::data(__r);
+      const auto __rg_size = ranges::size(__r);
+      const _Mp __in_bounds = __detail::__index_in_bounds<_Mp>(__idx, __rg_size);
+
+      if constexpr (not __allow_out_of_bounds)
+        __glibcxx_simd_precondition(
+          all_of(__in_bounds or not __k),
+          "Index out of bounds. Did you mean to use 'std::simd_partial_gather_from'?");
+
+      if constexpr (__throw_on_out_of_bounds)
+        {
+          if (not all_of(__in_bounds or not __k))
+            throw out_of_range("std::simd_gather_from: Index out of bounds.");
+        }
+
+      const _Mp __kk = __allow_out_of_bounds ? __k and __in_bounds : __k;
+      if (__builtin_is_constant_evaluated())
+        return _RV([&](int __i) {
+                 return __kk[__i] ? static_cast<_Rp>(__r[__idx[__i]]) : _Rp();
+               });
+      else if constexpr (requires {
+                           _RV::_Impl::_S_masked_gather(__data(_RV()), __data(__kk), __ptr,
+                                                        __data(__idx));
+                         })
+        return _RV(__detail::__private_init,
+                   _RV::_Impl::_S_masked_gather(__data(_RV()), __data(__kk), __ptr, __data(__idx)));
+      else
+        return _RV([&](int __i) {
+                 return __kk[__i] ? static_cast<_Rp>(__ptr[__idx[__i]]) : _Rp();
+               });
+    }
+
+  template <class _Vp = void, __detail::__sized_contiguous_range _Rg, integral _Ip,
+            typename _IAbi, typename... _Flags>
+    _GLIBCXX_SIMD_ALWAYS_INLINE
+    constexpr __detail::__simd_gather_return_t<_Vp, ranges::range_value_t<_Rg>,
+                                               basic_simd<_Ip, _IAbi>>
+    simd_gather_from(_Rg&& __r, const basic_simd<_Ip, _IAbi>& __idx,
+                     simd_flags<_Flags...> __f = {})
+    {
+      using _RV = __detail::__simd_gather_return_t<_Vp, ranges::range_value_t<_Rg>,
+                                                   basic_simd<_Ip, _IAbi>>;
+      using _Rp = typename _RV::value_type;
+      constexpr bool __allow_out_of_bounds
+        = (... or (is_same_v<_Flags, __detail::_Throw>
+                     or is_same_v<_Flags, __detail::_AllowPartialLoadStore>));
+
+      if constexpr (__allow_out_of_bounds)
+        return simd_gather_from<_RV>(__r, __idx, typename _RV::mask_type(true), __f);
+      else
+        {
+          static_assert(__detail::__loadstore_convertible_to<
+                          ranges::range_value_t<_Rg>, _Rp, _Flags...>,
+                        "The converting gather is not value-preserving. "
+                        "Pass 'std::simd_flag_convert' if lossy conversion matches the intent.");
+
+          const auto* __ptr = ranges::data(__r);
+          __glibcxx_simd_precondition(
+            all_of(__detail::__index_in_bounds<typename basic_simd<_Ip, _IAbi>::mask_type>(
+                     __idx, ranges::size(__r))),
+            "Index out of bounds. Did you mean to use 'std::simd_partial_gather_from'?");
+
+          constexpr __detail::__canonical_vec_type_t<_Rp>* __type_tag = nullptr;
+          if (__builtin_is_constant_evaluated())
+            return _RV([&](int __i) { return static_cast<_Rp>(__r[__idx[__i]]); });
+          else if constexpr (requires {
+                               _RV::_Impl::_S_gather(__ptr, __data(__idx), __type_tag);
+                             })
+            return _RV(__detail::__private_init,
+                       _RV::_Impl::_S_gather(__ptr, __data(__idx), __type_tag));
+          else
+            return _RV([&](int __i) { return static_cast<_Rp>(__ptr[__idx[__i]]); });
+        }
+    }
+
+  template <class _Vp = void, __detail::__sized_contiguous_range _Rg, integral _Ip,
+            typename _IAbi, typename... _Flags>
+    _GLIBCXX_SIMD_ALWAYS_INLINE
+    constexpr __detail::__simd_gather_return_t<_Vp, ranges::range_value_t<_Rg>,
+                                               basic_simd<_Ip, _IAbi>>
+    simd_partial_gather_from(_Rg&& __r, const basic_simd<_Ip, _IAbi>& __idx,
+                             simd_flags<_Flags...> __f = {})
+    { return simd_gather_from<_Vp>(__r, __idx, __f | __allow_partial_loadstore); }
+
+  template <class _Vp = void, __detail::__sized_contiguous_range _Rg, integral _Ip,
+            typename _IAbi, typename... _Flags>
+    _GLIBCXX_SIMD_ALWAYS_INLINE
+    constexpr __detail::__simd_gather_return_t<_Vp, ranges::range_value_t<_Rg>,
+                                               basic_simd<_Ip, _IAbi>>
+    simd_partial_gather_from(_Rg&& __r, const basic_simd<_Ip, _IAbi>& __idx,
+                             const __detail::__gather_mask_type_t<
+                                     _Vp, ranges::range_value_t<_Rg>, basic_simd<_Ip, _IAbi>>& __k,
+                             simd_flags<_Flags...> __f = {})
+    { return simd_gather_from<_Vp>(__r, __idx, __k, __f | __allow_partial_loadstore); }
+
+  /* Stores __v[__i] to __r[__idx[__i]] for every (selected) element __i, in order of increasing
+   * __i. Consequently, if several elements map to the same index, the one with the highest __i
+   * wins.
+   * Without __allow_partial_loadstore all indexes must be valid. With __allow_partial_loadstore
+   * elements with out-of-bounds indexes are not stored. With __flag_throw out-of-bounds indexes
+   * throw out_of_range.
+   */
+  template <typename _Tp, typename _Abi, __detail::__sized_contiguous_range _Rg, integral _Ip,
+            typename _IAbi, typename... _Flags>
+    requires indirectly_writable<ranges::iterator_t<_Rg>, _Tp>
+               and (basic_simd<_Tp, _Abi>::size() == basic_simd<_Ip, _IAbi>::size())
+    _GLIBCXX_SIMD_ALWAYS_INLINE
+    constexpr void
+    simd_scatter_to(const basic_simd<_Tp, _Abi>& __v, _Rg&& __r,
+                    const basic_simd<_Ip, _IAbi>& __idx,
+                    const typename basic_simd<_Tp, _Abi>::mask_type& __k,
+                    simd_flags<_Flags...> = {})
+    {
+      using _TV = basic_simd<_Tp, _Abi>;
+      using _Mp = typename _TV::mask_type;
+      using _Up = ranges::range_value_t<_Rg>;
+      static_assert(__detail::__loadstore_convertible_to<_Tp, _Up, _Flags...>,
+                    "The converting scatter is not value-preserving. "
+                    "Pass 'std::simd_flag_convert' if lossy conversion matches the intent.");
+
+      constexpr bool __throw_on_out_of_bounds = (is_same_v<_Flags, __detail::_Throw> or ...);
+      constexpr bool __allow_out_of_bounds
+        = (__throw_on_out_of_bounds or ... or is_same_v<_Flags, __detail::_AllowPartialLoadStore>);
+
+      auto* __ptr = ranges::data(__r);
+      const auto __rg_size = ranges::size(__r);
+      const _Mp __in_bounds = __detail::__index_in_bounds<_Mp>(__idx, __rg_size);
+
+      if constexpr (not __allow_out_of_bounds)
+        __glibcxx_simd_precondition(
+          all_of(__in_bounds or not __k),
+          "Index out of bounds. Did you mean to use 'std::simd_partial_scatter_to'?");
+
+      if constexpr (__throw_on_out_of_bounds)
+        {
+          if (not all_of(__in_bounds or not __k))
+            throw out_of_range("std::simd_scatter_to: Index out of bounds.");
+        }
+
+      const _Mp __kk = __allow_out_of_bounds ? __k and __in_bounds : __k;
+      if (__builtin_is_constant_evaluated())
+        {
+          for (int __i = 0; __i < _TV::size(); ++__i)
+            {
+              if (__kk[__i])
+                __ptr[__idx[__i]] = static_cast<_Up>(__v[__i]);
+            }
+        }
+      else if constexpr (requires {
+                           _TV::_Impl::_S_masked_scatter(__data(__v), __data(__kk), __ptr,
+                                                         __data(__idx));
+                         })
+        _TV::_Impl::_S_masked_scatter(__data(__v), __data(__kk), __ptr, __data(__idx));
+      else
+        {
+          for (int __i = 0; __i < _TV::size(); ++__i)
+            {
+              if (__kk[__i])
+                __ptr[__idx[__i]] = static_cast<_Up>(__v[__i]);
+            }
+        }
+    }
+
+  template <typename _Tp, typename _Abi, __detail::__sized_contiguous_range _Rg, integral _Ip,
+            typename _IAbi, typename... _Flags>
+    requires indirectly_writable<ranges::iterator_t<_Rg>, _Tp>
+               and (basic_simd<_Tp, _Abi>::size() == basic_simd<_Ip, _IAbi>::size())
+    _GLIBCXX_SIMD_ALWAYS_INLINE
+    constexpr void
+    simd_scatter_to(const basic_simd<_Tp, _Abi>& __v, _Rg&& __r,
+                    const basic_simd<_Ip, _IAbi>& __idx, simd_flags<_Flags...> __f = {})
+    {
+      using _TV = basic_simd<_Tp, _Abi>;
+      using _Up = ranges::range_value_t<_Rg>;
+      constexpr bool __allow_out_of_bounds
+        = (... or (is_same_v<_Flags, __detail::_Throw>
+                     or is_same_v<_Flags, __detail::_AllowPartialLoadStore>));
+
+      if constexpr (__allow_out_of_bounds)
+        simd_scatter_to(__v, __r, __idx, typename _TV::mask_type(true), __f);
+      else
+        {
+          static_assert(__detail::__loadstore_convertible_to<_Tp, _Up, _Flags...>,
+                        "The converting scatter is not value-preserving. "
+                        "Pass 'std::simd_flag_convert' if lossy conversion matches the intent.");
+
+          auto* __ptr = ranges::data(__r);
+          __glibcxx_simd_precondition(
+            all_of(__detail::__index_in_bounds<typename basic_simd<_Ip, _IAbi>::mask_type>(
+                     __idx, ranges::size(__r))),
+            "Index out of bounds. Did you mean to use 'std::simd_partial_scatter_to'?");
+
+          if (__builtin_is_constant_evaluated())
+            {
+              for (int __i = 0; __i < _TV::size(); ++__i)
+                __ptr[__idx[__i]] = static_cast<_Up>(__v[__i]);
+            }
+          else if constexpr (requires {
+                               _TV::_Impl::_S_scatter(__data(__v), __ptr, __data(__idx));
+                             })
+            _TV::_Impl::_S_scatter(__data(__v), __ptr, __data(__idx));
+          else
+            {
+              for (int __i = 0; __i < _TV::size(); ++__i)
+                __ptr[__idx[__i]] = static_cast<_Up>(__v[__i]);
+            }
+        }
+    }
+
+  template <typename _Tp, typename _Abi, __detail::__sized_contiguous_range _Rg, integral _Ip,
+            typename _IAbi, typename... _Flags>
+    requires indirectly_writable<ranges::iterator_t<_Rg>, _Tp>
+               and (basic_simd<_Tp, _Abi>::size() == basic_simd<_Ip, _IAbi>::size())
+    _GLIBCXX_SIMD_ALWAYS_INLINE
+    constexpr void
+    simd_partial_scatter_to(const basic_simd<_Tp, _Abi>& __v, _Rg&& __r,
+                            const basic_simd<_Ip, _IAbi>& __idx, simd_flags<_Flags...> __f = {})
+    { simd_scatter_to(__v, __r, __idx, __f | __allow_partial_loadstore); }
+
+  template <typename _Tp, typename _Abi, __detail::__sized_contiguous_range _Rg, integral _Ip,
+            typename _IAbi, typename... _Flags>
+    requires indirectly_writable<ranges::iterator_t<_Rg>, _Tp>
+               and (basic_simd<_Tp, _Abi>::size() == basic_simd<_Ip, _IAbi>::size())
+    _GLIBCXX_SIMD_ALWAYS_INLINE
+    constexpr void
+    simd_partial_scatter_to(const basic_simd<_Tp, _Abi>& __v, _Rg&& __r,
+                            const basic_simd<_Ip, _IAbi>& __idx,
+                            const typename basic_simd<_Tp, _Abi>::mask_type& __k,
+                            simd_flags<_Flags...> __f = {})
+    { simd_scatter_to(__v, __r, __idx, __k, __f | __allow_partial_loadstore); }
 }
 #endif  // SIMD_LOADSTORE_H_
@@ -10,6 +10,8 @@
 #include "simd_reductions.h"
 #include "x86_detail.h"
 
+#include <optional>
+
 namespace std
 {
   template <size_t _Bs, typename _Abi>
@@ -218,6 +220,247 @@ namespace std
                  _Abi::_MaskImpl::_S_to_bits(__data(__k))._M_sanitized()._M_to_bits());
     }
 
+  namespace __detail
+  {
+    /**
+     * @internal
+     * Returns the elements of \p __k as bits in 64-bit words (element \c i at bit <tt>i % 64</tt>
+     * of word <tt>i / 64</tt>). Masks of more than 64 elements can only be _AbiArray masks. Those
+     * are converted per chunk, so that no mask is ever converted element by element.
+     */
+    template <size_t _Bs, typename _Abi>
+      _GLIBCXX_SIMD_INTRINSIC constexpr auto
+      __mask_to_words(const basic_simd_mask<_Bs, _Abi>& __k)
+      {
+        constexpr int __size = basic_simd_mask<_Bs, _Abi>::size.value;
+        constexpr int __word_bits = __CHAR_BIT__ * sizeof(0ULL);
+        array<unsigned long long, __div_roundup(__size, __word_bits)> __r = {};
+        if constexpr (__size <= __word_bits)
+          __r[0] = __k.to_ullong();
+        else
+          {
+            using _Impl0 = typename _Abi::_Abi0Type::_MaskImpl;
+            constexpr int __chunk = _Abi::_Abi0Type::_S_size;
+            static_assert(__chunk <= __word_bits);
+            for (int __i = 0; __i < _Abi::_S_abiarray_size; ++__i)
+              {
+                const unsigned long long __bits
+                  = _Impl0::_S_to_bits(__data(__k)[__i])._M_sanitized()._M_to_bits();
+                const int __pos = __i * __chunk;
+                const int __shift = __pos % __word_bits;
+                __r[__pos / __word_bits] |= __bits << __shift;
+                if (__shift + __chunk > __word_bits)
+                  __r[__pos / __word_bits + 1] |= __bits >> (__word_bits - __shift);
+              }
+          }
+        return __r;
+      }
+
+    /**
+     * @internal
+     * Forward iterator over the indices of the set bits in _Nw words. Increment clears the lowest
+     * set bit (blsr) and dereference counts trailing zeros (tzcnt).
+     */
+    template <int _Nw>
+      class _SetIndexIterator
+      {
+        static constexpr int _S_word_bits = __CHAR_BIT__ * sizeof(0ULL);
+
+        array<unsigned long long, _Nw> _M_words = {};
+
+        int _M_word = _Nw;
+
+        // establish the invariant: _M_word == _Nw or _M_words[_M_word] != 0
+        constexpr void
+        _M_skip_empty_words()
+        {
+          while (_M_word < _Nw and _M_words[_M_word] == 0)
+            ++_M_word;
+        }
+
+      public:
+        using iterator_concept = forward_iterator_tag;
+
+        using value_type = _SimdSizeType;
+
+        using difference_type = ptrdiff_t;
+
+        constexpr _SetIndexIterator() = default;
+
+        constexpr explicit
+        _SetIndexIterator(const array<unsigned long long, _Nw>& __words)
+        : _M_words(__words), _M_word(0)
+        { _M_skip_empty_words(); }
+
+        constexpr value_type
+        operator*() const
+        { return _M_word * _S_word_bits + __builtin_ctzll(_M_words[_M_word]); }
+
+        constexpr _SetIndexIterator&
+        operator++()
+        {
+          _M_words[_M_word] &= _M_words[_M_word] - 1;
+          _M_skip_empty_words();
+          return *this;
+        }
+
+        constexpr _SetIndexIterator
+        operator++(int)
+        {
+          _SetIndexIterator __tmp = *this;
+          ++*this;
+          return __tmp;
+        }
+
+        friend constexpr bool
+        operator==(const _SetIndexIterator& __a, const _SetIndexIterator& __b)
+        {
+          return __a._M_word == __b._M_word
+                   and (__a._M_word == _Nw or __a._M_words[__a._M_word] == __b._M_words[__b._M_word]);
+        }
+
+        friend constexpr bool
+        operator==(const _SetIndexIterator& __it, default_sentinel_t)
+        { return __it._M_word == _Nw; }
+      };
+
+    template <int _Nw>
+      class _SetIndexView : public ranges::view_interface<_SetIndexView<_Nw>>
+      {
+        array<unsigned long long, _Nw> _M_words = {};
+
+      public:
+        constexpr _SetIndexView() = default;
+
+        constexpr explicit
+        _SetIndexView(const array<unsigned long long, _Nw>& __words)
+        : _M_words(__words)
+        {}
+
+        constexpr _SetIndexIterator<_Nw>
+        begin() const
+        { return _SetIndexIterator<_Nw>(_M_words); }
+
+        constexpr default_sentinel_t
+        end() const
+        { return default_sentinel; }
+
+        constexpr size_t
+        size() const
+        {
+          return _GLIBCXX_SIMD_INT_PACK(_Nw, _Is, {
+                   return (0 + ... + __builtin_popcountll(_M_words[_Is]));
+                 });
+        }
+      };
+  }
+
+  /**
+   * Returns the index of the first \c true element of \p __k, or nullopt if none_of(__k).
+   *
+   * Unlike any_of followed by reduce_min_index, the mask is converted to bits once and the test
+   * for zero reuses the flags of that conversion (ptest/kortest + tzcnt).
+   */
+  template <size_t _Bs, typename _Abi>
+    _GLIBCXX_SIMD_ALWAYS_INLINE constexpr optional<__detail::_SimdSizeType>
+    reduce_min_index_opt(const basic_simd_mask<_Bs, _Abi>& __k) noexcept
+    {
+      constexpr int __size = basic_simd_mask<_Bs, _Abi>::size.value;
+      if constexpr (__size == 1)
+        return __data(__k) ? optional<__detail::_SimdSizeType>(0) : nullopt;
+
+      else if (__builtin_is_constant_evaluated() or __k._M_is_constprop())
+        {
+          for (int __i = 0; __i < __size; ++__i)
+            if (__k[__i])
+              return __i;
+          return nullopt;
+        }
+
+      else if constexpr (__size <= __CHAR_BIT__ * sizeof(0ULL))
+        {
+          const auto __bits = _Abi::_MaskImpl::_S_to_bits(__data(__k))._M_sanitized()._M_to_bits();
+          if (__bits == 0)
+            return nullopt;
+          return __detail::__lowest_bit(__bits);
+        }
+
+      else
+        {
+          const auto __words = __detail::__mask_to_words(__k);
+          for (int __w = 0; __w < int(__words.size()); ++__w)
+            if (__words[__w] != 0)
+              return __w * __CHAR_BIT__ * int(sizeof(0ULL)) + __detail::__lowest_bit(__words[__w]);
+          return nullopt;
+        }
+    }
+
+  /**
+   * Returns the index of the last \c true element of \p __k, or nullopt if none_of(__k).
+   */
+  template <size_t _Bs, typename _Abi>
+    _GLIBCXX_SIMD_ALWAYS_INLINE constexpr optional<__detail::_SimdSizeType>
+    reduce_max_index_opt(const basic_simd_mask<_Bs, _Abi>& __k) noexcept
+    {
+      constexpr int __size = basic_simd_mask<_Bs, _Abi>::size.value;
+      if constexpr (__size == 1)
+        return __data(__k) ? optional<__detail::_SimdSizeType>(0) : nullopt;
+
+      else if (__builtin_is_constant_evaluated() or __k._M_is_constprop())
+        {
+          for (int __i = __size - 1; __i >= 0; --__i)
+            if (__k[__i])
+              return __i;
+          return nullopt;
+        }
+
+      else if constexpr (__size <= __CHAR_BIT__ * sizeof(0ULL))
+        {
+          const auto __bits = _Abi::_MaskImpl::_S_to_bits(__data(__k))._M_sanitized()._M_to_bits();
+          if (__bits == 0)
+            return nullopt;
+          return __detail::__highest_bit(__bits);
+        }
+
+      else
+        {
+          const auto __words = __detail::__mask_to_words(__k);
+          for (int __w = int(__words.size()) - 1; __w >= 0; --__w)
+            if (__words[__w] != 0)
+              return __w * __CHAR_BIT__ * int(sizeof(0ULL)) + __detail::__highest_bit(__words[__w]);
+          return nullopt;
+        }
+    }
+
+  /**
+   * Calls \p __f with the index of every \c true element of \p __k, in ascending order.
+   *
+   * The mask is converted to bits once (movmsk/kmov); the loop then only visits set elements.
+   */
+  template <size_t _Bs, typename _Abi, typename _Fp>
+    requires invocable<_Fp&, __detail::_SimdSizeType>
+    _GLIBCXX_SIMD_ALWAYS_INLINE constexpr void
+    for_each_set_index(const basic_simd_mask<_Bs, _Abi>& __k, _Fp&& __f)
+    {
+      constexpr int __word_bits = __CHAR_BIT__ * sizeof(0ULL);
+      const auto __words = __detail::__mask_to_words(__k);
+      for (int __w = 0; __w < int(__words.size()); ++__w)
+        for (unsigned long long __bits = __words[__w]; __bits != 0; __bits &= __bits - 1)
+          __f(__detail::_SimdSizeType(__w * __word_bits + __builtin_ctzll(__bits)));
+    }
+
+  /**
+   * Returns a forward range of the indices of all \c true elements of \p __k, in ascending
+   * order.
+   */
+  template <size_t _Bs, typename _Abi>
+    _GLIBCXX_SIMD_ALWAYS_INLINE constexpr auto
+    set_indices(const basic_simd_mask<_Bs, _Abi>& __k)
+    {
+      const auto __words = __detail::__mask_to_words(__k);
+      return __detail::_SetIndexView<tuple_size_v<decltype(__words)>>(__words);
+    }
+
   _GLIBCXX_SIMD_ALWAYS_INLINE constexpr bool
   all_of(same_as<bool> auto __x) noexcept
   { return __x; }
@@ -247,5 +490,26 @@ namespace std
     __glibcxx_simd_precondition(__x, "any_of(x) must be true");
     return 0;
   }
+
+  _GLIBCXX_SIMD_ALWAYS_INLINE constexpr optional<__detail::_SimdSizeType>
+  reduce_min_index_opt(same_as<bool> auto __x) noexcept
+  { return __x ? optional<__detail::_SimdSizeType>(0) : nullopt; }
+
+  _GLIBCXX_SIMD_ALWAYS_INLINE constexpr optional<__detail::_SimdSizeType>
+  reduce_max_index_opt(same_as<bool> auto __x) noexcept
+  { return __x ? optional<__detail::_SimdSizeType>(0) : nullopt; }
+
+  template <typename _Fp>
+    requires invocable<_Fp&, __detail::_SimdSizeType>
+    _GLIBCXX_SIMD_ALWAYS_INLINE constexpr void
+    for_each_set_index(same_as<bool> auto __x, _Fp&& __f)
+    {
+      if (__x)
+        __f(__detail::_SimdSizeType(0));
+    }
+
+  _GLIBCXX_SIMD_ALWAYS_INLINE constexpr auto
+  set_indices(same_as<bool> auto __x)
+  { return __detail::_SetIndexView<1>({static_cast<unsigned long long>(__x)}); }
 }
 #endif  // PROTOTYPE_MASK_REDUCTIONS_H_
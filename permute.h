@@ -137,6 +137,176 @@ namespace std
                  }
              });
     }
+
+  namespace __detail
+  {
+    // Writes the elements of __v selected by __k to __out (keeping their order) and returns the
+    // number of elements written.
+    template <__simd_type _Vp, typename _Out>
+      _GLIBCXX_SIMD_ALWAYS_INLINE constexpr int
+      __compress_generic(const _Vp& __v, const typename _Vp::mask_type& __k, _Out __out)
+      {
+        int __n = 0;
+        for (int __i = 0; __i < _Vp::size(); ++__i)
+          {
+            if (__k[__i])
+              {
+                *__out = __v[__i];
+                ++__out;
+                ++__n;
+              }
+          }
+        return __n;
+      }
+  }
+
+  /**
+   * Returns the elements of __v selected by __k, moved to the front in their original order. The
+   * remaining elements are value-initialized.
+   */
+  template <__detail::__simd_type _Vp>
+    _GLIBCXX_SIMD_ALWAYS_INLINE constexpr _Vp
+    compress(const _Vp& __v, const typename _Vp::mask_type& __k)
+    {
+      using _Tp = typename _Vp::value_type;
+      if (__builtin_is_constant_evaluated())
+        {
+          array<_Tp, _Vp::size()> __buf = {};
+          __detail::__compress_generic(__v, __k, __buf.begin());
+          return _Vp([&](int __i) { return __buf[__i]; });
+        }
+      else if constexpr (requires { _Vp::_Impl::_S_compress(__data(__v), __data(__k)); })
+        return _Vp(__detail::__private_init, _Vp::_Impl::_S_compress(__data(__v), __data(__k)));
+      else if constexpr (requires { typename _Vp::abi_type::_Abi0Type; })
+        {
+          using _VPart = basic_simd<_Tp, typename _Vp::abi_type::_Abi0Type>;
+          using _MPart = typename _VPart::mask_type;
+          array<_Tp, _Vp::size()> __buf = {};
+          int __n = 0;
+          _GLIBCXX_SIMD_INT_PACK(_Vp::abi_type::_S_abiarray_size, _Is, {
+            ((__n += compress_store(_VPart(__data(__v)[_Is]),
+                                    _MPart(__detail::__private_init, __data(__k)[_Is]),
+                                    __buf.begin() + __n)), ...);
+          });
+          return simd_unchecked_load<_Vp>(__buf);
+        }
+      else
+        {
+          array<_Tp, _Vp::size()> __buf = {};
+          __detail::__compress_generic(__v, __k, __buf.begin());
+          return simd_unchecked_load<_Vp>(__buf);
+        }
+    }
+
+  /**
+   * As above, but the remaining elements are set to __fill.
+   */
+  template <__detail::__simd_type _Vp>
+    _GLIBCXX_SIMD_ALWAYS_INLINE constexpr _Vp
+    compress(const _Vp& __v, const typename _Vp::mask_type& __k,
+             const typename _Vp::value_type& __fill)
+    {
+      const int __n = reduce_count(__k);
+      return simd_select(typename _Vp::mask_type([&](int __i) { return __i < __n; }),
+                         compress(__v, __k), _Vp(__fill));
+    }
+
+  /**
+   * Inverse of compress: the elements selected by __k are taken from the front of __v (in order),
+   * the remaining elements from __original.
+   */
+  template <__detail::__simd_type _Vp>
+    _GLIBCXX_SIMD_ALWAYS_INLINE constexpr _Vp
+    expand(const _Vp& __v, const typename _Vp::mask_type& __k, const _Vp& __original = {})
+    {
+      using _Tp = typename _Vp::value_type;
+      if (__builtin_is_constant_evaluated())
+        {
+          int __n = 0;
+          return _Vp([&](int __i) { return __k[__i] ? __v[__n++] : __original[__i]; });
+        }
+      else if constexpr (requires {
+                           _Vp::_Impl::_S_expand(__data(__v), __data(__k), __data(__original));
+                         })
+        return _Vp(__detail::__private_init,
+                   _Vp::_Impl::_S_expand(__data(__v), __data(__k), __data(__original)));
+      else if constexpr (requires { typename _Vp::abi_type::_Abi0Type; })
+        {
+          using _VPart = basic_simd<_Tp, typename _Vp::abi_type::_Abi0Type>;
+          using _MPart = typename _VPart::mask_type;
+          array<_Tp, _Vp::size()> __buf;
+          simd_unchecked_store(__v, __buf);
+          _Vp __r;
+          int __n = 0;
+          _GLIBCXX_SIMD_INT_PACK(_Vp::abi_type::_S_abiarray_size, _Is, {
+            ([&] {
+              const _MPart __kp(__detail::__private_init, __data(__k)[_Is]);
+              __data(__r)[_Is]
+                = __data(expand(simd_partial_load<_VPart>(__buf.begin() + __n, __buf.end()),
+                                __kp, _VPart(__data(__original)[_Is])));
+              __n += reduce_count(__kp);
+            }(), ...);
+          });
+          return __r;
+        }
+      else
+        {
+          int __n = 0;
+          return _Vp([&](int __i) { return __k[__i] ? __v[__n++] : __original[__i]; });
+        }
+    }
+
+  /**
+   * Stores the elements of __v selected by __k contiguously to __first and returns their number.
+   * Exactly reduce_count(__k) elements are written.
+   */
+  template <typename _Tp, typename _Abi, contiguous_iterator _It, typename... _Flags>
+    requires indirectly_writable<_It, _Tp>
+    _GLIBCXX_SIMD_ALWAYS_INLINE constexpr int
+    compress_store(const basic_simd<_Tp, _Abi>& __v,
+                   const typename basic_simd<_Tp, _Abi>::mask_type& __k, _It __first,
+                   simd_flags<_Flags...> __f = {})
+    {
+      using _Vp = basic_simd<_Tp, _Abi>;
+      if (__builtin_is_constant_evaluated())
+        return __detail::__compress_generic(__v, __k, __first);
+      else if constexpr (not is_same_v<iter_value_t<_It>, _Tp>)
+        {
+          const int __n = reduce_count(__k);
+          simd_partial_store(compress(__v, __k), __first, __n, __f);
+          return __n;
+        }
+      else if constexpr (requires {
+                           _Vp::_Impl::_S_compress_store(__data(__v), __data(__k),
+                                                         std::to_address(__first));
+                         })
+        return _Vp::_Impl::_S_compress_store(__data(__v), __data(__k), std::to_address(__first));
+      else if constexpr (requires { typename _Abi::_Abi0Type; })
+        {
+          using _VPart = basic_simd<_Tp, typename _Abi::_Abi0Type>;
+          using _MPart = typename _VPart::mask_type;
+          int __n = 0;
+          _GLIBCXX_SIMD_INT_PACK(_Abi::_S_abiarray_size, _Is, {
+            ((__n += compress_store(_VPart(__data(__v)[_Is]),
+                                    _MPart(__detail::__private_init, __data(__k)[_Is]),
+                                    __first + __n)), ...);
+          });
+          return __n;
+        }
+      else
+        {
+          const int __n = reduce_count(__k);
+          simd_partial_store(compress(__v, __k), __first, __n, __f);
+          return __n;
+        }
+    }
+
+  template <typename _Tp, typename _Abi, output_iterator<const _Tp&> _It>
+    requires (not contiguous_iterator<_It>)
+    _GLIBCXX_SIMD_ALWAYS_INLINE constexpr int
+    compress_store(const basic_simd<_Tp, _Abi>& __v,
+                   const typename basic_simd<_Tp, _Abi>::mask_type& __k, _It __first)
+    { return __detail::__compress_generic(__v, __k, __first); }
 }
 
 #endif  // PROTOTYPE_PERMUTE_H_
@@ -164,8 +164,7 @@ namespace std
       template <__detail::__static_sized_range<size.value> _Rg, typename... _Flags>
         constexpr // implicit!
         basic_simd(_Rg&& __range, simd_flags<_Flags...> __flags = {})
-        : _M_data(_Impl::_S_load(__flags.template _S_adjust_pointer<basic_simd>(
-                                   std::ranges::data(__range)), _S_type_tag))
+        : _M_data(__data(std::simd_unchecked_load<basic_simd>(__range, __flags)))
         {
           static_assert(__detail::__loadstore_convertible_to<std::ranges::range_value_t<_Rg>,
                                                              value_type, _Flags...>);
@@ -393,6 +393,11 @@ namespace std
           _S_load(const _Up* __mem, _TypeTag<_Tp> __tag) noexcept
           { return {_Impl0::_S_load(__mem + _Is * _S_chunk_size, __tag)...}; }
 
+        template <__vectorizable_canon _Tp, typename _Up>
+          _GLIBCXX_SIMD_INTRINSIC static constexpr _SimdMember<_Tp>
+          _S_stream_load(const _Up* __mem, _TypeTag<_Tp> __tag) noexcept
+          { return {_Impl0::_S_stream_load(__mem + _Is * _S_chunk_size, __tag)...}; }
+
         template <__vectorizable_canon _Tp, typename _Up>
           _GLIBCXX_SIMD_INTRINSIC static _SimdMember<_Tp>
           _S_partial_load(const _Up* __mem, size_t __mem_size, _TypeTag<_Tp> __tag)
@@ -413,7 +418,7 @@ namespace std
           }
 
         template <typename _Tp, typename _Up>
-          static constexpr inline _Tp
+          static constexpr inline _SimdMember<_Tp>
           _S_masked_load(_MaskMember<_Tp> const& __k, const _Up* __mem, _TypeTag<_Tp> __tag)
           { return {_Impl0::_S_masked_load(__k[_Is], __mem + _Is * _S_chunk_size, __tag)...}; }
 
@@ -432,6 +437,12 @@ namespace std
           _S_store(const array<_TV, _Np>& __v, _Up* __mem, _TypeTag<__value_type_of<_TV>> __tag) noexcept
           { (_Impl0::_S_store(__v[_Is], __mem + _Is * _S_chunk_size, __tag), ...); }
 
+        template <__vec_builtin _TV, typename _Up>
+          _GLIBCXX_SIMD_INTRINSIC static constexpr void
+          _S_stream_store(const array<_TV, _Np>& __v, _Up* __mem,
+                          _TypeTag<__value_type_of<_TV>> __tag) noexcept
+          { (_Impl0::_S_stream_store(__v[_Is], __mem + _Is * _S_chunk_size, __tag), ...); }
+
         template <__vec_builtin _TV, typename _Up>
           _GLIBCXX_SIMD_INTRINSIC static constexpr void
           _S_partial_store(const array<_TV, _Np>& __v, _Up* __mem, size_t __mem_size,
@@ -488,6 +499,56 @@ namespace std
           _S_modulus(_Tp const& __x, _Tp const& __y) noexcept
           { return {_Impl0::_S_modulus(__x[_Is], __y[_Is])...}; }
 
+        template <typename _Tp>
+          _GLIBCXX_SIMD_INTRINSIC static constexpr _Tp
+          _S_mulhi(_Tp const& __x, _Tp const& __y) noexcept
+          { return {_Impl0::_S_mulhi(__x[_Is], __y[_Is])...}; }
+
+        template <typename _Tp>
+          _GLIBCXX_SIMD_INTRINSIC static constexpr _Tp
+          _S_complex_multiplies(_Tp const& __x, _Tp const& __y) noexcept
+          { return {_Impl0::_S_complex_multiplies(__x[_Is], __y[_Is])...}; }
+
+        template <typename _Tp>
+          _GLIBCXX_SIMD_INTRINSIC static constexpr _Tp
+          _S_bit_popcount(_Tp const& __x) noexcept
+          { return {_Impl0::_S_bit_popcount(__x[_Is])...}; }
+
+        template <typename _Tp>
+          _GLIBCXX_SIMD_INTRINSIC static constexpr _Tp
+          _S_countl_zero(_Tp const& __x) noexcept
+          { return {_Impl0::_S_countl_zero(__x[_Is])...}; }
+
+        template <typename _Tp>
+          _GLIBCXX_SIMD_INTRINSIC static constexpr _Tp
+          _S_countr_zero(_Tp const& __x) noexcept
+          { return {_Impl0::_S_countr_zero(__x[_Is])...}; }
+
+        template <typename _Tp>
+          _GLIBCXX_SIMD_INTRINSIC static constexpr _Tp
+          _S_byteswap(_Tp const& __x) noexcept
+          { return {_Impl0::_S_byteswap(__x[_Is])...}; }
+
+        template <typename _Tp>
+          _GLIBCXX_SIMD_INTRINSIC static constexpr _Tp
+          _S_rotl(_Tp const& __x, _Tp const& __y) noexcept
+          { return {_Impl0::_S_rotl(__x[_Is], __y[_Is])...}; }
+
+        template <typename _Tp>
+          _GLIBCXX_SIMD_INTRINSIC static constexpr _Tp
+          _S_rotl(_Tp const& __x, int __y) noexcept
+          { return {_Impl0::_S_rotl(__x[_Is], __y)...}; }
+
+        template <typename _Tp>
+          _GLIBCXX_SIMD_INTRINSIC static constexpr _Tp
+          _S_rotr(_Tp const& __x, _Tp const& __y) noexcept
+          { return {_Impl0::_S_rotr(__x[_Is], __y[_Is])...}; }
+
+        template <typename _Tp>
+          _GLIBCXX_SIMD_INTRINSIC static constexpr _Tp
+          _S_rotr(_Tp const& __x, int __y) noexcept
+          { return {_Impl0::_S_rotr(__x[_Is], __y)...}; }
+
         template <typename _Tp>
           _GLIBCXX_SIMD_INTRINSIC static constexpr _Tp
           _S_bit_and(_Tp const& __x, _Tp const& __y) noexcept
@@ -631,27 +692,32 @@ namespace std
           _S_reduce(basic_simd<_Tp, abi_type> __xx, const _BinaryOperation& __binary_op)
           {
             auto& __x = __data(__xx); // the array was copied by the caller - we're not changing it
-            (((_Is % 2) == 1 ? (__x[_Is - 1] = __binary_op(__x[_Is - 1], __x[_Is])) : __x[0]), ...);
+            // __binary_op is only required to be invocable with basic_simd
+            using _V0 = basic_simd<_Tp, _Abi0>;
+            auto __op = [&] [[__gnu__::__always_inline__]] (const auto& __a, const auto& __b) {
+              return __data(__binary_op(_V0(__private_init, __a), _V0(__private_init, __b)));
+            };
+            (((_Is % 2) == 1 ? (__x[_Is - 1] = __op(__x[_Is - 1], __x[_Is])) : __x[0]), ...);
             if constexpr (_Np > 2)
-              (((_Is % 4) == 2 ? (__x[_Is - 2] = __binary_op(__x[_Is - 2], __x[_Is])) : __x[0]),
+              (((_Is % 4) == 2 ? (__x[_Is - 2] = __op(__x[_Is - 2], __x[_Is])) : __x[0]),
                ...);
             if constexpr (_Np > 4)
-              (((_Is % 8) == 4 ? (__x[_Is - 4] = __binary_op(__x[_Is - 4], __x[_Is])) : __x[0]),
+              (((_Is % 8) == 4 ? (__x[_Is - 4] = __op(__x[_Is - 4], __x[_Is])) : __x[0]),
                ...);
             if constexpr (_Np > 8)
-              (((_Is % 16) == 8 ? (__x[_Is - 8] = __binary_op(__x[_Is - 8], __x[_Is])) : __x[0]),
+              (((_Is % 16) == 8 ? (__x[_Is - 8] = __op(__x[_Is - 8], __x[_Is])) : __x[0]),
                ...);
             if constexpr (_Np > 16)
-              (((_Is % 32) == 16 ? (__x[_Is - 16] = __binary_op(__x[_Is - 16], __x[_Is])) : __x[0]),
+              (((_Is % 32) == 16 ? (__x[_Is - 16] = __op(__x[_Is - 16], __x[_Is])) : __x[0]),
                ...);
             if constexpr (_Np > 32)
-              (((_Is % 64) == 32 ? (__x[_Is - 32] = __binary_op(__x[_Is - 32], __x[_Is])) : __x[0]),
+              (((_Is % 64) == 32 ? (__x[_Is - 32] = __op(__x[_Is - 32], __x[_Is])) : __x[0]),
                ...);
             if constexpr (_Np > 64)
-              (((_Is % 128) == 64 ? (__x[_Is - 64] = __binary_op(__x[_Is - 64], __x[_Is]))
+              (((_Is % 128) == 64 ? (__x[_Is - 64] = __op(__x[_Is - 64], __x[_Is]))
                                   : __x[0]), ...);
             static_assert(_Np <= 128);
-            return std::reduce(basic_simd<_Tp, _Abi0>(__private_init, __x[0]), __binary_op);
+            return std::reduce(_V0(__private_init, __x[0]), __binary_op);
           }
 
         template <typename _Tp>
@@ -1325,6 +1391,16 @@ namespace std
                      });
           }
 
+        template <typename _Tp, typename _Up>
+          _GLIBCXX_SIMD_INTRINSIC static constexpr _SimdMember<_Tp>
+          _S_stream_load(const _Up* __mem, _TypeTag<_Tp>)
+          {
+            return _SimdMember<_Tp>::_S_forall(
+                     [&] [[__gnu__::__always_inline__]] (auto __meta, auto& __chunk) {
+                       __chunk = __meta._S_stream_load(__mem + __meta._S_offset, _TypeTag<_Tp>());
+                     });
+          }
+
         template <__vectorizable_canon _Tp, typename _Up>
           _GLIBCXX_SIMD_INTRINSIC static _SimdMember<_Tp>
           _S_partial_load(const _Up* __mem, size_t __mem_size, _TypeTag<_Tp> __tag)
@@ -1387,6 +1463,15 @@ namespace std
             });
           }
 
+        template <typename _Tp, typename _Up>
+          _GLIBCXX_SIMD_INTRINSIC static constexpr void
+          _S_stream_store(const _SimdMember<_Tp>& __v, _Up* __mem, _TypeTag<_Tp>)
+          {
+            __v._M_forall([&] [[__gnu__::__always_inline__]] (auto __meta, auto __chunk) {
+              __meta._S_stream_store(__chunk, __mem + __meta._S_offset, _TypeTag<_Tp>());
+            });
+          }
+
         template <typename _Tp, typename _Up>
           _GLIBCXX_SIMD_INTRINSIC static constexpr void
           _S_partial_store(const _SimdMember<_Tp>& __v, _Up* __mem, size_t __mem_size,
@@ -1579,6 +1664,23 @@ namespace std
                    });
           }
 
+#define _GLIBCXX_SIMD_FIXED_UNARY_OP(name_)                                                       \
+        template <typename _Tp, typename... _As>                                                  \
+          _GLIBCXX_SIMD_INTRINSIC static constexpr _SimdTuple<_Tp, _As...>                        \
+          name_(_SimdTuple<_Tp, _As...> __x) noexcept                                             \
+          {                                                                                       \
+            return __x._M_forall([] [[__gnu__::__always_inline__]] (auto __meta, auto& __xx) {    \
+                     __xx = __meta.name_(__xx);                                                   \
+                   });                                                                            \
+          }
+
+        _GLIBCXX_SIMD_FIXED_UNARY_OP(_S_bit_popcount)
+        _GLIBCXX_SIMD_FIXED_UNARY_OP(_S_countl_zero)
+        _GLIBCXX_SIMD_FIXED_UNARY_OP(_S_countr_zero)
+        _GLIBCXX_SIMD_FIXED_UNARY_OP(_S_byteswap)
+
+#undef _GLIBCXX_SIMD_FIXED_UNARY_OP
+
 #define _GLIBCXX_SIMD_FIXED_OP(name_)                                                             \
         template <typename _Tp, typename... _As>                                                  \
           _GLIBCXX_SIMD_INTRINSIC static constexpr _SimdTuple<_Tp, _As...>                        \
@@ -1595,11 +1697,15 @@ namespace std
         _GLIBCXX_SIMD_FIXED_OP(_S_multiplies)
         _GLIBCXX_SIMD_FIXED_OP(_S_divides)
         _GLIBCXX_SIMD_FIXED_OP(_S_modulus)
+        _GLIBCXX_SIMD_FIXED_OP(_S_mulhi)
+        _GLIBCXX_SIMD_FIXED_OP(_S_complex_multiplies)
         _GLIBCXX_SIMD_FIXED_OP(_S_bit_and)
         _GLIBCXX_SIMD_FIXED_OP(_S_bit_or)
         _GLIBCXX_SIMD_FIXED_OP(_S_bit_xor)
         _GLIBCXX_SIMD_FIXED_OP(_S_bit_shift_left)
         _GLIBCXX_SIMD_FIXED_OP(_S_bit_shift_right)
+        _GLIBCXX_SIMD_FIXED_OP(_S_rotl)
+        _GLIBCXX_SIMD_FIXED_OP(_S_rotr)
 
 #undef _GLIBCXX_SIMD_FIXED_OP
 
@@ -1621,6 +1727,24 @@ namespace std
                    });
           }
 
+        template <typename _Tp, typename... _As>
+          _GLIBCXX_SIMD_INTRINSIC static constexpr _SimdTuple<_Tp, _As...>
+          _S_rotl(_SimdTuple<_Tp, _As...> __x, int __y)
+          {
+            return __x._M_forall([__y] [[__gnu__::__always_inline__]] (auto __impl, auto& __xx) {
+                     __xx = __impl._S_rotl(__xx, __y);
+                   });
+          }
+
+        template <typename _Tp, typename... _As>
+          _GLIBCXX_SIMD_INTRINSIC static constexpr _SimdTuple<_Tp, _As...>
+          _S_rotr(_SimdTuple<_Tp, _As...> __x, int __y)
+          {
+            return __x._M_forall([__y] [[__gnu__::__always_inline__]] (auto __impl, auto& __xx) {
+                     __xx = __impl._S_rotr(__xx, __y);
+                   });
+          }
+
 #if 0
 #define _GLIBCXX_SIMD_APPLY_ON_TUPLE(_RetTp, __name)                                               \
         template <typename _Tp, typename... _As, typename... _More>                                \
@@ -1981,6 +2105,8 @@ namespace std
             __glibcxx_simd_precondition(__n < _Np, "");
             if constexpr (_Np <= 65 and _Flags._M_have_bmi2())
               return _MaskMember::__create_unchecked(__builtin_ia32_bzhi_di(~0ull, __n));
+            else
+              return _MaskMember::__create_unchecked((1ull << __n) - 1);
           }
       };
 
@@ -0,0 +1,648 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later WITH GCC-exception-3.1 */
+/* Copyright © 2025      GSI Helmholtzzentrum fuer Schwerionenforschung GmbH
+ *                       Matthias Kretz <m.kretz@gsi.de>
+ */
+
+#ifndef PROTOTYPE_SIMD_ALGORITHM_H_
+#define PROTOTYPE_SIMD_ALGORITHM_H_
+
+#include "simd.h"
+#include "simd_alg.h"
+#include "simd_reductions.h"
+#include "mask_reductions.h"
+
+#include <algorithm>
+#include <array>
+#include <functional>
+
+// Algorithms over contiguous ranges. The range is processed in chunks of _Vp (default:
+// simd<range_value_t<_Rg>>). The callables are invoked with _Vp objects and must therefore be
+// generic (or accept _Vp). Head and tail chunks are loaded with simd_partial_load; the lanes past
+// the end of the range are value-initialized and never stored.
+
+namespace std
+{
+  namespace __detail
+  {
+    /**
+     * The default number of chunks processed per iteration of the main loop.
+     */
+    inline constexpr int __simd_alg_unroll = 4;
+
+    enum class _ReductionOrder { _Reassociated, _Reproducible, _Ordered };
+
+    template <_ReductionOrder _Order>
+      using _ReductionOrderTag = integral_constant<_ReductionOrder, _Order>;
+
+    /**
+     * Returns a mask where the first __n elements are true. Precondition: __n < _Vp::size().
+     */
+    template <typename _Vp>
+      _GLIBCXX_SIMD_ALWAYS_INLINE constexpr typename _Vp::mask_type
+      __mask_with_n_true(size_t __n)
+      {
+        using _Mp = typename _Vp::mask_type;
+        using _Ip = __mask_integer_from<sizeof(typename _Vp::value_type)>;
+        if (__builtin_is_constant_evaluated())
+          return _Mp([&](size_t __i) { return __i < __n; });
+        else
+          return {__private_init, _Mp::_Impl::template _S_mask_with_n_true<_Ip>(__n)};
+      }
+
+    /**
+     * Invokes __f with __args and returns its result, or false if __f returns void.
+     */
+    template <typename _Fp, typename... _Args>
+      _GLIBCXX_SIMD_ALWAYS_INLINE constexpr bool
+      __invoke_chunk(_Fp& __f, const _Args&... __args)
+      {
+        if constexpr (is_void_v<decltype(__f(__args...))>)
+          {
+            __f(__args...);
+            return false;
+          }
+        else
+          return __f(__args...);
+      }
+
+    /**
+     * Splits [0, __n) into chunks of _Vp::size() elements.
+     *
+     * __full(__j, __i, __flags) is called for every full chunk starting at __i, where __j
+     * (an _Ic in [0, _Unroll)) identifies the position in the unrolled main loop.
+     * __partial(__i, __len) is called for the tail and, if a head was peeled, for the head
+     * (0 < __len < _Vp::size()).
+     *
+     * If _Peel is true, the range is long enough, and __align_ptr can be aligned, a head is peeled
+     * off such that
+     * all full chunks start at an address aligned to simd_alignment_v<_Vp, _Up> relative to
+     * __align_ptr. In that case __flags is simd_flag_aligned, otherwise simd_flag_default.
+     *
+     * If a callback returns true the iteration stops and true is returned.
+     */
+    template <typename _Vp, int _Unroll = __simd_alg_unroll, bool _Peel = true, typename _Up,
+              typename _Partial, typename _Full>
+      _GLIBCXX_SIMD_ALWAYS_INLINE constexpr bool
+      __for_each_chunk(const _Up* __align_ptr, size_t __n, _Partial&& __partial, _Full&& __full)
+      {
+        constexpr size_t __size = _Vp::size();
+        constexpr size_t __unrolled = _Unroll * __size;
+        constexpr size_t __alignment = simd_alignment_v<_Vp, _Up>;
+
+        auto __loop = [&] [[__gnu__::__always_inline__]] (size_t __i, auto __flags) {
+          for (; __i + __unrolled <= __n; __i += __unrolled)
+            {
+              const bool __stop = _GLIBCXX_SIMD_INT_PACK(_Unroll, _Js, {
+                                    return (__invoke_chunk(__full, __ic<_Js>, __i + _Js * __size,
+                                                           __flags) or ...);
+                                  });
+              if (__stop)
+                return true;
+            }
+          for (; __i + __size <= __n; __i += __size)
+            if (__invoke_chunk(__full, __ic<0>, __i, __flags))
+              return true;
+          return __i < __n and __invoke_chunk(__partial, __i, __n - __i);
+        };
+
+        if constexpr (_Peel and __size * sizeof(_Up) % __alignment == 0
+                        and __alignment % sizeof(_Up) == 0)
+          {
+            if (not __builtin_is_constant_evaluated() and __n >= __unrolled)
+              {
+                const auto __addr = reinterpret_cast<__UINTPTR_TYPE__>(__align_ptr);
+                if (__addr % sizeof(_Up) == 0)
+                  {
+                    const size_t __peel = (-__addr % __alignment) / sizeof(_Up);
+                    if (__peel != 0 and __invoke_chunk(__partial, size_t(0), __peel))
+                      return true;
+                    return __loop(__peel, simd_flag_aligned);
+                  }
+              }
+          }
+        return __loop(0, simd_flag_default);
+      }
+
+    template <typename _Vp, typename _Rg>
+      using __simd_alg_load_t = __simd_load_return_t<_Vp, ranges::range_value_t<_Rg>>;
+  }
+
+  /**
+   * Invokes __fn with every chunk of __r. If the elements of __r are writable, the chunk is passed
+   * as a non-const lvalue and stored back after __fn returns. Pass std::as_const(__r) to avoid the
+   * store for a read-only __fn.
+   *
+   * If __fn is invocable with an additional mask argument, it is passed the mask of the lanes that
+   * lie within the range.
+   */
+  template <class _Vp = void, __detail::__sized_contiguous_range _Rg, typename _Fn>
+    constexpr _Fn
+    simd_for_each(_Rg&& __r, _Fn __fn)
+    {
+      using _Tp = ranges::range_value_t<_Rg>;
+      using _Rp = __detail::__simd_alg_load_t<_Vp, _Rg>;
+      using _Mp = typename _Rp::mask_type;
+      constexpr bool __writable = indirectly_writable<ranges::iterator_t<_Rg>, _Tp>;
+      using _Chunk = conditional_t<__writable, _Rp, const _Rp>;
+      const auto __first = ranges::begin(__r);
+
+      auto __invoke = [&] [[__gnu__::__always_inline__]] (_Chunk& __x, const _Mp& __k) {
+        if constexpr (invocable<_Fn&, _Chunk&, const _Mp&>)
+          __fn(__x, __k);
+        else
+          __fn(__x);
+      };
+
+      __detail::__for_each_chunk<_Rp>(
+        std::to_address(__first), ranges::size(__r),
+        [&] [[__gnu__::__always_inline__]] (size_t __i, size_t __len) {
+          _Chunk __x = simd_partial_load<_Rp>(__first + __i, __len);
+          __invoke(__x, __detail::__mask_with_n_true<_Rp>(__len));
+          if constexpr (__writable)
+            simd_partial_store(__x, __first + __i, __len);
+        },
+        [&] [[__gnu__::__always_inline__]] (auto, size_t __i, auto __flags) {
+          _Chunk __x = simd_unchecked_load<_Rp>(__first + __i, _Rp::size(), __flags);
+          __invoke(__x, _Mp(true));
+          if constexpr (__writable)
+            simd_unchecked_store(__x, __first + __i, _Rp::size(), __flags);
+        });
+      return __fn;
+    }
+
+  /**
+   * Stores __fn(__x) for every chunk __x of __in to __out and returns the end of the output range.
+   * __out may equal ranges::begin(__in).
+   */
+  template <class _Vp = void, __detail::__sized_contiguous_range _Rg, contiguous_iterator _Out,
+            typename _Fn>
+    constexpr _Out
+    simd_transform(_Rg&& __in, _Out __out, _Fn __fn)
+    {
+      using _Rp = __detail::__simd_alg_load_t<_Vp, _Rg>;
+      using _Up = iter_value_t<_Out>;
+      using _RV = remove_cvref_t<invoke_result_t<_Fn&, const _Rp&>>;
+      constexpr size_t __size = _Rp::size();
+      const size_t __n = ranges::size(__in);
+      const auto __first = ranges::begin(__in);
+
+      // the stores are aligned, the loads are not (unless __in and __out are equally misaligned)
+      __detail::__for_each_chunk<rebind_simd_t<_Up, _RV>>(
+        std::to_address(__out), __n,
+        [&] [[__gnu__::__always_inline__]] (size_t __i, size_t __len) {
+          simd_partial_store(__fn(simd_partial_load<_Rp>(__first + __i, __len)), __out + __i,
+                             __len);
+        },
+        [&] [[__gnu__::__always_inline__]] (auto, size_t __i, auto __flags) {
+          simd_unchecked_store(__fn(simd_unchecked_load<_Rp>(__first + __i, __size)),
+                               __out + __i, __size, __flags);
+        });
+      return __out + __n;
+    }
+
+  /**
+   * Stores __fn(__x, __y) for every pair of chunks of __in1 and __in2 to __out and returns the end
+   * of the output range.
+   *
+   * Precondition: ranges::size(__in2) >= ranges::size(__in1).
+   */
+  template <class _Vp = void, __detail::__sized_contiguous_range _Rg1,
+            __detail::__sized_contiguous_range _Rg2, contiguous_iterator _Out, typename _Fn>
+    constexpr _Out
+    simd_transform(_Rg1&& __in1, _Rg2&& __in2, _Out __out, _Fn __fn)
+    {
+      using _Rp1 = __detail::__simd_alg_load_t<_Vp, _Rg1>;
+      using _Rp2 = rebind_simd_t<ranges::range_value_t<_Rg2>, _Rp1>;
+      using _Up = iter_value_t<_Out>;
+      using _RV = remove_cvref_t<invoke_result_t<_Fn&, const _Rp1&, const _Rp2&>>;
+      constexpr size_t __size = _Rp1::size();
+      const size_t __n = ranges::size(__in1);
+      __glibcxx_simd_precondition(ranges::size(__in2) >= __n, "the second range is too small");
+      const auto __first1 = ranges::begin(__in1);
+      const auto __first2 = ranges::begin(__in2);
+
+      __detail::__for_each_chunk<rebind_simd_t<_Up, _RV>>(
+        std::to_address(__out), __n,
+        [&] [[__gnu__::__always_inline__]] (size_t __i, size_t __len) {
+          simd_partial_store(__fn(simd_partial_load<_Rp1>(__first1 + __i, __len),
+                                  simd_partial_load<_Rp2>(__first2 + __i, __len)),
+                             __out + __i, __len);
+        },
+        [&] [[__gnu__::__always_inline__]] (auto, size_t __i, auto __flags) {
+          simd_unchecked_store(__fn(simd_unchecked_load<_Rp1>(__first1 + __i, __size),
+                                    simd_unchecked_load<_Rp2>(__first2 + __i, __size)),
+                               __out + __i, __size, __flags);
+        });
+      return __out + __n;
+    }
+
+  /**
+   * Tags that select how the range reductions combine the elements:
+   *
+   * simd_reduction_reassociated (the default) uses several independent accumulators and an aligned
+   * main loop. For floating-point types the result can depend on the alignment of the range.
+   *
+   * simd_reduction_reproducible does not peel for alignment. The result depends only on the
+   * elements, _Vp, and the number of accumulators (which depends on the target).
+   *
+   * simd_reduction_ordered combines the elements strictly from left to right, as std::accumulate
+   * does. Only the loads and the transformation are vectorized.
+   */
+  inline constexpr __detail::_ReductionOrderTag<__detail::_ReductionOrder::_Reassociated>
+    simd_reduction_reassociated {};
+
+  inline constexpr __detail::_ReductionOrderTag<__detail::_ReductionOrder::_Reproducible>
+    simd_reduction_reproducible {};
+
+  inline constexpr __detail::_ReductionOrderTag<__detail::_ReductionOrder::_Ordered>
+    simd_reduction_ordered {};
+
+  namespace __detail
+  {
+    /**
+     * The number of independent accumulators for range reductions of _Vp objects with
+     * _BinaryOperation: enough to hide the latency of the operation (assuming two operations per
+     * cycle on AVX2 targets, one otherwise), limited such that all accumulators fit into
+     * registers. Cheap integer operations are bound by the load throughput instead.
+     */
+    template <typename _Vp, typename _BinaryOperation>
+      inline constexpr int __simd_reduce_accumulators = [] {
+        using _Tp = typename _Vp::value_type;
+        constexpr bool __cheap = is_integral_v<_Tp>
+                                   and (same_as<_BinaryOperation, plus<>>
+                                          or same_as<_BinaryOperation, bit_and<>>
+                                          or same_as<_BinaryOperation, bit_or<>>
+                                          or same_as<_BinaryOperation, bit_xor<>>);
+        constexpr int __parallel = __cheap ? 2 : _GLIBCXX_SIMD_HAVE_AVX2 ? 8 : 4;
+        constexpr int __regs = std::max(1, int(sizeof(_Vp) / sizeof(simd<_Tp>)));
+        return int(std::__bit_floor(unsigned(std::max(1, __parallel / __regs))));
+      }();
+
+    /**
+     * Combines the accumulators pairwise.
+     */
+    template <typename _Vp, size_t _Np, typename _BinaryOperation>
+      _GLIBCXX_SIMD_ALWAYS_INLINE constexpr _Vp
+      __combine_accumulators(const array<_Vp, _Np>& __acc, _BinaryOperation& __binary_op)
+      {
+        if constexpr (_Np == 1)
+          return __acc[0];
+        else
+          {
+            using _Half = array<_Vp, _Np / 2>;
+            return __combine_accumulators(_GLIBCXX_SIMD_INT_PACK(_Np / 2, _Is, {
+                     return _Half {__binary_op(__acc[_Is], __acc[_Is + _Np / 2])...};
+                   }), __binary_op);
+          }
+      }
+
+    template <typename _Rp, _ReductionOrder _Order, typename _Rg, typename _Tp,
+              typename _BinaryOperation, typename _Transform>
+      constexpr _Tp
+      __simd_transform_reduce(_Rg&& __r, _Tp __init, _BinaryOperation __binary_op,
+                              _Transform __transform, _Tp __identity_element)
+      {
+        using _RV = remove_cvref_t<invoke_result_t<_Transform&, const _Rp&>>;
+        using _V1 = simd<_Tp, 1>;
+        const auto __first = ranges::begin(__r);
+
+        if constexpr (_Order == _ReductionOrder::_Ordered)
+          {
+            _V1 __acc = __init;
+            auto __fold = [&] [[__gnu__::__always_inline__]] (const _RV& __y, size_t __len) {
+              for (size_t __l = 0; __l < __len; ++__l)
+                __acc = __binary_op(__acc, _V1(__y[__l]));
+            };
+            __for_each_chunk<_Rp, 1, false>(
+              std::to_address(__first), ranges::size(__r),
+              [&] [[__gnu__::__always_inline__]] (size_t __i, size_t __len) {
+                __fold(__transform(simd_partial_load<_Rp>(__first + __i, __len)), __len);
+              },
+              [&] [[__gnu__::__always_inline__]] (auto, size_t __i, auto __flags) {
+                __fold(__transform(simd_unchecked_load<_Rp>(__first + __i, _Rp::size(), __flags)),
+                       _Rp::size());
+              });
+            return __acc[0];
+          }
+        else
+          {
+            constexpr int __n_acc = __simd_reduce_accumulators<_RV, _BinaryOperation>;
+            using _Acc = array<_RV, __n_acc>;
+            _Acc __acc = _GLIBCXX_SIMD_INT_PACK(__n_acc, _Is, {
+                           return _Acc {((void)_Is, _RV(__identity_element))...};
+                         });
+
+            __for_each_chunk<_Rp, __n_acc, _Order == _ReductionOrder::_Reassociated>(
+              std::to_address(__first), ranges::size(__r),
+              [&] [[__gnu__::__always_inline__]] (size_t __i, size_t __len) {
+                const _RV __y = __transform(simd_partial_load<_Rp>(__first + __i, __len));
+                __acc[0] = __binary_op(__acc[0],
+                                       simd_select(__mask_with_n_true<_RV>(__len), __y,
+                                                   _RV(__identity_element)));
+              },
+              [&] [[__gnu__::__always_inline__]] (auto __j, size_t __i, auto __flags) {
+                __acc[__j] = __binary_op(__acc[__j], __transform(simd_unchecked_load<_Rp>(
+                                                                   __first + __i, _Rp::size(),
+                                                                   __flags)));
+              });
+
+            const _RV __sum = __combine_accumulators(__acc, __binary_op);
+            return __binary_op(_V1(__init), _V1(reduce(__sum, __binary_op)))[0];
+          }
+      }
+  }
+
+  /**
+   * Returns the reduction of __init and __transform(__x) for all chunks __x of __r with
+   * __binary_op. Except for simd_reduction_ordered, the independent accumulators are initialized
+   * with __identity_element and the operation must be associative and commutative.
+   */
+  template <class _Vp = void, __detail::_ReductionOrder _Order,
+            __detail::__sized_contiguous_range _Rg, typename _BinaryOperation, typename _Transform,
+            typename _RV = remove_cvref_t<invoke_result_t<
+                             _Transform&, const __detail::__simd_alg_load_t<_Vp, _Rg>&>>,
+            typename _Tp = typename _RV::value_type>
+    requires __detail::__binary_operation<_BinaryOperation, _Tp>
+    constexpr _Tp
+    simd_transform_reduce(__detail::_ReductionOrderTag<_Order>, _Rg&& __r,
+                          __type_identity_t<_Tp> __init, _BinaryOperation __binary_op,
+                          _Transform __transform,
+                          __type_identity_t<_Tp> __identity_element
+                            = __detail::__default_identity_element<_Tp, _BinaryOperation>())
+    {
+      return __detail::__simd_transform_reduce<__detail::__simd_alg_load_t<_Vp, _Rg>, _Order>(
+               __r, __init, __binary_op, __transform, __identity_element);
+    }
+
+  template <class _Vp = void, __detail::__sized_contiguous_range _Rg, typename _BinaryOperation,
+            typename _Transform,
+            typename _RV = remove_cvref_t<invoke_result_t<
+                             _Transform&, const __detail::__simd_alg_load_t<_Vp, _Rg>&>>,
+            typename _Tp = typename _RV::value_type>
+    requires __detail::__binary_operation<_BinaryOperation, _Tp>
+    constexpr _Tp
+    simd_transform_reduce(_Rg&& __r, __type_identity_t<_Tp> __init, _BinaryOperation __binary_op,
+                          _Transform __transform,
+                          __type_identity_t<_Tp> __identity_element
+                            = __detail::__default_identity_element<_Tp, _BinaryOperation>())
+    {
+      return __detail::__simd_transform_reduce<__detail::__simd_alg_load_t<_Vp, _Rg>,
+                                               __detail::_ReductionOrder::_Reassociated>(
+               __r, __init, __binary_op, __transform, __identity_element);
+    }
+
+  /**
+   * Returns the reduction of all elements of __r with __binary_op, or __identity_element if __r
+   * is empty. Unlike reduce(basic_simd), this is not bound by the latency of __binary_op, since
+   * the range is reduced into several independent accumulators.
+   */
+  template <class _Vp = void, __detail::_ReductionOrder _Order,
+            __detail::__sized_contiguous_range _Rg,
+            __detail::__binary_operation<ranges::range_value_t<_Rg>> _BinaryOperation = plus<>>
+    constexpr ranges::range_value_t<_Rg>
+    simd_reduce(__detail::_ReductionOrderTag<_Order> __order, _Rg&& __r,
+                _BinaryOperation __binary_op = {},
+                __type_identity_t<ranges::range_value_t<_Rg>> __identity_element
+                  = __detail::__default_identity_element<ranges::range_value_t<_Rg>,
+                                                         _BinaryOperation>())
+    {
+      return simd_transform_reduce<_Vp>(__order, __r, __identity_element, __binary_op,
+                                        std::identity(), __identity_element);
+    }
+
+  template <class _Vp = void, __detail::__sized_contiguous_range _Rg,
+            __detail::__binary_operation<ranges::range_value_t<_Rg>> _BinaryOperation = plus<>>
+    constexpr ranges::range_value_t<_Rg>
+    simd_reduce(_Rg&& __r, _BinaryOperation __binary_op = {},
+                __type_identity_t<ranges::range_value_t<_Rg>> __identity_element
+                  = __detail::__default_identity_element<ranges::range_value_t<_Rg>,
+                                                         _BinaryOperation>())
+    {
+      return simd_transform_reduce<_Vp>(simd_reduction_reassociated, __r, __identity_element,
+                                        __binary_op, std::identity(), __identity_element);
+    }
+
+  // NaN inputs are precondition violations (range_value_t<_Rg> satisfies and models
+  // totally_ordered)
+  template <class _Vp = void, __detail::__sized_contiguous_range _Rg>
+    requires totally_ordered<ranges::range_value_t<_Rg>>
+    constexpr ranges::range_value_t<_Rg>
+    simd_reduce_min(_Rg&& __r)
+    {
+      using _Tp = ranges::range_value_t<_Rg>;
+      __glibcxx_simd_precondition(ranges::size(__r) != 0, "the range must not be empty");
+      constexpr _Tp __identity = numeric_limits<_Tp>::has_infinity
+                                   ? numeric_limits<_Tp>::infinity() : std::__finite_max_v<_Tp>;
+      return simd_reduce<_Vp>(__r, []<__detail::__simd_type _UV>(const _UV& __a, const _UV& __b) {
+                                return std::min(__a, __b);
+                              }, __identity);
+    }
+
+  template <class _Vp = void, __detail::__sized_contiguous_range _Rg>
+    requires totally_ordered<ranges::range_value_t<_Rg>>
+    constexpr ranges::range_value_t<_Rg>
+    simd_reduce_max(_Rg&& __r)
+    {
+      using _Tp = ranges::range_value_t<_Rg>;
+      __glibcxx_simd_precondition(ranges::size(__r) != 0, "the range must not be empty");
+      constexpr _Tp __identity = numeric_limits<_Tp>::has_infinity
+                                   ? -numeric_limits<_Tp>::infinity() : std::__finite_min_v<_Tp>;
+      return simd_reduce<_Vp>(__r, []<__detail::__simd_type _UV>(const _UV& __a, const _UV& __b) {
+                                return std::max(__a, __b);
+                              }, __identity);
+    }
+
+  /**
+   * Returns the number of elements of __r for which the mask returned by __pred is true.
+   */
+  template <class _Vp = void, __detail::__sized_contiguous_range _Rg, typename _Pred>
+    constexpr ranges::range_difference_t<_Rg>
+    simd_count_if(_Rg&& __r, _Pred __pred)
+    {
+      using _Rp = __detail::__simd_alg_load_t<_Vp, _Rg>;
+      const auto __first = ranges::begin(__r);
+      ranges::range_difference_t<_Rg> __count[__detail::__simd_alg_unroll] = {};
+
+      __detail::__for_each_chunk<_Rp>(
+        std::to_address(__first), ranges::size(__r),
+        [&] [[__gnu__::__always_inline__]] (size_t __i, size_t __len) {
+          __count[0] += reduce_count(__pred(simd_partial_load<_Rp>(__first + __i, __len))
+                                       and __detail::__mask_with_n_true<_Rp>(__len));
+        },
+        [&] [[__gnu__::__always_inline__]] (auto __j, size_t __i, auto __flags) {
+          __count[__j] += reduce_count(__pred(simd_unchecked_load<_Rp>(__first + __i,
+                                                                       _Rp::size(), __flags)));
+        });
+
+      return _GLIBCXX_SIMD_INT_PACK(__detail::__simd_alg_unroll, _Is, {
+               return (__count[_Is] + ...);
+             });
+    }
+
+  namespace __detail
+  {
+    /**
+     * Loads the chunk at __it: __len is an integral_constant equal to _Rp::size() for full chunks.
+     */
+    template <typename _Rp, typename _It, typename _Flags>
+      _GLIBCXX_SIMD_ALWAYS_INLINE constexpr _Rp
+      __load_chunk(_It __it, size_t __len, _Flags)
+      { return simd_partial_load<_Rp>(__it, __len); }
+
+    template <typename _Rp, typename _It, typename _Flags>
+      _GLIBCXX_SIMD_ALWAYS_INLINE constexpr _Rp
+      __load_chunk(_It __it, integral_constant<size_t, _Rp::size()>, _Flags __flags)
+      { return simd_unchecked_load<_Rp>(__it, _Rp::size(), __flags); }
+
+    /**
+     * Returns the smallest __i + __j such that __chunk_mask(__i, __len, __flags)[__j] is true and
+     * __j < __len, or __n if there is no such index. The scan stops at the first chunk with a true
+     * element, and each chunk is tested with a single reduce_min_index_opt.
+     */
+    template <typename _Rp, typename _Up, typename _Fn>
+      _GLIBCXX_SIMD_ALWAYS_INLINE constexpr size_t
+      __find_first_chunk(const _Up* __align_ptr, size_t __n, _Fn&& __chunk_mask)
+      {
+        size_t __found = __n;
+        __for_each_chunk<_Rp>(
+          __align_ptr, __n,
+          [&] [[__gnu__::__always_inline__]] (size_t __i, size_t __len) {
+            const auto __j = reduce_min_index_opt(__chunk_mask(__i, __len, simd_flag_default)
+                                                    and __mask_with_n_true<_Rp>(__len));
+            if (__j)
+              __found = __i + *__j;
+            return __j.has_value();
+          },
+          [&] [[__gnu__::__always_inline__]] (auto, size_t __i, auto __flags) {
+            const auto __j = reduce_min_index_opt(
+                               __chunk_mask(__i, integral_constant<size_t, _Rp::size()>(),
+                                            __flags));
+            if (__j)
+              __found = __i + *__j;
+            return __j.has_value();
+          });
+        return __found;
+      }
+  }
+
+  /**
+   * Returns an iterator to the first element of __r for which the mask returned by __pred is true,
+   * or ranges::end(__r) if there is no such element.
+   */
+  template <class _Vp = void, __detail::__sized_contiguous_range _Rg, typename _Pred>
+    constexpr ranges::borrowed_iterator_t<_Rg>
+    simd_find_if(_Rg&& __r, _Pred __pred)
+    {
+      using _Rp = __detail::__simd_alg_load_t<_Vp, _Rg>;
+      const auto __first = ranges::begin(__r);
+      return __first + __detail::__find_first_chunk<_Rp>(
+                         std::to_address(__first), ranges::size(__r),
+                         [&] [[__gnu__::__always_inline__]] (size_t __i, auto __len,
+                                                             auto __flags) {
+                           return __pred(__detail::__load_chunk<_Rp>(__first + __i, __len,
+                                                                     __flags));
+                         });
+    }
+
+  /**
+   * Returns an iterator to the first element of __r that compares equal to __value, or
+   * ranges::end(__r) if there is no such element.
+   */
+  template <class _Vp = void, __detail::__sized_contiguous_range _Rg>
+    constexpr ranges::borrowed_iterator_t<_Rg>
+    simd_find(_Rg&& __r, const ranges::range_value_t<_Rg>& __value)
+    {
+      using _Rp = __detail::__simd_alg_load_t<_Vp, _Rg>;
+      const _Rp __v = __value;
+      return simd_find_if<_Vp>(__r, [&] [[__gnu__::__always_inline__]] (const _Rp& __x) {
+               return __x == __v;
+             });
+    }
+
+  /**
+   * Returns iterators to the first position where __r1 and __r2 differ, comparing at most
+   * min(ranges::size(__r1), ranges::size(__r2)) elements.
+   */
+  template <class _Vp = void, __detail::__sized_contiguous_range _Rg1,
+            __detail::__sized_contiguous_range _Rg2>
+    requires same_as<ranges::range_value_t<_Rg1>, ranges::range_value_t<_Rg2>>
+    constexpr ranges::mismatch_result<ranges::borrowed_iterator_t<_Rg1>,
+                                      ranges::borrowed_iterator_t<_Rg2>>
+    simd_mismatch(_Rg1&& __r1, _Rg2&& __r2)
+    {
+      using _Rp = __detail::__simd_alg_load_t<_Vp, _Rg1>;
+      const auto __first1 = ranges::begin(__r1);
+      const auto __first2 = ranges::begin(__r2);
+      const size_t __n = std::min<size_t>(ranges::size(__r1), ranges::size(__r2));
+      const size_t __found = __detail::__find_first_chunk<_Rp>(
+                               std::to_address(__first1), __n,
+                               [&] [[__gnu__::__always_inline__]] (size_t __i, auto __len,
+                                                                   auto __flags) {
+                                 return __detail::__load_chunk<_Rp>(__first1 + __i, __len,
+                                                                    __flags)
+                                          != __detail::__load_chunk<_Rp>(__first2 + __i, __len,
+                                                                         simd_flag_default);
+                               });
+      return {__first1 + __found, __first2 + __found};
+    }
+
+  /**
+   * Returns the subrange of __haystack where __needle occurs first, or an empty subrange at
+   * ranges::end(__haystack) if it does not occur.
+   *
+   * Every chunk compares the first and the last element of __needle against the corresponding
+   * positions in __haystack and only the set lanes of the resulting mask are verified element by
+   * element. This is most effective for byte strings, where a chunk covers many candidate
+   * positions.
+   */
+  template <class _Vp = void, __detail::__sized_contiguous_range _Rg1,
+            __detail::__sized_contiguous_range _Rg2>
+    requires same_as<ranges::range_value_t<_Rg1>, ranges::range_value_t<_Rg2>>
+    constexpr ranges::borrowed_subrange_t<_Rg1>
+    simd_search(_Rg1&& __haystack, _Rg2&& __needle)
+    {
+      using _Rp = __detail::__simd_alg_load_t<_Vp, _Rg1>;
+      const auto __first = ranges::begin(__haystack);
+      const auto __needle_first = ranges::begin(__needle);
+      const size_t __n = ranges::size(__haystack);
+      const size_t __m = ranges::size(__needle);
+      if (__m == 0)
+        return {__first, __first};
+      if (__m > __n)
+        return {__first + __n, __first + __n};
+
+      const _Rp __front = __needle_first[0];
+      const _Rp __back = __needle_first[__m - 1];
+      // the first and last element are already known to match
+      auto __verify = [&] [[__gnu__::__always_inline__]] (size_t __pos) {
+        for (size_t __l = 1; __l + 1 < __m; ++__l)
+          if (not (__first[__pos + __l] == __needle_first[__l]))
+            return false;
+        return true;
+      };
+
+      size_t __found = __n;
+      __detail::__find_first_chunk<_Rp>(
+        std::to_address(__first), __n - __m + 1,
+        [&] [[__gnu__::__always_inline__]] (size_t __i, auto __len, auto __flags) {
+          auto __k = __detail::__load_chunk<_Rp>(__first + __i, __len, __flags) == __front
+                       and __detail::__load_chunk<_Rp>(__first + __i + __m - 1, __len,
+                                                       simd_flag_default) == __back;
+          if constexpr (same_as<decltype(__len), size_t>)
+            __k = __k and __detail::__mask_with_n_true<_Rp>(__len);
+          for (int __j : set_indices(__k))
+            if (__verify(__i + __j))
+              {
+                __found = __i + __j;
+                break;
+              }
+          // a true lane tells __find_first_chunk to stop
+          return decltype(__k)(__found != __n);
+        });
+      if (__found == __n)
+        return {__first + __n, __first + __n};
+      return {__first + __found, __first + __found + __m};
+    }
+}
+
+#endif  // PROTOTYPE_SIMD_ALGORITHM_H_
@@ -0,0 +1,146 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later WITH GCC-exception-3.1 */
+/* Copyright © 2025      GSI Helmholtzzentrum fuer Schwerionenforschung GmbH
+ *                       Matthias Kretz <m.kretz@gsi.de>
+ */
+
+#ifndef PROTOTYPE_SIMD_BIT_H_
+#define PROTOTYPE_SIMD_BIT_H_
+
+#include "simd.h"
+#include "simd_alg.h"
+
+#include <bit>
+
+// P2933R4 Extend <bit> header function with overloads for std::simd
+
+namespace std
+{
+  namespace __detail
+  {
+    template <typename _Vp>
+      using __bit_count_result_t = rebind_simd_t<make_signed_t<typename _Vp::value_type>, _Vp>;
+
+    /**
+     * Sets all bits to the right of the most significant set bit.
+     */
+    template <typename _Tp, typename _Abi>
+      _GLIBCXX_SIMD_ALWAYS_INLINE constexpr basic_simd<_Tp, _Abi>
+      __smear_right(basic_simd<_Tp, _Abi> __x)
+      {
+        for (int __shift = 1; __shift < int(__CHAR_BIT__ * sizeof(_Tp)); __shift *= 2)
+          __x |= __x >> __shift;
+        return __x;
+      }
+  }
+
+  template <integral _Tp, typename _Abi>
+    _GLIBCXX_SIMD_ALWAYS_INLINE constexpr basic_simd<_Tp, _Abi>
+    byteswap(const basic_simd<_Tp, _Abi>& __x) noexcept
+    { return {__detail::__private_init, _Abi::_SimdImpl::_S_byteswap(__data(__x))}; }
+
+  template <unsigned_integral _Tp, typename _Abi>
+    _GLIBCXX_SIMD_ALWAYS_INLINE constexpr basic_simd<_Tp, _Abi>
+    bit_ceil(const basic_simd<_Tp, _Abi>& __x) noexcept
+    {
+      using _Vp = basic_simd<_Tp, _Abi>;
+      __glibcxx_simd_precondition(all_of(__x <= _Tp(_Tp(1) << (__CHAR_BIT__ * sizeof(_Tp) - 1))),
+                                  "bit_ceil result is not representable");
+      return simd_select(__x == _Tp(), _Vp(_Tp(1)),
+                         _Vp(__detail::__smear_right(_Vp(__x - _Tp(1))) + _Tp(1)));
+    }
+
+  template <unsigned_integral _Tp, typename _Abi>
+    _GLIBCXX_SIMD_ALWAYS_INLINE constexpr basic_simd<_Tp, _Abi>
+    bit_floor(const basic_simd<_Tp, _Abi>& __x) noexcept
+    {
+      const basic_simd<_Tp, _Abi> __v = __detail::__smear_right(__x);
+      return __v ^ (__v >> 1);
+    }
+
+  template <unsigned_integral _Tp, typename _Abi>
+    _GLIBCXX_SIMD_ALWAYS_INLINE constexpr typename basic_simd<_Tp, _Abi>::mask_type
+    has_single_bit(const basic_simd<_Tp, _Abi>& __x) noexcept
+    { return __x != _Tp() and (__x & (__x - _Tp(1))) == _Tp(); }
+
+  template <unsigned_integral _Tp, typename _Abi, integral _Up, typename _Abi1>
+    requires (basic_simd<_Up, _Abi1>::size.value == basic_simd<_Tp, _Abi>::size.value)
+      and (sizeof(_Up) == sizeof(_Tp))
+    _GLIBCXX_SIMD_ALWAYS_INLINE constexpr basic_simd<_Tp, _Abi>
+    rotl(const basic_simd<_Tp, _Abi>& __x, const basic_simd<_Up, _Abi1>& __s) noexcept
+    {
+      using _Vp = basic_simd<_Tp, _Abi>;
+      return {__detail::__private_init,
+              _Abi::_SimdImpl::_S_rotl(__data(__x), __data(static_cast<_Vp>(__s)))};
+    }
+
+  template <unsigned_integral _Tp, typename _Abi>
+    _GLIBCXX_SIMD_ALWAYS_INLINE constexpr basic_simd<_Tp, _Abi>
+    rotl(const basic_simd<_Tp, _Abi>& __x, int __s) noexcept
+    { return {__detail::__private_init, _Abi::_SimdImpl::_S_rotl(__data(__x), __s)}; }
+
+  template <unsigned_integral _Tp, typename _Abi, integral _Up, typename _Abi1>
+    requires (basic_simd<_Up, _Abi1>::size.value == basic_simd<_Tp, _Abi>::size.value)
+      and (sizeof(_Up) == sizeof(_Tp))
+    _GLIBCXX_SIMD_ALWAYS_INLINE constexpr basic_simd<_Tp, _Abi>
+    rotr(const basic_simd<_Tp, _Abi>& __x, const basic_simd<_Up, _Abi1>& __s) noexcept
+    {
+      using _Vp = basic_simd<_Tp, _Abi>;
+      return {__detail::__private_init,
+              _Abi::_SimdImpl::_S_rotr(__data(__x), __data(static_cast<_Vp>(__s)))};
+    }
+
+  template <unsigned_integral _Tp, typename _Abi>
+    _GLIBCXX_SIMD_ALWAYS_INLINE constexpr basic_simd<_Tp, _Abi>
+    rotr(const basic_simd<_Tp, _Abi>& __x, int __s) noexcept
+    { return {__detail::__private_init, _Abi::_SimdImpl::_S_rotr(__data(__x), __s)}; }
+
+  template <unsigned_integral _Tp, typename _Abi>
+    _GLIBCXX_SIMD_ALWAYS_INLINE constexpr __detail::__bit_count_result_t<basic_simd<_Tp, _Abi>>
+    countl_zero(const basic_simd<_Tp, _Abi>& __x) noexcept
+    {
+      using _Rp = __detail::__bit_count_result_t<basic_simd<_Tp, _Abi>>;
+      return static_cast<_Rp>(basic_simd<_Tp, _Abi>(
+                                __detail::__private_init,
+                                _Abi::_SimdImpl::_S_countl_zero(__data(__x))));
+    }
+
+  template <unsigned_integral _Tp, typename _Abi>
+    _GLIBCXX_SIMD_ALWAYS_INLINE constexpr __detail::__bit_count_result_t<basic_simd<_Tp, _Abi>>
+    countl_one(const basic_simd<_Tp, _Abi>& __x) noexcept
+    { return countl_zero(~__x); }
+
+  template <unsigned_integral _Tp, typename _Abi>
+    _GLIBCXX_SIMD_ALWAYS_INLINE constexpr __detail::__bit_count_result_t<basic_simd<_Tp, _Abi>>
+    countr_zero(const basic_simd<_Tp, _Abi>& __x) noexcept
+    {
+      using _Rp = __detail::__bit_count_result_t<basic_simd<_Tp, _Abi>>;
+      return static_cast<_Rp>(basic_simd<_Tp, _Abi>(
+                                __detail::__private_init,
+                                _Abi::_SimdImpl::_S_countr_zero(__data(__x))));
+    }
+
+  template <unsigned_integral _Tp, typename _Abi>
+    _GLIBCXX_SIMD_ALWAYS_INLINE constexpr __detail::__bit_count_result_t<basic_simd<_Tp, _Abi>>
+    countr_one(const basic_simd<_Tp, _Abi>& __x) noexcept
+    { return countr_zero(~__x); }
+
+  template <unsigned_integral _Tp, typename _Abi>
+    _GLIBCXX_SIMD_ALWAYS_INLINE constexpr __detail::__bit_count_result_t<basic_simd<_Tp, _Abi>>
+    bit_width(const basic_simd<_Tp, _Abi>& __x) noexcept
+    {
+      using _Rp = __detail::__bit_count_result_t<basic_simd<_Tp, _Abi>>;
+      return _Rp(make_signed_t<_Tp>(__CHAR_BIT__ * sizeof(_Tp))) - countl_zero(__x);
+    }
+
+  template <unsigned_integral _Tp, typename _Abi>
+    _GLIBCXX_SIMD_ALWAYS_INLINE constexpr __detail::__bit_count_result_t<basic_simd<_Tp, _Abi>>
+    popcount(const basic_simd<_Tp, _Abi>& __x) noexcept
+    {
+      using _Rp = __detail::__bit_count_result_t<basic_simd<_Tp, _Abi>>;
+      return static_cast<_Rp>(basic_simd<_Tp, _Abi>(
+                                __detail::__private_init,
+                                _Abi::_SimdImpl::_S_bit_popcount(__data(__x))));
+    }
+}
+
+#endif  // PROTOTYPE_SIMD_BIT_H_
@@ -316,6 +316,13 @@ namespace std::__detail
             }();
         }
 
+      // Non-temporal load. __mem is aligned to simd_alignment_v. Without target-specific support
+      // this is a regular load.
+      template <typename _Tp, typename _Up>
+        _GLIBCXX_SIMD_INTRINSIC static constexpr _SimdMember<_Tp>
+        _S_stream_load(const _Up* __mem, _TypeTag<_Tp> __tag)
+        { return _SuperImpl::_S_load(__mem, __tag); }
+
       template <typename _Tp, typename _Up>
         static constexpr inline _SimdMember<_Tp>
         _S_masked_load(_MaskMember<_SimdMember<_Tp>> __k, const _Up* __mem, _TypeTag<_Tp> __tag)
@@ -343,6 +350,92 @@ namespace std::__detail
           return __merge;
         }
 
+      // Loads __mem[__idx[__i]] for all __i in [0, _S_size). The index vector __idx may have a
+      // different width than the result, but it must hold at least _S_size elements.
+      template <typename _Tp, typename _Up, __vec_builtin _IV>
+        _GLIBCXX_SIMD_INTRINSIC static constexpr _SimdMember<_Tp>
+        _S_gather(const _Up* __mem, _IV __idx, _TypeTag<_Tp>)
+        {
+          return _GLIBCXX_SIMD_VEC_GEN(_SimdMember<_Tp>, _S_size, __i,
+                                       {static_cast<_Tp>(__mem[__idx[__i]])...});
+        }
+
+      template <__vec_builtin _TV, typename _Up, __vec_builtin _IV>
+        _GLIBCXX_SIMD_INTRINSIC static _TV
+        _S_masked_gather(_TV __merge, _MaskMember<_TV> __k, const _Up* __mem, _IV __idx)
+        {
+          _S_bit_iteration(
+            _SuperImpl::_S_to_bits(__k),
+            [&] [[__gnu__::__always_inline__]] (auto __i) {
+              __merge[__i] = static_cast<__value_type_of<_TV>>(__mem[__idx[__i]]);
+            });
+          return __merge;
+        }
+
+      // Stores __v[__i] to __mem[__idx[__i]] in order of increasing __i. Thus, for equal indexes
+      // the element with the highest __i wins.
+      template <__vec_builtin _TV, typename _Up, __vec_builtin _IV>
+        _GLIBCXX_SIMD_INTRINSIC static void
+        _S_scatter(_TV __v, _Up* __mem, _IV __idx)
+        {
+          _GLIBCXX_SIMD_INT_PACK(_S_size, _Is, {
+            ((__mem[__idx[_Is]] = static_cast<_Up>(__v[_Is])), ...);
+          });
+        }
+
+      template <__vec_builtin _TV, typename _Up, __vec_builtin _IV>
+        _GLIBCXX_SIMD_INTRINSIC static void
+        _S_masked_scatter(_TV __v, _MaskMember<_TV> __k, _Up* __mem, _IV __idx)
+        {
+          _S_bit_iteration(
+            _SuperImpl::_S_to_bits(__k),
+            [&] [[__gnu__::__always_inline__]] (auto __i) {
+              __mem[__idx[__i]] = static_cast<_Up>(__v[__i]);
+            });
+        }
+
+      // Moves the elements of __v selected by __k to the front (keeping their order). The
+      // remaining elements are zero.
+      template <__vec_builtin _TV>
+        _GLIBCXX_SIMD_INTRINSIC static _TV
+        _S_compress(_TV __v, _MaskMember<_TV> __k)
+        {
+          _TV __r = {};
+          int __n = 0;
+          _S_bit_iteration(
+            _SuperImpl::_S_to_bits(__k),
+            [&] [[__gnu__::__always_inline__]] (auto __i) {
+              __r[__n++] = __v[__i];
+            });
+          return __r;
+        }
+
+      // Inverse of _S_compress: moves the leading elements of __v to the positions selected by
+      // __k (keeping their order). The remaining elements are taken from __orig.
+      template <__vec_builtin _TV>
+        _GLIBCXX_SIMD_INTRINSIC static _TV
+        _S_expand(_TV __v, _MaskMember<_TV> __k, _TV __orig)
+        {
+          int __n = 0;
+          _S_bit_iteration(
+            _SuperImpl::_S_to_bits(__k),
+            [&] [[__gnu__::__always_inline__]] (auto __i) {
+              __orig[__i] = __v[__n++];
+            });
+          return __orig;
+        }
+
+      // Stores the elements of __v selected by __k contiguously to __mem and returns their number.
+      template <__vec_builtin _TV>
+        _GLIBCXX_SIMD_INTRINSIC static int
+        _S_compress_store(_TV __v, _MaskMember<_TV> __k, __value_type_of<_TV>* __mem)
+        {
+          const int __n = _SuperImpl::_S_to_bits(__k).count();
+          _SuperImpl::_S_partial_store(_SuperImpl::_S_compress(__v, __k), __mem, __n,
+                                       static_cast<__value_type_of<_TV>*>(nullptr));
+          return __n;
+        }
+
       template <__vec_builtin _TV, typename _Up>
         _GLIBCXX_SIMD_INTRINSIC static constexpr void
         _S_store(_TV __v, _Up* __mem, _TypeTag<__value_type_of<_TV>>) noexcept
@@ -362,6 +455,13 @@ namespace std::__detail
             }
         }
 
+      // Non-temporal store. __mem is aligned to simd_alignment_v. Without target-specific support
+      // this is a regular store.
+      template <__vec_builtin _TV, typename _Up>
+        _GLIBCXX_SIMD_INTRINSIC static constexpr void
+        _S_stream_store(_TV __v, _Up* __mem, _TypeTag<__value_type_of<_TV>> __tag) noexcept
+        { _SuperImpl::_S_store(__v, __mem, __tag); }
+
       template <__vec_builtin _TV, typename _Up>
         _GLIBCXX_SIMD_INTRINSIC static constexpr void
         _S_partial_store(_TV __v, _Up* __mem, size_t __mem_size,
@@ -460,6 +560,184 @@ namespace std::__detail
         _S_modulus(_TV __x, _TV __y)
         { return __x % _Abi::__make_padding_nonzero(__y); }
 
+      /**
+       * The high half of the full product of __x and __y.
+       */
+      template <__vec_builtin _TV>
+        requires is_integral_v<__value_type_of<_TV>>
+        _GLIBCXX_SIMD_INTRINSIC static constexpr _TV
+        _S_mulhi(_TV __x, _TV __y)
+        {
+          using _Tp = __value_type_of<_TV>;
+          constexpr int __bits = __CHAR_BIT__ * sizeof(_Tp);
+          if constexpr (sizeof(_Tp) < 8)
+            {
+              using _Up = typename __make_unsigned_int<2 * sizeof(_Tp)>::type;
+              using _WV = __vec_builtin_type<conditional_t<is_signed_v<_Tp>, make_signed_t<_Up>, _Up>,
+                                             __width_of<_TV>>;
+              return __vec_convert<_TV>((__vec_convert<_WV>(__x) * __vec_convert<_WV>(__y))
+                                          >> __bits);
+            }
+          else
+            { // combine the four products of the 32-bit halves
+              using _UV = __vec_builtin_type<__make_unsigned_int_t<_Tp>, __width_of<_TV>>;
+              const _UV __a = reinterpret_cast<_UV>(__x);
+              const _UV __b = reinterpret_cast<_UV>(__y);
+              const _UV __a_lo = __a & 0xffff'ffffu;
+              const _UV __b_lo = __b & 0xffff'ffffu;
+              const _UV __a_hi = __a >> 32;
+              const _UV __b_hi = __b >> 32;
+              const _UV __lolo = __a_lo * __b_lo;
+              const _UV __hilo = __a_hi * __b_lo;
+              const _UV __cross = (__lolo >> 32) + (__hilo & 0xffff'ffffu) + __a_lo * __b_hi;
+              _UV __hi = __a_hi * __b_hi + (__hilo >> 32) + (__cross >> 32);
+              if constexpr (is_signed_v<_Tp>)
+                { // subtract the other factor for negative factors
+                  __hi -= reinterpret_cast<_UV>(__x >> (__bits - 1)) & __b;
+                  __hi -= reinterpret_cast<_UV>(__y >> (__bits - 1)) & __a;
+                }
+              return reinterpret_cast<_TV>(__hi);
+            }
+        }
+
+      /**
+       * Complex multiplication of interleaved (real, imaginary) pairs.
+       */
+      template <__vec_builtin _TV>
+        requires is_floating_point_v<__value_type_of<_TV>>
+        _GLIBCXX_SIMD_INTRINSIC static constexpr _TV
+        _S_complex_multiplies(_TV __x, _TV __y)
+        {
+          return _GLIBCXX_SIMD_INT_PACK(__width_of<_TV>, _Is, {
+                   const _TV __re = __builtin_shufflevector(__x, __x, (_Is & ~1)...);
+                   const _TV __im = __builtin_shufflevector(__x, __x, (_Is | 1)...);
+                   const _TV __y_swapped = __builtin_shufflevector(__y, __y, (_Is ^ 1)...);
+                   constexpr _TV __sign = {((_Is & 1) ? 1 : -1)...};
+                   return __re * __y + __sign * (__im * __y_swapped);
+                 });
+        }
+
+      // <bit> functions; the value type of _TV is an unsigned integer type
+
+      /**
+       * Population count via the SWAR bit-twiddling sequence: count in 2-bit and 4-bit fields,
+       * then sum the byte counts with shifts and adds (avoids slow 32- and 64-bit multiplies).
+       */
+      template <__vec_builtin _TV>
+        requires is_integral_v<__value_type_of<_TV>>
+        _GLIBCXX_SIMD_INTRINSIC static constexpr _TV
+        _S_bit_popcount(_TV __x)
+        {
+          using _Tp = __value_type_of<_TV>;
+          using _Up = __make_unsigned_int_t<_Tp>;
+          constexpr int __bits = __CHAR_BIT__ * sizeof(_Tp);
+          auto __v = __vec_bitcast<_Up>(__x);
+          __v -= (__v >> 1) & _Up(0x5555'5555'5555'5555ull);
+          __v = (__v & _Up(0x3333'3333'3333'3333ull)) + ((__v >> 2) & _Up(0x3333'3333'3333'3333ull));
+          __v = (__v + (__v >> 4)) & _Up(0x0f0f'0f0f'0f0f'0f0full);
+          if constexpr (sizeof(_Tp) >= 2)
+            __v += __v >> 8;
+          if constexpr (sizeof(_Tp) >= 4)
+            __v += __v >> 16;
+          if constexpr (sizeof(_Tp) == 8)
+            __v += __v >> 32;
+          if constexpr (sizeof(_Tp) >= 2)
+            __v &= _Up(2 * __bits - 1);
+          return __vec_bitcast<_Tp>(__v);
+        }
+
+      /**
+       * Smear the most significant set bit to the right, then count the ones.
+       */
+      template <__vec_builtin _TV>
+        requires is_integral_v<__value_type_of<_TV>>
+        _GLIBCXX_SIMD_INTRINSIC static constexpr _TV
+        _S_countl_zero(_TV __x)
+        {
+          using _Tp = __value_type_of<_TV>;
+          using _Up = __make_unsigned_int_t<_Tp>;
+          constexpr int __bits = __CHAR_BIT__ * sizeof(_Tp);
+          auto __v = __vec_bitcast<_Up>(__x);
+          for (int __shift = 1; __shift < __bits; __shift *= 2)
+            __v |= __v >> __shift;
+          return __vec_bitcast<_Tp>(
+                   _Up(__bits) - __vec_bitcast<_Up>(_SuperImpl::_S_bit_popcount(__vec_bitcast<_Tp>(__v))));
+        }
+
+      /**
+       * The trailing zeros of __x are the only ones in ~__x & (__x - 1).
+       */
+      template <__vec_builtin _TV>
+        requires is_integral_v<__value_type_of<_TV>>
+        _GLIBCXX_SIMD_INTRINSIC static constexpr _TV
+        _S_countr_zero(_TV __x)
+        {
+          using _Tp = __value_type_of<_TV>;
+          using _Up = __make_unsigned_int_t<_Tp>;
+          const auto __v = __vec_bitcast<_Up>(__x);
+          return _SuperImpl::_S_bit_popcount(__vec_bitcast<_Tp>(~__v & (__v - _Up(1))));
+        }
+
+      template <__vec_builtin _TV>
+        requires is_integral_v<__value_type_of<_TV>>
+        _GLIBCXX_SIMD_INTRINSIC static constexpr _TV
+        _S_byteswap(_TV __x)
+        {
+          using _Tp = __value_type_of<_TV>;
+          if constexpr (sizeof(_Tp) == 1)
+            return __x;
+          else
+            {
+              const auto __bytes = __vec_bitcast<char>(__x);
+              return __vec_bitcast<_Tp>(_GLIBCXX_SIMD_INT_PACK(sizeof(_TV), _Is, {
+                       return __builtin_shufflevector(__bytes, __bytes, (_Is ^ (sizeof(_Tp) - 1))...);
+                     }));
+            }
+        }
+
+      // the shift counts are reduced modulo the number of bits, which makes both shifts valid
+      template <__vec_builtin _TV>
+        requires is_unsigned_v<__value_type_of<_TV>>
+        _GLIBCXX_SIMD_INTRINSIC static constexpr _TV
+        _S_rotl(_TV __x, _TV __y)
+        {
+          using _Tp = __value_type_of<_TV>;
+          constexpr _Tp __mask = __CHAR_BIT__ * sizeof(_Tp) - 1;
+          return _SuperImpl::_S_bit_shift_left(__x, __y & __mask)
+                   | _SuperImpl::_S_bit_shift_right(__x, -__y & __mask);
+        }
+
+      template <__vec_builtin _TV>
+        requires is_unsigned_v<__value_type_of<_TV>>
+        _GLIBCXX_SIMD_INTRINSIC static constexpr _TV
+        _S_rotl(_TV __x, int __y)
+        {
+          constexpr int __mask = __CHAR_BIT__ * sizeof(__value_type_of<_TV>) - 1;
+          return _SuperImpl::_S_bit_shift_left(__x, __y & __mask)
+                   | _SuperImpl::_S_bit_shift_right(__x, -__y & __mask);
+        }
+
+      template <__vec_builtin _TV>
+        requires is_unsigned_v<__value_type_of<_TV>>
+        _GLIBCXX_SIMD_INTRINSIC static constexpr _TV
+        _S_rotr(_TV __x, _TV __y)
+        {
+          using _Tp = __value_type_of<_TV>;
+          constexpr _Tp __mask = __CHAR_BIT__ * sizeof(_Tp) - 1;
+          return _SuperImpl::_S_bit_shift_right(__x, __y & __mask)
+                   | _SuperImpl::_S_bit_shift_left(__x, -__y & __mask);
+        }
+
+      template <__vec_builtin _TV>
+        requires is_unsigned_v<__value_type_of<_TV>>
+        _GLIBCXX_SIMD_INTRINSIC static constexpr _TV
+        _S_rotr(_TV __x, int __y)
+        {
+          constexpr int __mask = __CHAR_BIT__ * sizeof(__value_type_of<_TV>) - 1;
+          return _SuperImpl::_S_bit_shift_right(__x, __y & __mask)
+                   | _SuperImpl::_S_bit_shift_left(__x, -__y & __mask);
+        }
+
       template <__vec_builtin _TV>
         _GLIBCXX_SIMD_INTRINSIC static constexpr _TV
         _S_bit_and(_TV __x, _TV __y)
@@ -671,7 +949,7 @@ namespace std::__detail
           const _TV __absx = __vec_and(__x, _S_absmask<_TV>);
           static_assert(__CHAR_BIT__ * sizeof(1ull) >= __digits_v<_Tp>);
           constexpr _TV __shifter_abs = _TV() + (1ull << (__digits_v<_Tp> - 1));
-          const _TV __shifter = __vec_or(__absx, __shifter_abs);
+          const _TV __shifter = __vec_or(__vec_xor(__absx, __x), __shifter_abs);
           const _TV __shifted = _S_plus_minus(__x, __shifter);
           return __absx < __shifter_abs ? __shifted : __x;
         }
@@ -728,142 +1006,2202 @@ namespace std::__detail
           return __vec_or(__vec_and(__inv_mask, __y), __vec_andnot(__inv_mask, __y + _Tp(1)));
         }
 
+      // Evaluates the polynomial with coefficients __c0, __cs... (highest degree first) at __x.
+      template <__vec_builtin _TV, typename... _Tps>
+        _GLIBCXX_SIMD_INTRINSIC static constexpr _TV
+        _S_horner(_TV __x, __value_type_of<_TV> __c0, _Tps... __cs)
+        {
+          using _Tp = __value_type_of<_TV>;
+          _TV __r = _TV() + __c0;
+          ((__r = __r * __x + _Tp(__cs)), ...);
+          return __r;
+        }
+
+      // Returns __x * 2^__n for integral-valued __n.
+      // Precondition: |__n| is small enough that the exponent fits into two normal scale factors
+      // (i.e. __n ∈ [2 * (min_exponent - 1), 2 * (max_exponent - 1)]). With -ffast-math, __n must
+      // be in [min_exponent - 2, max_exponent - 1] and 2^(min_exponent - 2) is flushed to zero.
       template <__vec_builtin _TV>
-        _GLIBCXX_SIMD_INTRINSIC static constexpr _MaskMember<_TV>
-        _S_isnan([[maybe_unused]] _TV __x)
+        _GLIBCXX_SIMD_INTRINSIC static constexpr _TV
+        _S_ldexp_fp(_TV __x, _TV __n)
         {
-#if __FINITE_MATH_ONLY__
-          return {}; // false
-#elif not defined __SUPPORT_SNAN__ or not defined __STDC_IEC_559__
-          return ~(__x == __x);
-#else
           using _Tp = __value_type_of<_TV>;
-          using _IV = __vec_builtin_type<__make_signed_int_t<_Tp>, _S_full_size>;
-          const auto __absn = __builtin_bit_cast(_IV, _SuperImpl::_S_abs(__x));
-          const auto __infn = __builtin_bit_cast(
-                                _IV, __vec_broadcast<_S_size>(__infinity_v<_Tp>));
-          return __infn < __absn;
+          using _UV = __vec_builtin_type<__make_unsigned_int_t<_Tp>, __width_of<_TV>>;
+          constexpr int __mant_bits = __digits_v<_Tp> - 1;
+          // __k + __shifter stores __k in the low mantissa bits (two's complement); shifting it
+          // into the exponent field drops the bits of __shifter.
+          constexpr _Tp __shifter = 0x1.8p0 * (1ull << __mant_bits);
+          constexpr auto __bias = __max_exponent_v<_Tp> - 1;
+          auto __exp2 = [](_TV __k) {
+            const _UV __bits = __builtin_bit_cast(_UV, __k + __shifter);
+            return __builtin_bit_cast(_TV, (__bits + __bias) << __mant_bits);
+          };
+#ifdef __FAST_MATH__
+          return __x * __exp2(__n);
+#else
+          const _TV __n0 = _S_plus_minus(__n * _Tp(.5), __shifter);
+          return __x * __exp2(__n0) * __exp2(__n - __n0);
 #endif
         }
 
+      // Returns the significand of __x normalized to [√½, √2) and stores the matching exponent
+      // (as floating-point value) to __k. Only valid for finite positive __x. Without -ffast-math
+      // subnormals are supported.
       template <__vec_builtin _TV>
-        _GLIBCXX_SIMD_INTRINSIC static constexpr _MaskMember<_TV>
-        _S_isfinite([[maybe_unused]] _TV __x)
+        _GLIBCXX_SIMD_INTRINSIC static constexpr _TV
+        _S_log_reduce(_TV __x, _TV& __k)
         {
-#if __FINITE_MATH_ONLY__
-          return _S_allbits<_MaskMember<_TV>>;
-#else
-          // if all exponent bits are set, __x is either inf or NaN
           using _Tp = __value_type_of<_TV>;
-          using _IV = __vec_builtin_type<__make_signed_int_t<_Tp>, _S_full_size>;
-          const auto __absn = __builtin_bit_cast(_IV, _SuperImpl::_S_abs(__x));
-          constexpr _IV __maxn
-            = __builtin_bit_cast(_IV, __vec_broadcast<_S_size>(__finite_max_v<_Tp>));
-          return _SuperImpl::_S_less_equal(__absn, __maxn);
+          using _Up = __make_unsigned_int_t<_Tp>;
+          using _UV = __vec_builtin_type<_Up, __width_of<_TV>>;
+          constexpr int __mant_bits = __digits_v<_Tp> - 1;
+          constexpr _Up __bias = __max_exponent_v<_Tp> - 1;
+          constexpr _Up __mant_mask = (_Up(1) << __mant_bits) - 1;
+          constexpr _Up __sqrt_half_bits = __builtin_bit_cast(_Up, _Tp(0x1.6a09e667f3bcdp-1));
+          // Subtracting __offset from the bits of __x yields (k + bias - 1) in the exponent field
+          // and f such that the significand √½ + f ∈ [√½, √2).
+          constexpr _Up __offset = __sqrt_half_bits - ((__bias - 1) << __mant_bits);
+          // OR-ing a small integer into the mantissa of 2^mant_bits converts it to _Tp
+          constexpr _Tp __two_to_mant = 1ull << __mant_bits;
+          constexpr _Up __two_to_mant_bits = __builtin_bit_cast(_Up, __two_to_mant);
+#ifndef __FAST_MATH__
+          const auto __subnormal = __x < __norm_min_v<_Tp>;
+          __x = __subnormal ? __x * _Tp(1ull << __digits_v<_Tp>) : __x;
+#endif
+          const _UV __ix = __builtin_bit_cast(_UV, __x) - __offset;
+          __k = __builtin_bit_cast(_TV, (__ix >> __mant_bits) | __two_to_mant_bits)
+                  - (__two_to_mant + _Tp(__bias - 1));
+#ifndef __FAST_MATH__
+          __k = __subnormal ? __k - _Tp(__digits_v<_Tp>) : __k;
 #endif
+          return __builtin_bit_cast(_TV, (__ix & __mant_mask) + __sqrt_half_bits);
         }
 
+      // Returns s * (__hfsq + R(s²)) with s = __f / (2 + __f) and __hfsq = __f² / 2, i.e. the
+      // higher-order terms of log1p(__f) = __f - __hfsq + s * (__hfsq + R(s²)) for
+      // 1 + __f ∈ [√½, √2).
+      // The polynomials are the ones used by FreeBSD's e_logf.c / e_log.c (Sun Microsystems).
       template <__vec_builtin _TV>
-        _GLIBCXX_SIMD_INTRINSIC static constexpr _MaskMember<_TV>
-        _S_isunordered(_TV __x, _TV __y)
-        { return __vec_or(_S_isnan(__x), _S_isnan(__y)); }
+        _GLIBCXX_SIMD_INTRINSIC static constexpr _TV
+        _S_log1p_poly(_TV __f, _TV __hfsq)
+        {
+          using _Tp = __value_type_of<_TV>;
+          const _TV __s = __f / (_Tp(2) + __f);
+          const _TV __z = __s * __s;
+          const _TV __w = __z * __z;
+          _TV __r;
+          if constexpr (sizeof(_Tp) == sizeof(float))
+            __r = __w * _S_horner(__w, 0x1.f13c4cp-3f, 0x1.999c26p-2f)
+                    + __z * _S_horner(__w, 0x1.23d3dcp-2f, 0x1.555554p-1f);
+          else if constexpr (sizeof(_Tp) == sizeof(double))
+            __r = __w * _S_horner(__w, 0x1.39a09d078c69fp-3, 0x1.c71c51d8e78afp-3,
+                                  0x1.999999997fa04p-2)
+                    + __z * _S_horner(__w, 0x1.2f112df3e5244p-3, 0x1.7466496cb03dep-3,
+                                      0x1.2492494229359p-2, 0x1.5555555555593p-1);
+          else
+            static_assert(false);
+          return __s * (__hfsq + __r);
+        }
 
+      // Returns log1p(__f) + __c for 1 + __f ∈ [√½, √2) and a small correction term __c.
       template <__vec_builtin _TV>
-        _GLIBCXX_SIMD_INTRINSIC static constexpr _MaskMember<_TV>
-        _S_signbit(_TV __x)
+        _GLIBCXX_SIMD_INTRINSIC static constexpr _TV
+        _S_log1p_reduced(_TV __f, _TV __c)
         {
           using _Tp = __value_type_of<_TV>;
-          using _IV = __vec_builtin_type<__make_signed_int_t<_Tp>, _S_full_size>;
-          return __builtin_bit_cast(_IV, __x) < 0;
-          // Arithmetic right shift (SRA) would also work (instead of compare), but
-          // 64-bit SRA isn't available on x86 before AVX512. And in general,
-          // compares are more likely to be efficient than SRA.
+          const _TV __hfsq = _Tp(.5) * __f * __f;
+          return __f - (__hfsq - (_S_log1p_poly(__f, __hfsq) + __c));
         }
 
+      // Returns log1p(__f) as __hi + __lo for 1 + __f ∈ [√½, √2), where the low mantissa bits
+      // of __hi are zero. Thus, __hi can be multiplied exactly with the "hi" constants in
+      // _S_log2 and _S_log10.
       template <__vec_builtin _TV>
-        _GLIBCXX_SIMD_INTRINSIC static constexpr _MaskMember<_TV>
-        _S_isinf([[maybe_unused]] _TV __x)
+        _GLIBCXX_SIMD_INTRINSIC static constexpr _TV
+        _S_log1p_reduced_split(_TV __f, _TV& __lo)
         {
-#if __FINITE_MATH_ONLY__
-          return {}; // false
-#else
           using _Tp = __value_type_of<_TV>;
-          return _SuperImpl::_S_equal_to(_SuperImpl::_S_abs(__x),
-                                         __vec_broadcast<_S_size>(__infinity_v<_Tp>));
-          // alternative:
-          // compare to inf using the corresponding integer type
-          /*
-             return
-             __vector_bitcast<_Tp>(__vector_bitcast<__make_signed_int_t<_Tp>>(
-          _S_abs(__x))
-          ==
-          __vector_bitcast<__make_signed_int_t<_Tp>>(__vec_broadcast<_Np>(
-          __infinity_v<_Tp>)));
-           */
-#endif
+          using _Up = __make_unsigned_int_t<_Tp>;
+          constexpr _TV __hi_mask
+            = __builtin_bit_cast(_TV, __vec_broadcast<__width_of<_TV>>(
+                                        _Up(sizeof(_Tp) == sizeof(float)
+                                              ? 0xffff'f000u : 0xffff'ffff'0000'0000ull)));
+          const _TV __hfsq = _Tp(.5) * __f * __f;
+          const _TV __hi = __vec_and(__f - __hfsq, __hi_mask);
+          __lo = __builtin_assoc_barrier(__f - __hi) - __hfsq + _S_log1p_poly(__f, __hfsq);
+          return __hi;
         }
 
+      // Returns expm1(__r) for |__r| <= ln2/2.
       template <__vec_builtin _TV>
-        _GLIBCXX_SIMD_INTRINSIC static constexpr _MaskMember<_TV>
-        _S_isnormal(_TV __x)
+        _GLIBCXX_SIMD_INTRINSIC static constexpr _TV
+        _S_expm1_reduced(_TV __r)
         {
           using _Tp = __value_type_of<_TV>;
-          using _IV = __vec_builtin_type<__make_signed_int_t<_Tp>, _S_full_size>;
-          const auto __absn = __builtin_bit_cast(_IV, _SuperImpl::_S_abs(__x));
-          const auto __minn = __builtin_bit_cast(
-                                _IV, __vec_broadcast<_S_size>(__norm_min_v<_Tp>));
-#if __FINITE_MATH_ONLY__
-          return __absn >= __minn;
-#else
-          const auto __maxn
-            = __builtin_bit_cast(_IV, __vec_broadcast<_S_size>(__finite_max_v<_Tp>));
-          return __minn <= __absn and __absn <= __maxn;
-#endif
+          if constexpr (sizeof(_Tp) == sizeof(float))
+            // Cephes expf
+            return __r + __r * __r * _S_horner(__r, 1.9875691500e-4f, 1.3981999507e-3f,
+                                                8.3334519073e-3f, 4.1665795894e-2f,
+                                                1.6666665459e-1f, 5.0000001201e-1f);
+          else if constexpr (sizeof(_Tp) == sizeof(double))
+            // Taylor series up to r^13: truncation error < 0.1 ULP
+            return __r + __r * __r * _S_horner(__r, 1. / 6227020800, 1. / 479001600,
+                                                1. / 39916800, 1. / 3628800, 1. / 362880,
+                                                1. / 40320, 1. / 5040, 1. / 720, 1. / 120,
+                                                1. / 24, 1. / 6, .5);
+          else
+            static_assert(false);
         }
 
+      // Returns __r = __x - __n * ln2 with |__r| <= ln2/2 and __n integral-valued.
+      // The input is clamped such that exp(__x) is zero (or -ffast-math: flushed to zero) for all
+      // values below and infinite (-ffast-math: largest exponent) for all values above the range.
       template <__vec_builtin _TV>
-        _GLIBCXX_SIMD_INTRINSIC static constexpr
-        typename _Abi::template _Rebind<__make_dependent_t<int, _TV>>::template _SimdMember<int>
-        _S_fpclassify(_TV __x)
+        _GLIBCXX_SIMD_INTRINSIC static constexpr _TV
+        _S_exp_reduce(_TV __x, _TV& __n)
         {
-          using _RAbi = typename _Abi::template _Rebind<int>;
-          using _RV = typename _RAbi::template _SimdMember<int>;
           using _Tp = __value_type_of<_TV>;
-          using _Ip = __make_signed_int_t<_Tp>;
-          using _IV = __vec_builtin_type<_Ip, _S_full_size>;
-          const auto __xn = __builtin_bit_cast(_IV, _SuperImpl::_S_abs(__x));
-          constexpr size_t _NI = sizeof(__xn) / sizeof(_Ip);
-          constexpr auto __minn = __builtin_bit_cast(_IV, __vec_broadcast<_NI>(__norm_min_v<_Tp>));
-          constexpr auto __fp_normal = __vec_broadcast<_NI, _Ip>(FP_NORMAL);
-#if !__FINITE_MATH_ONLY__
-          constexpr auto __infn = __builtin_bit_cast(_IV, __vec_broadcast<_NI>(__infinity_v<_Tp>));
-          constexpr auto __fp_nan = __vec_broadcast<_NI, _Ip>(FP_NAN);
-          constexpr auto __fp_infinite = __vec_broadcast<_NI, _Ip>(FP_INFINITE);
-#endif
-#ifndef __FAST_MATH__
-          constexpr auto __fp_subnormal = __vec_broadcast<_NI, _Ip>(FP_SUBNORMAL);
-#endif
-          constexpr auto __fp_zero = __vec_broadcast<_NI, _Ip>(FP_ZERO);
-          _IV __tmp = (__xn < __minn)
+          constexpr bool __is_float = sizeof(_Tp) == sizeof(float);
+          constexpr _Tp __ln2 = 0x1.62e42fefa39efp-1;
+          // __ln2_hi has enough trailing zeros for __n * __ln2_hi to be exact
+          constexpr _Tp __ln2_hi = __is_float ? 0x1.62e4p-1 : 0x1.62e42feep-1;
+          constexpr _Tp __ln2_lo = __is_float ? 0x1.7f7d1cp-20 : 0x1.a39ef35793c76p-33;
 #ifdef __FAST_MATH__
-                        ? __fp_zero
+          constexpr _Tp __lo = (__min_exponent_v<_Tp> - 2) * __ln2;
+          constexpr _Tp __hi = (__max_exponent_v<_Tp> - 1) * __ln2;
 #else
-                        ? (__xn == 0 ? __fp_zero : __fp_subnormal)
+          constexpr _Tp __lo = (__min_exponent_v<_Tp> - __digits_v<_Tp> - 2) * __ln2;
+          constexpr _Tp __hi = (__max_exponent_v<_Tp> + 1) * __ln2;
 #endif
+          constexpr _Tp __shifter = 0x1.8p0 * (1ull << (__digits_v<_Tp> - 1));
+          __x = __x < __lo ? _TV() + __lo : __x;
+          __x = __x > __hi ? _TV() + __hi : __x;
+          __n = _S_plus_minus(__x * _Tp(0x1.71547652b82fep0), __shifter);
+          return __builtin_assoc_barrier(__x - __n * __ln2_hi) - __n * __ln2_lo;
+        }
+
+      // Returns __r for positive finite __x. Otherwise returns what log(__x) must return for
+      // zero, negative, infinite, and NaN arguments.
+      template <__vec_builtin _TV>
+        _GLIBCXX_SIMD_INTRINSIC static constexpr _TV
+        _S_log_special_values([[maybe_unused]] _TV __x, _TV __r)
+        {
 #if __FINITE_MATH_ONLY__
-                        : __fp_normal;
+          return __r;
 #else
-                        : (__xn < __infn ? __fp_normal
-                                         : (__xn == __infn ? __fp_infinite : __fp_nan));
+          using _Tp = __value_type_of<_TV>;
+          __r = __x == _Tp() ? _TV() - __infinity_v<_Tp> : __r;
+          __r = __x < _Tp() ? _TV() + __quiet_NaN_v<_Tp> : __r;
+          return __x < __infinity_v<_Tp> ? __r : __x;
 #endif
-          if constexpr (is_same_v<_IV, _RV>)
-            return __tmp;
-          else if constexpr (__vec_builtin<_RV>)
-            return __builtin_convertvector(__tmp, _RV);
-          else
-            return _RAbi::template _S_generator<int>([&] [[__gnu__::__always_inline__]] (auto __i) {
-                     return static_cast<int>(__tmp[__i]);
-                   });
+        }
+
+      // [c.math] exponential and logarithmic functions
+      template <__vec_builtin _TV>
+        requires is_floating_point_v<__value_type_of<_TV>>
+        _GLIBCXX_SIMD_INTRINSIC static constexpr _TV
+        _S_exp(_TV __x)
+        {
+          using _Tp = __value_type_of<_TV>;
+          _TV __n;
+          const _TV __r = _S_exp_reduce(__x, __n);
+          return _SuperImpl::_S_ldexp_fp(_Tp(1) + _S_expm1_reduced(__r), __n);
+        }
+
+      template <__vec_builtin _TV>
+        requires is_floating_point_v<__value_type_of<_TV>>
+        _GLIBCXX_SIMD_INTRINSIC static constexpr _TV
+        _S_expm1(_TV __x)
+        {
+          using _Tp = __value_type_of<_TV>;
+          // below __lo the result rounds to -1
+          constexpr _Tp __lo = -(__digits_v<_Tp> + 2) * _Tp(0x1.62e42fefa39efp-1);
+          _TV __n;
+          const _TV __r = _S_exp_reduce(__x < __lo ? _TV() + __lo : __x, __n);
+          // expm1(x) = 2^n * (expm1(r) + 1 - 2^-n)
+          const _TV __ret = _SuperImpl::_S_ldexp_fp(
+                              _S_expm1_reduced(__r) + __builtin_assoc_barrier(
+                                                        _Tp(1) - _SuperImpl::_S_ldexp_fp(_TV() + 1, -__n)),
+                              __n);
+#ifdef __FAST_MATH__
+          return __ret;
+#else
+          return __x == _Tp() ? __x : __ret; // preserve the sign of zero
+#endif
+        }
+
+      template <__vec_builtin _TV>
+        requires is_floating_point_v<__value_type_of<_TV>>
+        _GLIBCXX_SIMD_INTRINSIC static constexpr _TV
+        _S_log(_TV __x)
+        {
+          using _Tp = __value_type_of<_TV>;
+          constexpr bool __is_float = sizeof(_Tp) == sizeof(float);
+          constexpr _Tp __ln2_hi = __is_float ? 0x1.62e4p-1 : 0x1.62e42feep-1;
+          constexpr _Tp __ln2_lo = __is_float ? 0x1.7f7d1cp-20 : 0x1.a39ef35793c76p-33;
+          _TV __k;
+          const _TV __f = _SuperImpl::_S_log_reduce(__x, __k) - _Tp(1);
+          return _S_log_special_values(
+                   __x, __k * __ln2_hi + _S_log1p_reduced(__f, __k * __ln2_lo));
+        }
+
+      template <__vec_builtin _TV>
+        requires is_floating_point_v<__value_type_of<_TV>>
+        _GLIBCXX_SIMD_INTRINSIC static constexpr _TV
+        _S_log2(_TV __x)
+        {
+          using _Tp = __value_type_of<_TV>;
+          _TV __k;
+          const _TV __f = _SuperImpl::_S_log_reduce(__x, __k) - _Tp(1);
+          constexpr bool __is_float = sizeof(_Tp) == sizeof(float);
+          // 1/ln2 split into a part with zeros in the low mantissa bits and the rest
+          constexpr _Tp __ivln2_hi = __is_float ? 0x1.716p0 : 0x1.71547652p0;
+          constexpr _Tp __ivln2_lo = __is_float ? -0x1.7135a8p-13 : 0x1.705fc2eefa2p-33;
+          _TV __lo;
+          const _TV __hi = _S_log1p_reduced_split(__f, __lo);
+          const _TV __val_hi = __hi * __ivln2_hi;
+          const _TV __val_lo = (__lo + __hi) * __ivln2_lo + __lo * __ivln2_hi;
+          const _TV __w = __builtin_assoc_barrier(__k + __val_hi);
+          return _S_log_special_values(
+                   __x, __val_lo + (__builtin_assoc_barrier(__k - __w) + __val_hi) + __w);
+        }
+
+      template <__vec_builtin _TV>
+        requires is_floating_point_v<__value_type_of<_TV>>
+        _GLIBCXX_SIMD_INTRINSIC static constexpr _TV
+        _S_log10(_TV __x)
+        {
+          using _Tp = __value_type_of<_TV>;
+          constexpr bool __is_float = sizeof(_Tp) == sizeof(float);
+          // log10(2) and 1/ln10 split into a part with zeros in the low mantissa bits and the rest
+          constexpr _Tp __log10_2_hi = __is_float ? 0x1.3441p-2 : 0x1.34413509f6p-2;
+          constexpr _Tp __log10_2_lo = __is_float ? 0x1.a84fb6p-21 : 0x1.9fef311f12b36p-42;
+          constexpr _Tp __ivln10_hi = __is_float ? 0x1.bccp-2 : 0x1.bcb7b152p-2;
+          constexpr _Tp __ivln10_lo = __is_float ? -0x1.09d5b2p-15 : 0x1.b9438ca9aadd5p-36;
+          _TV __k;
+          const _TV __f = _SuperImpl::_S_log_reduce(__x, __k) - _Tp(1);
+          _TV __lo;
+          const _TV __hi = _S_log1p_reduced_split(__f, __lo);
+          const _TV __y2 = __k * __log10_2_hi;
+          const _TV __val_hi = __hi * __ivln10_hi;
+          const _TV __val_lo = __k * __log10_2_lo + (__lo + __hi) * __ivln10_lo
+                                 + __lo * __ivln10_hi;
+          const _TV __w = __builtin_assoc_barrier(__y2 + __val_hi);
+          return _S_log_special_values(
+                   __x, __val_lo + (__builtin_assoc_barrier(__y2 - __w) + __val_hi) + __w);
+        }
+
+      template <__vec_builtin _TV>
+        requires is_floating_point_v<__value_type_of<_TV>>
+        _GLIBCXX_SIMD_INTRINSIC static constexpr _TV
+        _S_log1p(_TV __x)
+        {
+          using _Tp = __value_type_of<_TV>;
+          constexpr bool __is_float = sizeof(_Tp) == sizeof(float);
+          constexpr _Tp __ln2_hi = __is_float ? 0x1.62e4p-1 : 0x1.62e42feep-1;
+          constexpr _Tp __ln2_lo = __is_float ? 0x1.7f7d1cp-20 : 0x1.a39ef35793c76p-33;
+          const _TV __u = __builtin_assoc_barrier(__x + _Tp(1));
+          _TV __k;
+          const _TV __f = _SuperImpl::_S_log_reduce(__u, __k) - _Tp(1);
+          // The rounding error of 1 + x, relative to u, corrects the result (log(u + c) ≈ log(u)
+          // + c/u). Beyond 2^digits it is irrelevant.
+          _TV __c = __k > _Tp() ? _Tp(1) - __builtin_assoc_barrier(__u - __x)
+                                : __x - __builtin_assoc_barrier(__u - _Tp(1));
+          __c = __k < _Tp(__digits_v<_Tp>) ? __c / __u : _TV();
+          const _TV __ret = _S_log_special_values(
+                              __u, __k * __ln2_hi + _S_log1p_reduced(__f, __k * __ln2_lo + __c));
+#ifdef __FAST_MATH__
+          return __ret;
+#else
+          return __x == _Tp() ? __x : __ret; // preserve the sign of zero
+#endif
+        }
+
+      template <__vec_builtin _TV>
+        requires is_floating_point_v<__value_type_of<_TV>>
+        _GLIBCXX_SIMD_INTRINSIC static constexpr _TV
+        _S_exp2(_TV __x)
+        {
+          using _Tp = __value_type_of<_TV>;
+#ifdef __FAST_MATH__
+          constexpr _Tp __lo = __min_exponent_v<_Tp> - 2;
+          constexpr _Tp __hi = __max_exponent_v<_Tp> - 1;
+#else
+          constexpr _Tp __lo = __min_exponent_v<_Tp> - __digits_v<_Tp> - 2;
+          constexpr _Tp __hi = __max_exponent_v<_Tp> + 1;
+#endif
+          constexpr _Tp __shifter = 0x1.8p0 * (1ull << (__digits_v<_Tp> - 1));
+          __x = __x < __lo ? _TV() + __lo : __x;
+          __x = __x > __hi ? _TV() + __hi : __x;
+          const _TV __n = _S_plus_minus(__x, __shifter);
+          const _TV __r = (__x - __builtin_assoc_barrier(__n)) * _Tp(0x1.62e42fefa39efp-1);
+          return _SuperImpl::_S_ldexp_fp(_Tp(1) + _S_expm1_reduced(__r), __n);
+        }
+
+      // Returns __a * __b as __hi + __lo with __hi = fl(__a * __b) (Dekker's algorithm, no FMA
+      // required). Precondition: |__a| and |__b| are small enough that splitting them does not
+      // overflow.
+      template <__vec_builtin _TV>
+        _GLIBCXX_SIMD_INTRINSIC static constexpr _TV
+        _S_two_prod(_TV __a, _TV __b, _TV& __lo)
+        {
+          using _Tp = __value_type_of<_TV>;
+          constexpr _Tp __splitter = (1ull << ((__digits_v<_Tp> + 1) / 2)) + 1;
+          // the barrier on the product inhibits contraction of __c - __v to an FMA, which would
+          // break the split
+          auto __upper_half = [](_TV __v) {
+            const _TV __c = __builtin_assoc_barrier(__v * __splitter);
+            return __builtin_assoc_barrier(__c - __builtin_assoc_barrier(__c - __v));
+          };
+          const _TV __ah = __upper_half(__a);
+          const _TV __bh = __upper_half(__b);
+          const _TV __al = __a - __ah;
+          const _TV __bl = __b - __bh;
+          const _TV __hi = __a * __b;
+          __lo = __builtin_assoc_barrier(__builtin_assoc_barrier(__ah * __bh - __hi)
+                                           + __ah * __bl + __al * __bh) + __al * __bl;
+          return __hi;
+        }
+
+      // Returns __a + __b as __hi + __lo with __hi = fl(__a + __b) (Knuth's branch-free two-sum).
+      template <__vec_builtin _TV>
+        _GLIBCXX_SIMD_INTRINSIC static constexpr _TV
+        _S_two_sum(_TV __a, _TV __b, _TV& __lo)
+        {
+          const _TV __hi = __builtin_assoc_barrier(__a + __b);
+          const _TV __bv = __builtin_assoc_barrier(__hi - __a);
+          __lo = __builtin_assoc_barrier(__a - __builtin_assoc_barrier(__hi - __bv))
+                   + __builtin_assoc_barrier(__b - __bv);
+          return __hi;
+        }
+
+      // Returns whether any element of the vector comparison result __k is non-zero. Unlike
+      // _S_to_bits this does not depend on _Abi and therefore also works inside _S_as_double.
+      template <__vec_builtin _TV>
+        _GLIBCXX_SIMD_INTRINSIC static constexpr bool
+        _S_vec_any_of(_TV __k)
+        {
+          return _GLIBCXX_SIMD_INT_PACK(__width_of<_TV>, _Is, {
+                   return ((__vec_get(__k, _Is) != 0) | ...);
+                 });
+        }
+
+      // Evaluates __fun on float vectors converted to double and returns the result converted back
+      // to float. Vectors of 16 Bytes or more are split such that every double vector has the size
+      // of __x.
+      template <__vec_builtin _TV, same_as<_TV>... _More>
+        _GLIBCXX_SIMD_INTRINSIC static _TV
+        _S_as_double(auto __fun, _TV __x, _More... __more)
+        {
+          static_assert(is_same_v<__value_type_of<_TV>, float>);
+          auto __eval = [&](auto __x0, auto... __more0) {
+            return __vec_convert<float>(__fun(__vec_convert<double>(__x0),
+                                              __vec_convert<double>(__more0)...));
+          };
+          if constexpr (sizeof(_TV) < 16)
+            return __eval(__x, __more...);
+          else
+            return __vec_concat(__eval(__vec_extract_part<0, 2>(__x),
+                                       __vec_extract_part<0, 2>(__more)...),
+                                __eval(__vec_extract_part<1, 2>(__x),
+                                       __vec_extract_part<1, 2>(__more)...));
+        }
+
+      template <__vec_builtin _TV>
+        requires is_floating_point_v<__value_type_of<_TV>>
+        _GLIBCXX_SIMD_INTRINSIC static constexpr _TV
+        _S_sqrt(_TV __x)
+        {
+          for (int __i = 0; __i < __width_of<_TV>; ++__i)
+            {
+              if constexpr (sizeof(__x[0]) == sizeof(float))
+                __x[__i] = __builtin_sqrtf(__x[__i]);
+              else if constexpr (sizeof(__x[0]) == sizeof(double))
+                __x[__i] = __builtin_sqrt(__x[__i]);
+              else
+                static_assert(false);
+            }
+          return __x;
+        }
+
+      // Returns log2(__x) as __hi + __lo with a relative error below 2^-63 for finite positive
+      // double __x. The significand is reduced to m ∈ [√(2/3), √3) and split at √1.5 into m/bp,
+      // bp ∈ {1, 1.5}; log(m/bp) = 2 atanh(s) with s = (m - bp) / (m + bp) is evaluated in
+      // double-double (cf. FreeBSD's e_pow.c).
+      template <__vec_builtin _TV>
+        _GLIBCXX_SIMD_INTRINSIC static constexpr _TV
+        _S_log2_dd(_TV __x, _TV& __lo)
+        {
+          using _Tp = __value_type_of<_TV>;
+          static_assert(sizeof(_Tp) == sizeof(double));
+          _TV __k;
+          _TV __m = _SuperImpl::_S_log_reduce(__x, __k);
+          const auto __small = __m < _Tp(0x1.a20bd700c2c3ep-1);
+          __m = __small ? __m * _Tp(2) : __m;
+          __k = __small ? __k - _Tp(1) : __k;
+          const auto __b15 = __m >= _Tp(0x1.3988e1409212ep0);
+          const _TV __bp = __b15 ? _TV() + 1.5 : _TV() + 1;
+          // log2(1.5) = __lb_hi + __lb_lo
+          const _TV __lb_hi = __b15 ? _TV() + 5.84962487220764160156e-01 : _TV();
+          const _TV __lb_lo = __b15 ? _TV() + 1.35003920212974897128e-08 : _TV();
+          // s + sl = (m - bp) / (m + bp)
+          const _TV __u = __m - __bp;
+          _TV __vl;
+          const _TV __vh = _S_two_sum(__m, __bp, __vl);
+          const _TV __s = __u / __vh;
+          _TV __se;
+          const _TV __sp = _S_two_prod(__s, __vh, __se);
+          const _TV __sl = (__builtin_assoc_barrier(__builtin_assoc_barrier(__u - __sp) - __se)
+                              - __s * __vl) / __vh;
+          // log(m/bp) = 2s + 2sl(1 + s²) + 2/3 s³ + 2/3 s R(s²)
+          _TV __zl;
+          const _TV __z = _S_two_prod(__s, __s, __zl);
+          const _TV __r = __z * __z * _S_horner(__z, 2.06975017800338417784e-01,
+                                                2.30660745775561754067e-01,
+                                                2.72728123808534006489e-01,
+                                                3.33333329818377432918e-01,
+                                                4.28571428578550184252e-01,
+                                                5.99999999999994648725e-01);
+          constexpr _Tp __two_thirds_hi = 0x1.5555555555555p-1;
+          constexpr _Tp __two_thirds_lo = 0x1.5555555555555p-55;
+          _TV __ce;
+          const _TV __c = _S_two_prod(__s, __z, __ce);
+          __ce += __s * __zl;
+          _TV __te;
+          const _TV __t = _S_two_prod(__c, _TV() + __two_thirds_hi, __te);
+          __te += __c * __two_thirds_lo + __ce * __two_thirds_hi;
+          _TV __l1l;
+          _TV __l1 = _S_two_sum(_Tp(2) * __s, __t, __l1l);
+          __l1l += __te + _Tp(2) * __sl * (_Tp(1) + __z) + __two_thirds_hi * __s * __r;
+          __l1 = _S_two_sum(__l1, __l1l, __l1l);
+          // multiply by 1/ln2 = __ivln2_hi + __ivln2_lo
+          constexpr _Tp __ivln2_hi = 0x1.71547652b82fep0;
+          constexpr _Tp __ivln2_lo = 0x1.777d0ffda0d24p-56;
+          _TV __pe;
+          const _TV __ph = _S_two_prod(__l1, _TV() + __ivln2_hi, __pe);
+          __pe += __l1 * __ivln2_lo + __l1l * __ivln2_hi;
+          // __k + __lb_hi is exact
+          _TV __sl2;
+          const _TV __sh = _S_two_sum(__k + __lb_hi, __ph, __sl2);
+          return _S_two_sum(__sh, __sl2 + __pe + __lb_lo, __lo);
+        }
+
+      // Returns 2^(__hi + __lo) for |__lo| <= ulp(__hi).
+      template <__vec_builtin _TV>
+        _GLIBCXX_SIMD_INTRINSIC static constexpr _TV
+        _S_exp2_dd(_TV __hi, _TV __lo)
+        {
+          using _Tp = __value_type_of<_TV>;
+#ifdef __FAST_MATH__
+          constexpr _Tp __min = __min_exponent_v<_Tp> - 2;
+          constexpr _Tp __max = __max_exponent_v<_Tp> - 1;
+#else
+          constexpr _Tp __min = __min_exponent_v<_Tp> - __digits_v<_Tp> - 2;
+          constexpr _Tp __max = __max_exponent_v<_Tp> + 1;
+#endif
+          constexpr _Tp __shifter = 0x1.8p0 * (1ull << (__digits_v<_Tp> - 1));
+          // ln2 = __ln2_hi + __ln2_lo
+          constexpr _Tp __ln2_hi = 0x1.62e42fefa39efp-1;
+          constexpr _Tp __ln2_lo = 0x1.abc9e3b39803fp-56;
+          __hi = __hi < __min ? _TV() + __min : __hi;
+          __hi = __hi > __max ? _TV() + __max : __hi;
+          const _TV __n = _S_plus_minus(__hi, __shifter);
+          const _TV __r = __builtin_assoc_barrier(__hi - __builtin_assoc_barrier(__n)) + __lo;
+          return _SuperImpl::_S_ldexp_fp(
+                   _Tp(1) + _S_expm1_reduced(__r * __ln2_hi + __r * __ln2_lo), __n);
+        }
+
+      // Maps log2(|x|) for the pow kernels: zero yields -inf (-ffinite-math-only: -max), inf and
+      // NaN yield inf and NaN.
+      template <__vec_builtin _TV>
+        _GLIBCXX_SIMD_INTRINSIC static constexpr _TV
+        _S_pow_log2_special_values(_TV __ax, _TV __l)
+        {
+          using _Tp = __value_type_of<_TV>;
+#if __FINITE_MATH_ONLY__
+          return __ax == _Tp() ? _TV() - __finite_max_v<_Tp> : __l;
+#else
+          __l = __ax == _Tp() ? _TV() - __infinity_v<_Tp> : __l;
+          return __ax < __infinity_v<_Tp> ? __l : __ax;
+#endif
+        }
+
+      // [c.math] power and absolute-value functions
+      template <__vec_builtin _TV>
+        requires is_floating_point_v<__value_type_of<_TV>>
+        _GLIBCXX_SIMD_INTRINSIC static _TV
+        _S_pow(_TV __x, _TV __y)
+        {
+          using _Tp = __value_type_of<_TV>;
+          const _TV __ax = _S_fabs(__x);
+          _TV __r;
+          if constexpr (sizeof(_Tp) == sizeof(float))
+            // y * log2(x) in double is exact enough for a correctly rounded float result in all
+            // but a few cases
+            __r = _S_as_double([](auto __xd, auto __yd) {
+                    const auto __l = _S_pow_log2_special_values(__xd, _SuperImpl::_S_log2(__xd));
+                    return _SuperImpl::_S_exp2(__yd * __l);
+                  }, __ax, __y);
+          else if constexpr (sizeof(_Tp) == sizeof(double))
+            {
+              _TV __llo;
+              const _TV __lhi = _S_pow_log2_special_values(__ax, _S_log2_dd(__ax, __llo));
+              _TV __tlo;
+              const _TV __thi = _S_two_prod(__y, __lhi, __tlo);
+              // Beyond |y log2(x)| = 2048 the result is 0 or inf (and __tlo might be NaN because
+              // splitting __y overflowed).
+              __tlo = _S_fabs(__thi) < _Tp(2048) ? __tlo + __y * __llo : _TV();
+              __r = _S_exp2_dd(__thi, __tlo);
+            }
+          else
+            static_assert(false);
+          // integral exponents: negative bases are valid and odd exponents keep the sign
+          using _IV = __vec_builtin_type<__make_signed_int_t<_Tp>, __width_of<_TV>>;
+          const _TV __yh = __y * _Tp(.5);
+          const auto __y_noninteger = _SuperImpl::_S_trunc(__y) != __y;
+          const auto __y_odd = __vec_andnot(__y_noninteger, _SuperImpl::_S_trunc(__yh) != __yh);
+          __r = (__builtin_bit_cast(_IV, __x) < 0) & __y_odd ? -__r : __r;
+#if !__FINITE_MATH_ONLY__
+          __r = (__x < _Tp()) & (__x > -__infinity_v<_Tp>) & __y_noninteger
+                  ? _TV() + __quiet_NaN_v<_Tp> : __r;
+          __r = (__ax == _Tp(1)) & (_S_fabs(__y) == __infinity_v<_Tp>) ? _TV() + 1 : __r;
+#endif
+          return (__y == _Tp()) | (__x == _Tp(1)) ? _TV() + 1 : __r;
+        }
+
+      template <__vec_builtin _TV>
+        requires is_floating_point_v<__value_type_of<_TV>>
+        _GLIBCXX_SIMD_INTRINSIC static constexpr _TV
+        _S_cbrt(_TV __x)
+        {
+          using _Tp = __value_type_of<_TV>;
+          const _TV __ax = _S_fabs(__x);
+          // |x| = f 2^k = m 2^3q with k = 3q + rem, rem ∈ {-1, 0, 1}
+          _TV __k;
+          const _TV __f = _SuperImpl::_S_log_reduce(__ax, __k);
+          constexpr _Tp __shifter = 0x1.8p0 * (1ull << (__digits_v<_Tp> - 1));
+          const _TV __q = _S_plus_minus(__k * _Tp(1. / 3), __shifter);
+          const _TV __rem = __k - _Tp(3) * __builtin_assoc_barrier(__q);
+          const _TV __m = __f * (__rem < _Tp() ? _TV() + _Tp(.5)
+                                               : __rem > _Tp() ? _TV() + _Tp(2) : _TV() + _Tp(1));
+          // minimax approximation of cbrt on [√½/2, 2√2), refined with Halley's method (cubic
+          // convergence): one step suffices for float, double needs two
+          _TV __y = _S_horner(__m, -0x1.4033172ee1347p-6, 0x1.39dc71d6e1c17p-3,
+                              -0x1.e50c349e7aed6p-2, 0x1.cbde0cb757632p-1, 0x1.c64519b50d212p-2);
+          auto __halley = [&] {
+            const _TV __y3 = __y * __y * __y;
+            __y += __y * (__m - __y3) / (_Tp(2) * __y3 + __m);
+          };
+          __halley();
+          if constexpr (sizeof(_Tp) == sizeof(double))
+            __halley();
+          const _TV __r = __vec_or(__vec_xor(__ax, __x), _SuperImpl::_S_ldexp_fp(__y, __q));
+#if __FINITE_MATH_ONLY__
+          return __ax > _Tp() ? __r : __x;
+#else
+          return (__ax > _Tp()) & (__ax < __infinity_v<_Tp>) ? __r : __x + __x;
+#endif
+        }
+
+      // Returns the correction of __h = √(a² + b² (+ c²)) to the square root of the exact sum,
+      // where __err = h² - (a² + b² (+ c²)) was computed exactly enough.
+      template <__vec_builtin _TV>
+        _GLIBCXX_SIMD_INTRINSIC static constexpr _TV
+        _S_hypot_correct(_TV __h, _TV __err)
+        {
+          using _Tp = __value_type_of<_TV>;
+          return __h == _Tp() ? __h : __h - __err / (_Tp(2) * __h);
+        }
+
+      // Scale factors that avoid overflow and underflow of the squares in _S_hypot. The scaling
+      // is exact (powers of two) and the factor for the result is stored to __unscale.
+      template <__vec_builtin _TV>
+        _GLIBCXX_SIMD_INTRINSIC static constexpr _TV
+        _S_hypot_scale(_TV __max, _TV& __unscale)
+        {
+          using _Tp = __value_type_of<_TV>;
+          const auto __large = __max > _Tp(0x1p500);
+          const auto __small = __max < _Tp(0x1p-500);
+          __unscale = __large ? _TV() + 0x1p600 : __small ? _TV() + 0x1p-600 : _TV() + 1;
+          return __large ? _TV() + 0x1p-600 : __small ? _TV() + 0x1p600 : _TV() + 1;
+        }
+
+      template <__vec_builtin _TV>
+        requires is_floating_point_v<__value_type_of<_TV>>
+        _GLIBCXX_SIMD_INTRINSIC static _TV
+        _S_hypot(_TV __x, _TV __y)
+        {
+          using _Tp = __value_type_of<_TV>;
+          const _TV __ax = _S_fabs(__x);
+          const _TV __ay = _S_fabs(__y);
+          _TV __r;
+          if constexpr (sizeof(_Tp) == sizeof(float))
+            // the sum of squares is exact in double, the square root rounds twice
+            __r = _S_as_double([](auto __a, auto __b) {
+                    return _SuperImpl::_S_sqrt(__a * __a + __b * __b);
+                  }, __ax, __ay);
+          else if constexpr (sizeof(_Tp) == sizeof(double))
+            {
+              _TV __unscale;
+              const _TV __scale = _S_hypot_scale(__ax > __ay ? __ax : __ay, __unscale);
+              // NaN inputs end up in __b
+              const _TV __a = (__ax > __ay ? __ax : __ay) * __scale;
+              const _TV __b = (__ax > __ay ? __ay : __ax) * __scale;
+              const _TV __h = _SuperImpl::_S_sqrt(__a * __a + __b * __b);
+              _TV __hl, __al, __bl;
+              const _TV __hh = _S_two_prod(__h, __h, __hl);
+              const _TV __ah = _S_two_prod(__a, __a, __al);
+              const _TV __bh = _S_two_prod(__b, __b, __bl);
+              const _TV __err = __builtin_assoc_barrier(__builtin_assoc_barrier(
+                                  __builtin_assoc_barrier(__hh - __ah) - __bh) - __bl)
+                                  + __hl - __al;
+              __r = _S_hypot_correct(__h, __err) * __unscale;
+            }
+          else
+            static_assert(false);
+#if __FINITE_MATH_ONLY__
+          return __r;
+#else
+          return (__ax == __infinity_v<_Tp>) | (__ay == __infinity_v<_Tp>)
+                   ? _TV() + __infinity_v<_Tp> : __r;
+#endif
+        }
+
+      template <__vec_builtin _TV>
+        requires is_floating_point_v<__value_type_of<_TV>>
+        _GLIBCXX_SIMD_INTRINSIC static _TV
+        _S_hypot(_TV __x, _TV __y, _TV __z)
+        {
+          using _Tp = __value_type_of<_TV>;
+          _TV __ax = _S_fabs(__x);
+          _TV __ay = _S_fabs(__y);
+          _TV __az = _S_fabs(__z);
+          _TV __r;
+          if constexpr (sizeof(_Tp) == sizeof(float))
+            __r = _S_as_double([](auto __a, auto __b, auto __c) {
+                    return _SuperImpl::_S_sqrt(__a * __a + __b * __b + __c * __c);
+                  }, __ax, __ay, __az);
+          else if constexpr (sizeof(_Tp) == sizeof(double))
+            {
+              // sort such that __a >= __b >= __c (NaNs are moved, not dropped)
+              auto __sort2 = [](_TV& __hi, _TV& __lo) {
+                const auto __swap = __lo > __hi;
+                const _TV __tmp = __swap ? __lo : __hi;
+                __lo = __swap ? __hi : __lo;
+                __hi = __tmp;
+              };
+              __sort2(__ax, __ay);
+              __sort2(__ay, __az);
+              __sort2(__ax, __ay);
+              _TV __unscale;
+              const _TV __scale = _S_hypot_scale(__ax, __unscale);
+              const _TV __a = __ax * __scale;
+              const _TV __b = __ay * __scale;
+              const _TV __c = __az * __scale;
+              const _TV __h = _SuperImpl::_S_sqrt(__a * __a + (__b * __b + __c * __c));
+              _TV __hl, __al, __bl, __cl;
+              const _TV __hh = _S_two_prod(__h, __h, __hl);
+              const _TV __ah = _S_two_prod(__a, __a, __al);
+              const _TV __bh = _S_two_prod(__b, __b, __bl);
+              const _TV __ch = _S_two_prod(__c, __c, __cl);
+              const _TV __err = __builtin_assoc_barrier(__builtin_assoc_barrier(
+                                  __builtin_assoc_barrier(__hh - __ah) - __bh) - __ch)
+                                  - (__bl + __cl) + (__hl - __al);
+              __r = _S_hypot_correct(__h, __err) * __unscale;
+            }
+          else
+            static_assert(false);
+#if __FINITE_MATH_ONLY__
+          return __r;
+#else
+          return (__ax == __infinity_v<_Tp>) | (__ay == __infinity_v<_Tp>)
+                   | (__az == __infinity_v<_Tp>) ? _TV() + __infinity_v<_Tp> : __r;
+#endif
+        }
+
+      // Lanes with |__x| above this value are not reduced by _S_trig_reduce. It ensures that
+      // __n * __pio2_N in _S_trig_reduce is exact.
+      template <typename _Tp>
+        static constexpr _Tp _S_trig_reduce_max = sizeof(_Tp) == sizeof(float) ? 0x1p12 : 0x1p20;
+
+      // Cody-Waite reduction of __x by π/2 in three steps (cf. FreeBSD's e_rem_pio2.c). Returns
+      // the reduced argument as __hi + __lo with |__hi + __lo| <= π/4 and stores the quadrant (the
+      // integer nearest to 2x/π) to the low bits of __q.
+      // Precondition: |__x| <= _S_trig_reduce_max<_Tp>
+      template <__vec_builtin _TV, __vec_builtin _UV>
+        _GLIBCXX_SIMD_INTRINSIC static constexpr _TV
+        _S_trig_reduce(_TV __x, _TV& __lo, _UV& __q)
+        {
+          using _Tp = __value_type_of<_TV>;
+          static_assert(sizeof(_TV) == sizeof(_UV));
+          constexpr bool __is_float = sizeof(_Tp) == sizeof(float);
+          // π/2 = __pio2_1 + __pio2_2 + __pio2_3 + __pio2_3t, where __pio2_1, __pio2_2, and
+          // __pio2_3 have enough trailing zeros for __n * __pio2_N to be exact
+          constexpr _Tp __pio2_1 = __is_float ? 0x1.922p0 : 0x1.921fb544p0;
+          constexpr _Tp __pio2_2 = __is_float ? -0x1.2aep-18 : 0x1.0b4611a6p-34;
+          constexpr _Tp __pio2_3 = __is_float ? -0x1.deap-31 : 0x1.3198a2ep-69;
+          constexpr _Tp __pio2_3t = __is_float ? 0x1.184698p-44 : 0x1.b839a252049c1p-104;
+          constexpr _Tp __shifter = 0x1.8p0 * (1ull << (__digits_v<_Tp> - 1));
+          const _TV __xn = __builtin_assoc_barrier(__x * _Tp(0x1.45f306dc9c883p-1) + __shifter);
+          // the low mantissa bits of __xn hold the quadrant in two's complement
+          __q = __builtin_bit_cast(_UV, __xn);
+          const _TV __n = __builtin_assoc_barrier(__xn - __shifter);
+          // __r + __d - __n * __pio2_3t is the reduced argument, where __d collects the rounding
+          // errors of the subtractions
+          _TV __r = __builtin_assoc_barrier(__x - __n * __pio2_1);
+          _TV __t = __r;
+          _TV __w = __n * __pio2_2;
+          __r = __builtin_assoc_barrier(__t - __w);
+          _TV __d = __builtin_assoc_barrier(__builtin_assoc_barrier(__t - __r) - __w);
+          __t = __r;
+          __w = __n * __pio2_3;
+          __r = __builtin_assoc_barrier(__t - __w);
+          __d += __builtin_assoc_barrier(__builtin_assoc_barrier(__t - __r) - __w);
+          __w = __n * __pio2_3t - __builtin_assoc_barrier(__d);
+          const _TV __hi = __builtin_assoc_barrier(__r - __w);
+          __lo = __builtin_assoc_barrier(__r - __hi) - __w;
+          return __hi;
+        }
+
+      // Returns sin(__x + __y) for |__x + __y| <= π/4 and |__y| <= ulp(__x)/2
+      // (cf. FreeBSD's k_sin.c; the float coefficients are from Cephes).
+      template <__vec_builtin _TV>
+        _GLIBCXX_SIMD_INTRINSIC static constexpr _TV
+        _S_sin_reduced(_TV __x, _TV __y)
+        {
+          using _Tp = __value_type_of<_TV>;
+          const _TV __z = __x * __x;
+          const _TV __v = __z * __x;
+          _TV __r;
+          _Tp __s1;
+          if constexpr (sizeof(_Tp) == sizeof(float))
+            {
+              __s1 = -1.6666654611e-1f;
+              __r = _S_horner(__z, -1.9515295891e-4f, 8.3321608736e-3f);
+            }
+          else if constexpr (sizeof(_Tp) == sizeof(double))
+            {
+              __s1 = -1.66666666666666324348e-01;
+              const _TV __w = __z * __z;
+              __r = _S_horner(__z, 2.75573137070700676789e-06, -1.98412698298579493134e-04,
+                              8.33333333332248946124e-03)
+                      + __z * __w * _S_horner(__z, 1.58969099521155010221e-10,
+                                              -2.50507602534068634195e-08);
+            }
+          else
+            static_assert(false);
+          return __x - ((__z * (_Tp(.5) * __y - __v * __r) - __y) - __v * __s1);
+        }
+
+      // Returns cos(__x + __y) for |__x + __y| <= π/4 and |__y| <= ulp(__x)/2
+      // (cf. FreeBSD's k_cos.c; the float coefficients are from Cephes).
+      template <__vec_builtin _TV>
+        _GLIBCXX_SIMD_INTRINSIC static constexpr _TV
+        _S_cos_reduced(_TV __x, _TV __y)
+        {
+          using _Tp = __value_type_of<_TV>;
+          const _TV __z = __x * __x;
+          _TV __r;
+          if constexpr (sizeof(_Tp) == sizeof(float))
+            __r = __z * _S_horner(__z, 2.443315711809948e-5f, -1.388731625493765e-3f,
+                                  4.166664568298827e-2f);
+          else if constexpr (sizeof(_Tp) == sizeof(double))
+            {
+              const _TV __w = __z * __z;
+              __r = __z * _S_horner(__z, 2.48015872894767294178e-05, -1.38888888888741095749e-03,
+                                    4.16666666666666019037e-02)
+                      + __w * __w * _S_horner(__z, -1.13596475577881948265e-11,
+                                              2.08757232129817482790e-09,
+                                              -2.75573143513906633035e-07);
+            }
+          else
+            static_assert(false);
+          const _TV __hz = _Tp(.5) * __z;
+          const _TV __w = _Tp(1) - __hz;
+          return __w + ((__builtin_assoc_barrier(_Tp(1) - __w) - __hz) + (__z * __r - __x * __y));
+        }
+
+      // Returns tan(__x + __y) as __ret + __tlo for |__x + __y| <= π/4 and |__y| <= ulp(__x)/2
+      // (Cephes).
+      template <__vec_builtin _TV>
+        _GLIBCXX_SIMD_INTRINSIC static constexpr _TV
+        _S_tan_reduced(_TV __x, _TV __y, _TV& __tlo)
+        {
+          using _Tp = __value_type_of<_TV>;
+          const _TV __z = __x * __x;
+          _TV __r;
+          if constexpr (sizeof(_Tp) == sizeof(float))
+            __r = _S_horner(__z, 9.38540185543e-3f, 3.11992232697e-3f, 2.44301354525e-2f,
+                            5.34112807005e-2f, 1.33387994085e-1f, 3.33331568548e-1f);
+          else if constexpr (sizeof(_Tp) == sizeof(double))
+            __r = _S_horner(__z, -1.30936939181383777646e4, 1.15351664838587416140e6,
+                            -1.79565251976484877988e7)
+                    / _S_horner(__z, 1., 1.36812963470692954678e4, -1.32089234440210967447e6,
+                                2.50083801823357915839e7, -5.38695755929454629881e7);
+          else
+            static_assert(false);
+          const _TV __w = __y + __x * __z * __r;
+          const _TV __t = __builtin_assoc_barrier(__x + __w);
+          __tlo = __w - __builtin_assoc_barrier(__t - __x);
+          return __t;
+        }
+
+      // Calls __fun(__i) for every lane __i where |__x| is too large for _S_trig_reduce. These
+      // lanes are rare enough that falling back to the scalar implementation (Payne-Hanek) is
+      // preferable over a vectorized multi-precision reduction.
+      template <__vec_builtin _TV>
+        _GLIBCXX_SIMD_INTRINSIC static void
+        _S_trig_large_fallback(_TV __x, auto&& __fun)
+        {
+          using _Tp = __value_type_of<_TV>;
+          const auto __large = _SuperImpl::_S_to_bits(
+                                 _SuperImpl::_S_less(_TV() + _S_trig_reduce_max<_Tp>,
+                                                     _SuperImpl::_S_abs(__x)));
+          if (__large.any()) [[unlikely]]
+            _S_bit_iteration(__large, __fun);
+        }
+
+      // [c.math] trigonometric functions
+      template <__vec_builtin _TV>
+        requires is_floating_point_v<__value_type_of<_TV>>
+        _GLIBCXX_SIMD_INTRINSIC static _TV
+        _S_sin(_TV __x)
+        {
+          _TV __s, __c;
+          _SuperImpl::template _S_sincos_impl<true, false>(__x, __s, __c);
+          return __s;
+        }
+
+      template <__vec_builtin _TV>
+        requires is_floating_point_v<__value_type_of<_TV>>
+        _GLIBCXX_SIMD_INTRINSIC static _TV
+        _S_cos(_TV __x)
+        {
+          _TV __s, __c;
+          _SuperImpl::template _S_sincos_impl<false, true>(__x, __s, __c);
+          return __c;
+        }
+
+      template <__vec_builtin _TV>
+        requires is_floating_point_v<__value_type_of<_TV>>
+        _GLIBCXX_SIMD_INTRINSIC static void
+        _S_sincos(_TV __x, _TV& __s, _TV& __c)
+        { _SuperImpl::template _S_sincos_impl<true, true>(__x, __s, __c); }
+
+      // Shared implementation of sin, cos, and sincos: the reduction is computed once and the
+      // quadrant selects between the sin and cos kernels and their sign.
+      template <bool _Sin, bool _Cos, __vec_builtin _TV>
+        _GLIBCXX_SIMD_INTRINSIC static void
+        _S_sincos_impl(_TV __x, _TV& __s, _TV& __c)
+        {
+          using _Tp = __value_type_of<_TV>;
+          using _UV = __vec_builtin_type<__make_unsigned_int_t<_Tp>, __width_of<_TV>>;
+          constexpr int __sign_shift = sizeof(_Tp) * __CHAR_BIT__ - 2;
+          _TV __lo;
+          _UV __q;
+          const _TV __hi = _S_trig_reduce(__x, __lo, __q);
+          const _TV __sin_r = _S_sin_reduced(__hi, __lo);
+          const _TV __cos_r = _S_cos_reduced(__hi, __lo);
+          const auto __odd = (__q & 1) != 0;
+          if constexpr (_Sin)
+            {
+              // sin(r + qπ/2): q = 0: sin(r), 1: cos(r), 2: -sin(r), 3: -cos(r)
+              __s = __vec_xor(__odd ? __cos_r : __sin_r,
+                              __builtin_bit_cast(_TV, (__q & 2) << __sign_shift));
+#ifndef __FAST_MATH__
+              __s = __x == _Tp() ? __x : __s; // preserve the sign of zero
+#endif
+              _S_trig_large_fallback(__x, [&](int __i) {
+                if constexpr (sizeof(_Tp) == sizeof(float))
+                  __s[__i] = __builtin_sinf(__x[__i]);
+                else
+                  __s[__i] = __builtin_sin(__x[__i]);
+              });
+            }
+          if constexpr (_Cos)
+            {
+              // cos(r + qπ/2): q = 0: cos(r), 1: -sin(r), 2: -cos(r), 3: sin(r)
+              __c = __vec_xor(__odd ? __sin_r : __cos_r,
+                              __builtin_bit_cast(_TV, ((__q + 1) & 2) << __sign_shift));
+              _S_trig_large_fallback(__x, [&](int __i) {
+                if constexpr (sizeof(_Tp) == sizeof(float))
+                  __c[__i] = __builtin_cosf(__x[__i]);
+                else
+                  __c[__i] = __builtin_cos(__x[__i]);
+              });
+            }
+        }
+
+      template <__vec_builtin _TV>
+        requires is_floating_point_v<__value_type_of<_TV>>
+        _GLIBCXX_SIMD_INTRINSIC static _TV
+        _S_tan(_TV __x)
+        {
+          using _Tp = __value_type_of<_TV>;
+          using _UV = __vec_builtin_type<__make_unsigned_int_t<_Tp>, __width_of<_TV>>;
+          _TV __lo;
+          _UV __q;
+          const _TV __hi = _S_trig_reduce(__x, __lo, __q);
+          _TV __tlo;
+          const _TV __t = _S_tan_reduced(__hi, __lo, __tlo);
+          // tan(r + π/2) = -1/tan(r) = -1/(__t + __tlo) ≈ __inv + __inv² * __tlo
+          const _TV __inv = _Tp(-1) / __t;
+          _TV __r = (__q & 1) != 0 ? __inv + __inv * __inv * __tlo : __t;
+#ifndef __FAST_MATH__
+          __r = __x == _Tp() ? __x : __r; // preserve the sign of zero
+#endif
+          _S_trig_large_fallback(__x, [&](int __i) {
+            if constexpr (sizeof(_Tp) == sizeof(float))
+              __r[__i] = __builtin_tanf(__x[__i]);
+            else
+              __r[__i] = __builtin_tan(__x[__i]);
+          });
+          return __r;
+        }
+
+      // Returns atan(__ax) for __ax >= 0 (FreeBSD's s_atan.c / s_atanf.c). The argument is reduced
+      // to |t| < 7/16 via atan(x) = atan(c) + atan((x - c) / (1 + cx)) with c ∈ {0, ½, 1, 3/2, ∞}.
+      template <__vec_builtin _TV>
+        _GLIBCXX_SIMD_INTRINSIC static constexpr _TV
+        _S_atan_nonnegative(_TV __ax)
+        {
+          using _Tp = __value_type_of<_TV>;
+          constexpr bool __is_float = sizeof(_Tp) == sizeof(float);
+          // atan(c) split into __hi + __lo
+          constexpr _Tp __atan_half_hi
+            = __is_float ? 4.6364760399e-01f : 4.63647609000806093515e-01;
+          constexpr _Tp __atan_half_lo
+            = __is_float ? 5.0121582440e-09f : 2.26987774529616870924e-17;
+          constexpr _Tp __atan_one_hi
+            = __is_float ? 7.8539812565e-01f : 7.85398163397448278999e-01;
+          constexpr _Tp __atan_one_lo
+            = __is_float ? 3.7748947079e-08f : 3.06161699786838301793e-17;
+          constexpr _Tp __atan_3half_hi
+            = __is_float ? 9.8279368877e-01f : 9.82793723247329054082e-01;
+          constexpr _Tp __atan_3half_lo
+            = __is_float ? 3.4473217170e-08f : 1.39033110312309984516e-17;
+          constexpr _Tp __atan_inf_hi
+            = __is_float ? 1.5707962513e+00f : 1.57079632679489655800e+00;
+          constexpr _Tp __atan_inf_lo
+            = __is_float ? 7.5497894159e-08f : 6.12323399573676603587e-17;
+          _TV __num = __ax;
+          _TV __den = _TV() + 1;
+          _TV __hi = _TV();
+          _TV __lo = _TV();
+          const auto __c_half = __ax >= _Tp(7. / 16);
+          __num = __c_half ? _Tp(2) * __ax - _Tp(1) : __num;
+          __den = __c_half ? _Tp(2) + __ax : __den;
+          __hi = __c_half ? _TV() + __atan_half_hi : __hi;
+          __lo = __c_half ? _TV() + __atan_half_lo : __lo;
+          const auto __c_one = __ax >= _Tp(11. / 16);
+          __num = __c_one ? __ax - _Tp(1) : __num;
+          __den = __c_one ? __ax + _Tp(1) : __den;
+          __hi = __c_one ? _TV() + __atan_one_hi : __hi;
+          __lo = __c_one ? _TV() + __atan_one_lo : __lo;
+          const auto __c_3half = __ax >= _Tp(19. / 16);
+          __num = __c_3half ? __ax - _Tp(1.5) : __num;
+          __den = __c_3half ? _Tp(1) + _Tp(1.5) * __ax : __den;
+          __hi = __c_3half ? _TV() + __atan_3half_hi : __hi;
+          __lo = __c_3half ? _TV() + __atan_3half_lo : __lo;
+          const auto __c_inf = __ax >= _Tp(39. / 16);
+          __num = __c_inf ? _TV() - 1 : __num;
+          __den = __c_inf ? __ax : __den;
+          __hi = __c_inf ? _TV() + __atan_inf_hi : __hi;
+          __lo = __c_inf ? _TV() + __atan_inf_lo : __lo;
+          // -ffast-math may divide via an approximate reciprocal; c = 0 does not need the division
+          const _TV __t = __c_half ? __num / __den : __ax;
+          const _TV __z = __t * __t;
+          const _TV __w = __z * __z;
+          _TV __s1, __s2;
+          if constexpr (__is_float)
+            {
+              __s1 = __z * _S_horner(__w, 6.1687607318e-02f, 1.4253635705e-01f, 3.3333328366e-01f);
+              __s2 = __w * _S_horner(__w, -1.0648017377e-01f, -1.9999158382e-01f);
+            }
+          else
+            {
+              __s1 = __z * _S_horner(__w, 1.62858201153657823623e-02, 4.97687799461593236017e-02,
+                                     6.66107313738753120669e-02, 9.09088713343650656196e-02,
+                                     1.42857142725034663711e-01, 3.33333333333329318027e-01);
+              __s2 = __w * _S_horner(__w, -3.65315727442169155270e-02, -5.83357013379057348645e-02,
+                                     -7.69187620504482999495e-02, -1.11111104054623557880e-01,
+                                     -1.99999999998764832476e-01);
+            }
+          return __hi - __builtin_assoc_barrier(__builtin_assoc_barrier(__t * (__s1 + __s2) - __lo)
+                                                  - __t);
+        }
+
+      // Returns __x with the low half of the mantissa bits cleared, such that the square of the
+      // result is exact.
+      template <__vec_builtin _TV>
+        _GLIBCXX_SIMD_INTRINSIC static constexpr _TV
+        _S_clear_low_half(_TV __x)
+        {
+          using _Tp = __value_type_of<_TV>;
+          using _Up = __make_unsigned_int_t<_Tp>;
+          constexpr _TV __hi_mask
+            = __builtin_bit_cast(_TV, __vec_broadcast<__width_of<_TV>>(
+                                        _Up(sizeof(_Tp) == sizeof(float)
+                                              ? 0xffff'f000u : 0xffff'ffff'0000'0000ull)));
+          return __vec_and(__x, __hi_mask);
+        }
+
+      // Returns R(__t) such that asin(x) = x + x R(x²) for |x| <= ½ (FreeBSD's e_asin.c /
+      // e_asinf.c).
+      template <__vec_builtin _TV>
+        _GLIBCXX_SIMD_INTRINSIC static constexpr _TV
+        _S_asin_rational(_TV __t)
+        {
+          using _Tp = __value_type_of<_TV>;
+          if constexpr (sizeof(_Tp) == sizeof(float))
+            return __t * _S_horner(__t, -8.6563630030e-03f, -4.2743422091e-02f, 1.6666586697e-01f)
+                     / _S_horner(__t, -7.0662963390e-01f, 1.f);
+          else
+            return __t * _S_horner(__t, 3.47933107596021167570e-05, 7.91534994289814532176e-04,
+                                   -4.00555345006794114027e-02, 2.01212532134862925881e-01,
+                                   -3.25565818622400915405e-01, 1.66666666666666657415e-01)
+                     / _S_horner(__t, 7.70381505559019352791e-02, -6.88283971605453293030e-01,
+                                 2.02094576023350569471e+00, -2.40339491173441421878e+00, 1.);
+        }
+
+      // [c.math] inverse trigonometric functions
+      template <__vec_builtin _TV>
+        requires is_floating_point_v<__value_type_of<_TV>>
+        _GLIBCXX_SIMD_INTRINSIC static constexpr _TV
+        _S_atan(_TV __x)
+        {
+          const _TV __ax = _S_fabs(__x);
+          return __vec_or(__vec_xor(__ax, __x), _S_atan_nonnegative(__ax));
+        }
+
+      template <__vec_builtin _TV>
+        requires is_floating_point_v<__value_type_of<_TV>>
+        _GLIBCXX_SIMD_INTRINSIC static constexpr _TV
+        _S_atan2(_TV __y, _TV __x)
+        {
+          using _Tp = __value_type_of<_TV>;
+          using _IV = __vec_builtin_type<__make_signed_int_t<_Tp>, __width_of<_TV>>;
+          constexpr bool __is_float = sizeof(_Tp) == sizeof(float);
+          constexpr _Tp __pio2_hi = __is_float ? 1.5707962513e+00f : 1.57079632679489655800e+00;
+          constexpr _Tp __pio2_lo = __is_float ? 7.5497894159e-08f : 6.12323399573676603587e-17;
+          const _TV __ax = _S_fabs(__x);
+          const _TV __ay = _S_fabs(__y);
+          // reduce to atan(min(|x|, |y|) / max(|x|, |y|)) ∈ [0, π/4]
+          const auto __steep = __ay > __ax;
+          const _TV __den = __steep ? __ay : __ax;
+          _TV __q = (__steep ? __ax : __ay) / __den;
+          __q = __den == _Tp() ? _TV() : __q;
+#if !__FINITE_MATH_ONLY__
+          __q = (__ax == __infinity_v<_Tp>) & (__ay == __infinity_v<_Tp>) ? _TV() + 1 : __q;
+#endif
+          const _TV __t = _S_atan_nonnegative(__q);
+          // atan2(|y|, x) = __hi + __lo ± __t with __hi + __lo ∈ {0, π/2, π}
+          const auto __xneg = __builtin_bit_cast(_IV, __x) < 0;
+          const _TV __hi = __steep ? _TV() + __pio2_hi
+                                   : __xneg ? _TV() + _Tp(2) * __pio2_hi : _TV();
+          const _TV __lo = __steep ? _TV() + __pio2_lo
+                                   : __xneg ? _TV() + _Tp(2) * __pio2_lo : _TV();
+          const _TV __pm_t = (__steep ^ __xneg) != 0 ? -__t : __t;
+          const _TV __r = __vec_or(__vec_xor(__ay, __y),
+                                   __hi + __builtin_assoc_barrier(__lo + __pm_t));
+#if __FINITE_MATH_ONLY__
+          return __r;
+#else
+          return _S_isunordered(__x, __y) ? __x + __y : __r;
+#endif
+        }
+
+      template <__vec_builtin _TV>
+        requires is_floating_point_v<__value_type_of<_TV>>
+        _GLIBCXX_SIMD_INTRINSIC static constexpr _TV
+        _S_asin(_TV __x)
+        {
+          using _Tp = __value_type_of<_TV>;
+          constexpr bool __is_float = sizeof(_Tp) == sizeof(float);
+          constexpr _Tp __pio2_hi = __is_float ? 1.5707962513e+00f : 1.57079632679489655800e+00;
+          constexpr _Tp __pio2_lo = __is_float ? 7.5497894159e-08f : 6.12323399573676603587e-17;
+          constexpr _Tp __pio4_hi = __pio2_hi * _Tp(.5);
+          const _TV __ax = _S_fabs(__x);
+          // |x| < ½
+          const _TV __small = __ax + __ax * _S_asin_rational(__ax * __ax);
+          // |x| >= ½: asin(|x|) = π/2 - 2 asin(√t) with t = (1 - |x|) / 2
+          const _TV __t = (_Tp(1) - __ax) * _Tp(.5);
+          const _TV __s = _SuperImpl::_S_sqrt(__t);
+          const _TV __sr = __s * _S_asin_rational(__t);
+          const _TV __near_one = __pio2_hi - (_Tp(2) * (__s + __sr) - __pio2_lo);
+          // below 0.975 the cancellation requires √t = __f + __c with __f² exact
+          const _TV __f = _S_clear_low_half(__s);
+          const _TV __c = (__t - __f * __f) / (__s + __f);
+          const _TV __p = _Tp(2) * __sr - (__pio2_lo - _Tp(2) * __c);
+          const _TV __q = __pio4_hi - _Tp(2) * __f;
+          const _TV __large = __pio4_hi - __builtin_assoc_barrier(__p - __q);
+          const _TV __r = __ax < _Tp(.5) ? __small : __ax < _Tp(.975) ? __large : __near_one;
+          return __vec_or(__vec_xor(__ax, __x), __r);
+        }
+
+      template <__vec_builtin _TV>
+        requires is_floating_point_v<__value_type_of<_TV>>
+        _GLIBCXX_SIMD_INTRINSIC static constexpr _TV
+        _S_acos(_TV __x)
+        {
+          using _Tp = __value_type_of<_TV>;
+          constexpr bool __is_float = sizeof(_Tp) == sizeof(float);
+          constexpr _Tp __pio2_hi = __is_float ? 1.5707962513e+00f : 1.57079632679489655800e+00;
+          constexpr _Tp __pio2_lo = __is_float ? 7.5497894159e-08f : 6.12323399573676603587e-17;
+          const _TV __ax = _S_fabs(__x);
+          // |x| < ½: acos(x) = π/2 - asin(x)
+          const _TV __small = __pio2_hi - (__x - (__pio2_lo - __x * _S_asin_rational(__x * __x)));
+          // |x| >= ½: with t = (1 - |x|) / 2 and asin(√t) = √t + __w
+          const _TV __t = (_Tp(1) - __ax) * _Tp(.5);
+          const _TV __s = _SuperImpl::_S_sqrt(__t);
+          const _TV __w = __s * _S_asin_rational(__t);
+          // x <= -½: acos(x) = π - 2 asin(√t)
+          const _TV __negative = _Tp(2) * (__pio2_hi - (__s + (__w - __pio2_lo)));
+          // x >= ½: acos(x) = 2 asin(√t) with √t = __f + __c and __f² exact
+          const _TV __f = _S_clear_low_half(__s);
+          const _TV __c = __t == _Tp() ? _TV() : (__t - __f * __f) / (__s + __f);
+          const _TV __positive = _Tp(2) * (__f + (__w + __c));
+          return __ax < _Tp(.5) ? __small : __x < _Tp() ? __negative : __positive;
+        }
+
+      // sinh and cosh overflow for |x| >= (max_exponent + 1) ln2 (the clamp of _S_exp_reduce)
+      template <typename _Tp>
+        static constexpr _Tp _S_hyperbolic_overflow
+          = (__max_exponent_v<_Tp> + 1) * _Tp(0x1.62e42fefa39efp-1);
+
+      // [c.math] hyperbolic functions
+      template <__vec_builtin _TV>
+        requires is_floating_point_v<__value_type_of<_TV>>
+        _GLIBCXX_SIMD_INTRINSIC static constexpr _TV
+        _S_sinh(_TV __x)
+        {
+          using _Tp = __value_type_of<_TV>;
+          // beyond __large e^-|x| is below ½ ulp of e^|x|
+          constexpr _Tp __large = sizeof(_Tp) == sizeof(float) ? 9 : 22;
+          const _TV __ax = _S_fabs(__x);
+          // one range reduction serves both e^|x| and expm1(|x|)
+          _TV __n;
+          const _TV __p = _S_expm1_reduced(_S_exp_reduce(__ax, __n));
+          const _TV __t = _SuperImpl::_S_ldexp_fp(
+                            __p + __builtin_assoc_barrier(
+                                    _Tp(1) - _SuperImpl::_S_ldexp_fp(_TV() + 1, -__n)), __n);
+          // sinh(|x|) = (t + t / (t + 1)) / 2 with t = expm1(|x|), rearranged for |x| < 1 to avoid
+          // cancellation
+          const _TV __d = __t / (__t + _Tp(1));
+          _TV __r = _Tp(.5) * (__ax < _Tp(1) ? _Tp(2) * __t - __t * __d : __t + __d);
+          // e^|x| / 2 without intermediate overflow
+          __r = __ax < __large ? __r : _SuperImpl::_S_ldexp_fp(_Tp(1) + __p, __n - _Tp(1));
+#if !__FINITE_MATH_ONLY__
+          // _S_exp_reduce clamps |x| just below the overflow threshold
+          __r = __ax >= _S_hyperbolic_overflow<_Tp> ? _TV() + __infinity_v<_Tp> : __r;
+#endif
+          return __vec_or(__vec_xor(__ax, __x), __r);
+        }
+
+      template <__vec_builtin _TV>
+        requires is_floating_point_v<__value_type_of<_TV>>
+        _GLIBCXX_SIMD_INTRINSIC static constexpr _TV
+        _S_cosh(_TV __x)
+        {
+          using _Tp = __value_type_of<_TV>;
+          const _TV __ax = _S_fabs(__x);
+          _TV __n;
+          const _TV __p = _S_expm1_reduced(_S_exp_reduce(__ax, __n));
+          // |x| <= ln2/2 implies __n = 0 and __p = expm1(|x|): cosh(x) = 1 + p² / (2 (1 + p))
+          const auto __small = __ax <= _Tp(0x1.62e42fefa39efp-2);
+          // otherwise, with e = e^|x| / 2: cosh(x) = e + 1 / (4 e)
+          const _TV __e = _SuperImpl::_S_ldexp_fp(_Tp(1) + __p, __n - _Tp(1));
+          const _TV __q = (__small ? __p * __p : _TV() + _Tp(.25))
+                            / (__small ? _Tp(2) + _Tp(2) * __p : __e);
+          const _TV __r = (__small ? _TV() + 1 : __e) + __q;
+#if __FINITE_MATH_ONLY__
+          return __r;
+#else
+          return __ax >= _S_hyperbolic_overflow<_Tp> ? _TV() + __infinity_v<_Tp> : __r;
+#endif
+        }
+
+      template <__vec_builtin _TV>
+        requires is_floating_point_v<__value_type_of<_TV>>
+        _GLIBCXX_SIMD_INTRINSIC static constexpr _TV
+        _S_tanh(_TV __x)
+        {
+          using _Tp = __value_type_of<_TV>;
+          const _TV __ax = _S_fabs(__x);
+          // with t = expm1(2|x|): tanh(|x|) = t / (t + 2), which is 1 - 2 / (t + 2) for |x| >= 1;
+          // overflow of t yields 1
+          const auto __ge1 = __ax >= _Tp(1);
+          const _TV __t = _S_expm1(_Tp(2) * __ax);
+          const _TV __d = (__ge1 ? _TV() + 2 : __t) / (__t + _Tp(2));
+          const _TV __r = __ge1 ? _Tp(1) - __d : __d;
+          return __vec_or(__vec_xor(__ax, __x), __r);
+        }
+
+      // Returns exp(__hi + __lo) for __hi + __lo <= 0 and __hi with few enough significant bits
+      // that __hi - n ln2_hi is exact (e.g. -z² with the low bits of z cleared). Unlike
+      // exp(fl(__hi + __lo)) the result retains the relative accuracy of __lo.
+      template <__vec_builtin _TV>
+        _GLIBCXX_SIMD_INTRINSIC static constexpr _TV
+        _S_exp_split(_TV __hi, _TV __lo)
+        {
+          using _Tp = __value_type_of<_TV>;
+          constexpr bool __is_float = sizeof(_Tp) == sizeof(float);
+          constexpr _Tp __ln2 = 0x1.62e42fefa39efp-1;
+          constexpr _Tp __ln2_hi = __is_float ? 0x1.62e4p-1 : 0x1.62e42feep-1;
+          constexpr _Tp __ln2_lo = __is_float ? 0x1.7f7d1cp-20 : 0x1.a39ef35793c76p-33;
+#ifdef __FAST_MATH__
+          constexpr _Tp __min = (__min_exponent_v<_Tp> - 2) * __ln2;
+#else
+          constexpr _Tp __min = (__min_exponent_v<_Tp> - __digits_v<_Tp> - 2) * __ln2;
+#endif
+          constexpr _Tp __shifter = 0x1.8p0 * (1ull << (__digits_v<_Tp> - 1));
+          // the result underflows anyway
+          const auto __underflow = __hi < __min;
+          __hi = __underflow ? _TV() + __min : __hi;
+          __lo = __underflow ? _TV() : __lo;
+          const _TV __n = _S_plus_minus((__hi + __lo) * _Tp(0x1.71547652b82fep0), __shifter);
+          const _TV __r = __builtin_assoc_barrier(__hi - __n * __ln2_hi)
+                            + __builtin_assoc_barrier(__lo - __n * __ln2_lo);
+          return _SuperImpl::_S_ldexp_fp(_Tp(1) + _S_expm1_reduced(__r), __n);
+        }
+
+      // Returns the rational approximation of FreeBSD's s_erf.c for the interval of __ax:
+      //   __ax < 0.84375:         erf(x) = x + x q
+      //   0.84375 <= __ax < 1.25: erf(|x|) = erx + q
+      //   1.25 <= __ax:           erfc(|x|) = exp(-z² - 0.5625) exp((z - |x|) (z + |x|) + q) / |x|
+      template <__vec_builtin _TV>
+        _GLIBCXX_SIMD_INTRINSIC static constexpr _TV
+        _S_erf_rational(_TV __ax)
+        {
+          using _Tp = __value_type_of<_TV>;
+          const _TV __z = __ax * __ax;
+          const _TV __s = __ax - _Tp(1);
+          const _TV __w = _Tp(1) / __z;
+          const auto __c1 = __ax < _Tp(0.84375);
+          const auto __c2 = __ax < _Tp(1.25);
+          const auto __c3 = __ax < _Tp(1 / 0.35);
+          const _TV __p1 = _S_horner(__z, -2.37630166566501626084e-05, -5.77027029648944159157e-03,
+                                     -2.84817495755985104766e-02, -3.25042107247001499370e-01,
+                                     1.28379167095512558561e-01);
+          const _TV __q1 = _S_horner(__z, -3.96022827877536812320e-06, 1.32494738004321644526e-04,
+                                     5.08130628187576562776e-03, 6.50222499887672944485e-02,
+                                     3.97917223959155352819e-01, 1.);
+          const _TV __p2 = _S_horner(__s, -2.16637559486879084300e-03, 3.54783043256182359371e-02,
+                                     -1.10894694282396677476e-01, 3.18346619901161753674e-01,
+                                     -3.72207876035701323847e-01, 4.14856118683748331666e-01,
+                                     -2.36211856075265944077e-03);
+          const _TV __q2 = _S_horner(__s, 1.19844998467991074170e-02, 1.36370839120290507362e-02,
+                                     1.26171219808761642112e-01, 7.18286544141962662868e-02,
+                                     5.40397917702171048937e-01, 1.06420880400844228286e-01, 1.);
+          const _TV __p3 = _S_horner(__w, -9.81432934416914548592e+00, -8.12874355063065934246e+01,
+                                     -1.84605092906711035994e+02, -1.62396669462573470355e+02,
+                                     -6.23753324503260060396e+01, -1.05586262253232909814e+01,
+                                     -6.93858572707181764372e-01, -9.86494403484714822705e-03);
+          const _TV __q3 = _S_horner(__w, -6.04244152148580987438e-02, 6.57024977031928170135e+00,
+                                     1.08635005541779435134e+02, 4.29008140027567833386e+02,
+                                     6.45387271733267880336e+02, 4.34565877475229228821e+02,
+                                     1.37657754143519042600e+02, 1.96512716674392571292e+01, 1.);
+          const _TV __p4 = _S_horner(__w, -4.83519191608651397019e+02, -1.02509513161107724954e+03,
+                                     -6.37566443368389627722e+02, -1.60636384855821916062e+02,
+                                     -1.77579549177547519889e+01, -7.99283237680523006574e-01,
+                                     -9.86494292470009928597e-03);
+          const _TV __q4 = _S_horner(__w, -2.24409524465858183362e+01, 4.74528541206955367215e+02,
+                                     2.55305040643316442583e+03, 3.19985821950859553908e+03,
+                                     1.53672958608443695994e+03, 3.25792512996573918826e+02,
+                                     3.03380607434824582924e+01, 1.);
+          // a single division for all intervals
+          const _TV __p = __c1 ? __p1 : __c2 ? __p2 : __c3 ? __p3 : __p4;
+          const _TV __q = __c1 ? __q1 : __c2 ? __q2 : __c3 ? __q3 : __q4;
+          return __p / __q;
+        }
+
+      // Returns erfc(__az) for __az >= 1.25 given __q from _S_erf_rational. The exponential is
+      // evaluated from __a, which is __az or, if _Scaled, √2 __az with __az = fl(__a / √2). The
+      // latter avoids the error amplification of the rounded argument.
+      template <bool _Scaled, __vec_builtin _TV>
+        _GLIBCXX_SIMD_INTRINSIC static constexpr _TV
+        _S_erfc_tail(_TV __az, _TV __q, _TV __a)
+        {
+          using _Tp = __value_type_of<_TV>;
+          using _Up = __make_unsigned_int_t<_Tp>;
+          constexpr _Tp __f = _Scaled ? .5 : 1;
+          // erfc(28) underflows for all supported types
+          constexpr _Tp __max = _Scaled ? 40 : 28;
+          __a = __a > __max ? _TV() + __max : __a;
+          // __f z² and -__f z² - 0.5625 are exact
+          constexpr _TV __hi_mask
+            = __builtin_bit_cast(_TV, __vec_broadcast<__width_of<_TV>>(
+                                        _Up(sizeof(_Tp) == sizeof(float)
+                                              ? 0xffff'e000u : 0xffff'ffff'0000'0000ull)));
+          const _TV __z = __vec_and(__a, __hi_mask);
+          return _S_exp_split(-(__z * __z) * __f - _Tp(0.5625),
+                              (__z - __a) * (__z + __a) * __f + __q) / __az;
+        }
+
+      // [c.math] error functions
+      template <__vec_builtin _TV>
+        requires is_floating_point_v<__value_type_of<_TV>>
+        _GLIBCXX_SIMD_INTRINSIC static constexpr _TV
+        _S_erf(_TV __x)
+        {
+          using _Tp = __value_type_of<_TV>;
+          constexpr _Tp __erx = 8.45062911510467529297e-01;
+          const _TV __ax = _S_fabs(__x);
+          const _TV __q = _S_erf_rational(__ax);
+          const _TV __r = __ax < _Tp(0.84375) ? __ax + __ax * __q
+                            : __ax < _Tp(1.25) ? __erx + __q
+                                               : _Tp(1) - _S_erfc_tail<false>(__ax, __q, __ax);
+          return __vec_or(__vec_xor(__ax, __x), __r);
+        }
+
+      // Returns erfc(__x) with the tail evaluated from __x0 (see _S_erfc_tail).
+      template <bool _Scaled, __vec_builtin _TV>
+        _GLIBCXX_SIMD_INTRINSIC static constexpr _TV
+        _S_erfc_impl(_TV __x, _TV __x0)
+        {
+          using _Tp = __value_type_of<_TV>;
+          using _IV = __vec_builtin_type<__make_signed_int_t<_Tp>, __width_of<_TV>>;
+          constexpr _Tp __erx = 8.45062911510467529297e-01;
+          const _TV __ax = _S_fabs(__x);
+          const auto __neg = __builtin_bit_cast(_IV, __x) < 0;
+          const _TV __q = _S_erf_rational(__ax);
+          // |x| < 0.84375: 1 - erf(x), rearranged above ¼ to keep the small terms together
+          const _TV __xq = __x * __q;
+          const _TV __r1 = __ax < _Tp(0.25) ? _Tp(1) - (__x + __xq)
+                                             : _Tp(.5) - (__xq + (__x - _Tp(.5)));
+          // |x| < 1.25: 1 ∓ erf(|x|)
+          const _TV __r2 = __neg ? _Tp(1) + (__erx + __q) : (_Tp(1) - __erx) - __q;
+          const _TV __tail = _S_erfc_tail<_Scaled>(__ax, __q, _S_fabs(__x0));
+          const _TV __r3 = __neg ? _Tp(2) - __tail : __tail;
+          return __ax < _Tp(0.84375) ? __r1 : __ax < _Tp(1.25) ? __r2 : __r3;
+        }
+
+      template <__vec_builtin _TV>
+        requires is_floating_point_v<__value_type_of<_TV>>
+        _GLIBCXX_SIMD_INTRINSIC static constexpr _TV
+        _S_erfc(_TV __x)
+        { return _S_erfc_impl<false>(__x, __x); }
+
+      // Returns e^__x with a relative error below 2^-20 (float) / 2^-48 (double) and e^0 = 1.
+      // Results below 2 norm_min are flushed to zero. NaN is propagated.
+      template <__vec_builtin _TV>
+        _GLIBCXX_SIMD_INTRINSIC static constexpr _TV
+        _S_exp_fast(_TV __x)
+        {
+          using _Tp = __value_type_of<_TV>;
+          using _UV = __vec_builtin_type<__make_unsigned_int_t<_Tp>, __width_of<_TV>>;
+          constexpr bool __is_float = sizeof(_Tp) == sizeof(float);
+          constexpr int __mant_bits = __digits_v<_Tp> - 1;
+          constexpr _Tp __ln2 = 0x1.62e42fefa39efp-1;
+          constexpr _Tp __ln2_hi = __is_float ? 0x1.62e4p-1 : 0x1.62e42feep-1;
+          constexpr _Tp __ln2_lo = __is_float ? 0x1.7f7d1cp-20 : 0x1.a39ef35793c76p-33;
+          constexpr _Tp __lo = (__min_exponent_v<_Tp> - _Tp(.25)) * __ln2;
+          // n = max_exponent + 1 makes 2^(n-1) = +∞
+          constexpr _Tp __hi = (__max_exponent_v<_Tp> + 1) * __ln2;
+          constexpr _Tp __shifter = 0x1.8p0 * (1ull << __mant_bits);
+          // keeps 2^(n-1) a normal number; NaN passes through
+          const auto __underflow = __x < __lo;
+          __x = __underflow ? _TV() + __lo : __x;
+          __x = __x > __hi ? _TV() + __hi : __x;
+          // __kf stores n = round(x / ln2) in its low mantissa bits (see _S_ldexp_fp)
+          const _TV __kf = __builtin_assoc_barrier(__x * _Tp(0x1.71547652b82fep0) + __shifter);
+          const _TV __n = __kf - __shifter;
+          const _TV __r = __builtin_assoc_barrier(__x - __n * __ln2_hi) - __n * __ln2_lo;
+          const _TV __scale = __builtin_bit_cast(
+                                _TV, (__builtin_bit_cast(_UV, __kf) + (__max_exponent_v<_Tp> - 2))
+                                       << __mant_bits);
+          // 2 e^r = 2 + 2r + r² q(r) with q interpolating 2 (e^r - 1 - r) / r² at the Chebyshev
+          // nodes of [-ln2/2, ln2/2]; 2^(n-1) · 2 e^r only overflows if the result does
+          _TV __q;
+          if constexpr (__is_float)
+            __q = _S_horner(__r, 0x1.11d946p-6f, 0x1.56b3d8p-4f, 0x1.555526p-2f, 0x1.ffff58p-1f);
+          else
+            __q = _S_horner(__r, 0x1.2880534067699p-21, 0x1.72c720c49e3f9p-18,
+                            0x1.a019c98e7c904p-15, 0x1.a019adabe2735p-12, 0x1.6c16c17398e38p-9,
+                            0x1.1111111c45e0bp-6, 0x1.5555555554c95p-4, 0x1.5555555553b7dp-2, 1.);
+          const _TV __p = _Tp(2) + (_Tp(2) * __r + __r * __r * __q);
+          return __underflow ? _TV() : __scale * __p;
+        }
+
+      // Extension: logistic function 1 / (1 + e^-x)
+      template <__vec_builtin _TV>
+        requires is_floating_point_v<__value_type_of<_TV>>
+        _GLIBCXX_SIMD_INTRINSIC static constexpr _TV
+        _S_sigmoid(_TV __x)
+        {
+          using _Tp = __value_type_of<_TV>;
+          // e^-|x| never overflows; for x < 0 the result is e^x / (1 + e^x) without cancellation
+          const _TV __e = _SuperImpl::_S_exp(-_S_fabs(__x));
+          const _TV __r = _Tp(1) / (_Tp(1) + __e);
+          return __x < _Tp() ? __e * __r : __r;
+        }
+
+      // Extension: 1 / (1 + e^-x) with a relative error below 2^-20 (float) / 2^-48 (double);
+      // results below 2 norm_min are flushed to zero
+      template <__vec_builtin _TV>
+        requires is_floating_point_v<__value_type_of<_TV>>
+        _GLIBCXX_SIMD_INTRINSIC static constexpr _TV
+        _S_sigmoid_fast(_TV __x)
+        {
+          using _Tp = __value_type_of<_TV>;
+          return _Tp(1) / (_Tp(1) + _S_exp_fast(-__x));
+        }
+
+      // Extension: Gaussian error linear unit x Φ(x) = x erfc(-x / √2) / 2
+      template <__vec_builtin _TV>
+        requires is_floating_point_v<__value_type_of<_TV>>
+        _GLIBCXX_SIMD_INTRINSIC static constexpr _TV
+        _S_gelu(_TV __x)
+        {
+          using _Tp = __value_type_of<_TV>;
+          const _TV __z = __x * _Tp(-0x1.6a09e667f3bcdp-1);
+          const _TV __r = _Tp(.5) * __x * _S_erfc_impl<true>(__z, -__x);
+#if __FINITE_MATH_ONLY__
+          return __r;
+#else
+          // -∞ · 0
+          return __x == -__infinity_v<_Tp> ? -_TV() : __r;
+#endif
+        }
+
+      // Extension: the tanh approximation of GELU,
+      //   x (1 + tanh(√(2/π) (x + 0.044715 x³))) / 2 = x / (1 + e^(-2√(2/π) (x + 0.044715 x³)))
+      // which differs from x Φ(x) by less than 5e-4 in absolute terms
+      template <__vec_builtin _TV>
+        requires is_floating_point_v<__value_type_of<_TV>>
+        _GLIBCXX_SIMD_INTRINSIC static constexpr _TV
+        _S_gelu_fast(_TV __x)
+        {
+          using _Tp = __value_type_of<_TV>;
+          const _TV __y = __x * (_Tp(-1.5957691216057308) - _Tp(0.0713548162726009) * __x * __x);
+          const _TV __r = __x / (_Tp(1) + _S_exp_fast(__y));
+#if __FINITE_MATH_ONLY__
+          return __r;
+#else
+          return __x == -__infinity_v<_Tp> ? -_TV() : __r;
+#endif
+        }
+
+      // Returns sin(π __x) for finite __x. Reducing __x modulo 2 and then by the nearest multiple
+      // of ½ is exact, which keeps the relative accuracy next to the zeros at integral __x.
+      template <__vec_builtin _TV>
+        _GLIBCXX_SIMD_INTRINSIC static constexpr _TV
+        _S_sinpi(_TV __x)
+        {
+          using _Tp = __value_type_of<_TV>;
+          using _UV = __vec_builtin_type<__make_unsigned_int_t<_Tp>, __width_of<_TV>>;
+          constexpr bool __is_float = sizeof(_Tp) == sizeof(float);
+          constexpr int __sign_shift = sizeof(_Tp) * __CHAR_BIT__ - 2;
+          constexpr _Tp __pi_hi = __is_float ? 0x1.921fb6p1f : 0x1.921fb54442d18p1;
+          constexpr _Tp __pi_lo = __is_float ? -0x1.777a5cp-24f : 0x1.1a62633145c07p-53;
+          constexpr _Tp __shifter = 0x1.8p0 * (1ull << (__digits_v<_Tp> - 1));
+          const _TV __y = __x - _Tp(2) * _SuperImpl::_S_nearbyint(__x * _Tp(.5));
+          const _TV __n = _SuperImpl::_S_nearbyint(__y + __y);
+          const _TV __r = __y - __n * _Tp(.5);
+          // the low mantissa bits hold n ∈ [-2, 2] in two's complement
+          const _UV __q = __builtin_bit_cast(_UV, __n + __shifter);
+          _TV __lo;
+          _TV __hi = _S_two_prod(__r, _TV() + __pi_hi, __lo);
+          __lo += __r * __pi_lo;
+          const _TV __t = __builtin_assoc_barrier(__hi + __lo);
+          __lo -= __builtin_assoc_barrier(__t - __hi);
+          __hi = __t;
+          // sin(πr + nπ/2): n = 0: sin(πr), 1: cos(πr), 2: -sin(πr), 3: -cos(πr)
+          return __vec_xor((__q & 1) != 0 ? _S_cos_reduced(__hi, __lo) : _S_sin_reduced(__hi, __lo),
+                           __builtin_bit_cast(_TV, (__q & 2) << __sign_shift));
+        }
+
+      // Returns lgamma(y) for double __z ∈ [0, 8), where y ∈ [1, 3) is __z shifted with
+      //   __z < 1:      lgamma(__z) = lgamma(y) - log(__z)
+      //   __z ∈ [3, 8): lgamma(__z) = lgamma(y) + log(__p)
+      // and __p is the product of up to five factors. lgamma(y) uses the rational approximations
+      // of Boost.Math on [1, 1.5], [1.5, 2], and [2, 3), which keep the relative accuracy next to
+      // the zeros at 1 and 2.
+      template <__vec_builtin _TV>
+        _GLIBCXX_SIMD_INTRINSIC static constexpr _TV
+        _S_lgamma_shifted(_TV __z, _TV& __p)
+        {
+          using _Tp = __value_type_of<_TV>;
+          static_assert(sizeof(_Tp) == sizeof(double));
+          const auto __small = __z < _Tp(1);
+          // Γ(y) = (y - 1) Γ(y - 1)
+          _TV __y = __z;
+          __p = _TV() + 1;
+          for (int __i = 0; __i < 5; ++__i)
+            {
+              const auto __m = (__y >= _Tp(3)) & (__y < _Tp(8));
+              __y = __m ? __y - _Tp(1) : __y;
+              __p = __m ? __p * __y : __p;
+            }
+          // Γ(z) = Γ(z + 1) / z, without rounding z + 1
+          const _TV __zm1 = __small ? __z : __y - _Tp(1);
+          const _TV __zm2 = __small ? __z - _Tp(1) : __y - _Tp(2);
+          const auto __c1 = __zm1 <= _Tp(.5);
+          const auto __c2 = __zm1 < _Tp(1);
+          const _TV __t = __c1 ? __zm1 : __c2 ? -__zm2 : __zm2;
+          const _TV __p1 = _S_horner(__t, -0.100346687696279557415e-2, -0.240149820648571559892e-1,
+                                     -0.158413586390692192217e0, -0.406567124211938417342e0,
+                                     -0.414983358359495381969e0, -0.969117530159521214579e-1,
+                                     0.490622454069039543534e-1);
+          const _TV __q1 = _S_horner(__t, 0.195768102601107189171e-2, 0.577039722690451849648e-1,
+                                     0.507137738614363510846e0, 0.191415588274426679201e1,
+                                     0.348739585360723852576e1, 0.302349829846463038743e1, 1.);
+          const _TV __p2 = _S_horner(__t, 0.431171342679297331241e-3, -0.850535976868336437746e-2,
+                                     0.542809694055053558157e-1, -0.142440390738631274135e0,
+                                     0.144216267757192309184e0, -0.292329721830270012337e-1);
+          const _TV __q2 = _S_horner(__t, -0.827193521891290553639e-6,
+                                     -0.100666795539143372762e-2, 0.25582797155975869989e-1,
+                                     -0.220095151814995745555e0, 0.846973248876495016101e0,
+                                     -0.150169356054485044494e1, 1.);
+          const _TV __p3 = _S_horner(__t, -0.324588649825948492091e-4, -0.541009869215204396339e-3,
+                                     -0.259453563205438108893e-3, 0.172491608709613993966e-1,
+                                     0.494103151567532234274e-1, 0.25126649619989678683e-1,
+                                     -0.180355685678449379109e-1);
+          const _TV __q3 = _S_horner(__t, -0.223352763208617092964e-6, 0.224936291922115757597e-3,
+                                     0.82130967464889339326e-2, 0.988504251128010129477e-1,
+                                     0.541391432071720958364e0, 0.148019669424231326694e1,
+                                     0.196202987197795200688e1, 1.);
+          // lgamma(y) = prefix (Y + P/Q) with a single division for all intervals
+          const _TV __prefix = __c2 ? __zm1 * __zm2 : __zm2 * (__zm2 + _Tp(3));
+          const _TV __yc = _TV() + (__c1 ? 0.52815341949462890625
+                                         : __c2 ? 0.452017307281494140625
+                                                : 0.158963680267333984375);
+          const _TV __ratio = (__c1 ? __p1 : __c2 ? __p2 : __p3) / (__c1 ? __q1 : __c2 ? __q2 : __q3);
+          return __prefix * __yc + __prefix * __ratio;
+        }
+
+      // Returns the Lanczos sum L(__z) for double __z ∈ [0, 200] and stores
+      // (__z - ½) log2((__z + g - ½) / e) to __thi + __tlo, i.e. Γ(__z) = L(__z) 2^(__thi + __tlo)
+      // (N = 13, g ≈ 6.0247 from Boost.Math). The power is evaluated in double-double and
+      // compensates the rounding error of __z + g - ½, which (__z - ½) would otherwise amplify.
+      template <__vec_builtin _TV>
+        _GLIBCXX_SIMD_INTRINSIC static constexpr _TV
+        _S_tgamma_lanczos(_TV __z, _TV& __thi, _TV& __tlo)
+        {
+          using _Tp = __value_type_of<_TV>;
+          static_assert(sizeof(_Tp) == sizeof(double));
+          constexpr _Tp __g = 6.024680040776729583740234375;
+          constexpr _Tp __log2e_hi = 0x1.71547652b82fep0;
+          constexpr _Tp __log2e_lo = 0x1.777d0ffda0d24p-56;
+          const _TV __num = _S_horner(__z, 0.006061842346248906525783753964555936883222,
+                                      0.5098416655656676188125178644804694509993,
+                                      19.51992788247617482847860966235652136208,
+                                      449.9445569063168119446858607650988409623,
+                                      6955.999602515376140356310115515198987526,
+                                      75999.29304014542649875303443598909137092,
+                                      601859.6171681098786670226533699352302507,
+                                      3481712.15498064590882071018964774556468,
+                                      14605578.08768506808414169982791359218571,
+                                      43338889.32467613834773723740590533316085,
+                                      86363131.28813859145546927288977868422342,
+                                      103794043.1163445451906271053616070238554,
+                                      56906521.91347156388090791033559122686859);
+          // z (z + 1) ... (z + 11)
+          const _TV __den = _S_horner(__z, 1., 66., 1925., 32670., 357423., 2637558., 13339535.,
+                                      45995730., 105258076., 150917976., 120543840., 39916800.,
+                                      0.);
+          _TV __e;
+          const _TV __zgh = _S_two_sum(__z, _TV() + (__g - _Tp(.5)), __e);
+          _TV __llo;
+          const _TV __lhi = _S_log2_dd(__zgh, __llo);
+          // log2(zgh + e) - log2(e) ≈ log2(zgh) + e / (zgh ln2) - log2(e)
+          _TV __ulo;
+          const _TV __uhi = _S_two_sum(__lhi, _TV() - __log2e_hi, __ulo);
+          __ulo += __llo - __log2e_lo + __e / __zgh * __log2e_hi;
+          const _TV __zmh = __z - _Tp(.5);
+          __thi = _S_two_prod(__zmh, __uhi, __tlo);
+          __tlo += __zmh * __ulo;
+          return __num / __den;
+        }
+
+      // [c.math] gamma functions
+      template <__vec_builtin _TV>
+        requires is_floating_point_v<__value_type_of<_TV>>
+        _GLIBCXX_SIMD_INTRINSIC static _TV
+        _S_lgamma(_TV __x)
+        {
+          using _Tp = __value_type_of<_TV>;
+          if constexpr (sizeof(_Tp) == sizeof(float))
+            return _S_as_double([](auto __xd) { return _SuperImpl::_S_lgamma(__xd); }, __x);
+          else if constexpr (sizeof(_Tp) == sizeof(double))
+            {
+              constexpr _Tp __pi = 0x1.921fb54442d18p1;
+              // below, lgamma(x) = -log|x| - γx equals lgamma(|x|) up to rounding
+              constexpr _Tp __tiny = 0x1p-60;
+              // all such arguments are poles
+              constexpr _Tp __int_min = -_Tp(1ull << (__digits_v<_Tp> - 1));
+              const _TV __ax = _S_fabs(__x);
+              const auto __small = __ax < _Tp(1);
+              const auto __stirling = __ax >= _Tp(8);
+              _TV __p;
+              const _TV __rat = _S_lgamma_shifted(__ax, __p);
+              const _TV __log = _SuperImpl::_S_log(__small | __stirling ? __ax : __p);
+              // (z - ½) (log z - 1) + ½ log 2π - ½ + Σ B₂ₖ / (2k (2k - 1) z²ᵏ⁻¹); eight terms
+              // suffice for z >= 8
+              const _TV __w = _Tp(1) / __ax;
+              const _TV __s = __w * _S_horner(__w * __w, -3617. / 122400, 1. / 156,
+                                              -691. / 360360, 1. / 1188, -1. / 1680, 1. / 1260,
+                                              -1. / 360, 1. / 12);
+              const _TV __st = (__ax - _Tp(.5)) * (__log - _Tp(1))
+                                 + __builtin_assoc_barrier(_Tp(0.41893853320467274178) + __s);
+              _TV __r = __stirling ? __st : __rat + (__small ? -__log : __log);
+              if (_S_vec_any_of(__x < -__tiny))
+                {
+                  // Γ(x) Γ(1 - x) = π / sin(πx) and Γ(1 - x) = -x Γ(-x); the logarithms of |x|
+                  // and __p are folded into a single one
+                  const _TV __sin = _S_fabs(_S_sinpi(__x));
+                  const _TV __d = __small ? __sin : __stirling ? __ax * __sin : __ax * __sin * __p;
+                  const _TV __neg = _SuperImpl::_S_log(__pi / __d) - (__stirling ? __st : __rat);
+                  __r = __x < -__tiny ? __neg : __r;
+                }
+              return __x <= __int_min ? _TV() + __infinity_v<_Tp> : __r;
+            }
+          else
+            static_assert(false);
+        }
+
+      template <__vec_builtin _TV>
+        requires is_floating_point_v<__value_type_of<_TV>>
+        _GLIBCXX_SIMD_INTRINSIC static _TV
+        _S_tgamma(_TV __x)
+        {
+          using _Tp = __value_type_of<_TV>;
+          if constexpr (sizeof(_Tp) == sizeof(float))
+            // overflow and underflow happen on conversion
+            return _S_as_double([](auto __xd) { return _SuperImpl::_S_tgamma(__xd); }, __x);
+          else if constexpr (sizeof(_Tp) == sizeof(double))
+            {
+              constexpr _Tp __pi = 0x1.921fb54442d18p1;
+              const _TV __ax = _S_fabs(__x);
+              const auto __neg = __x < _Tp();
+              // Γ(200) overflows and 1 / Γ(200) underflows
+              _TV __thi, __tlo;
+              const _TV __l = _S_tgamma_lanczos(__ax > _Tp(200) ? _TV() + 200 : __ax, __thi, __tlo);
+              // Γ(x) Γ(1 - x) = π / sin(πx) and Γ(1 - x) = -x Γ(-x). The exponent is offset by
+              // ∓64 such that only the final multiplication overflows or underflows.
+              const _TV __f = __neg ? -__pi / (__x * (_S_sinpi(__x) * __l)) * _Tp(0x1p-64)
+                                    : __l * _Tp(0x1p64);
+              _TV __elo;
+              const _TV __ehi = _S_two_sum(__neg ? -__thi : __thi,
+                                           __neg ? _TV() + 64 : _TV() - 64, __elo);
+              const _TV __r0 = __f * _S_exp2_dd(__ehi, __elo + (__neg ? -__tlo : __tlo));
+              // Γ(x) = 1/x - γ + O(x) and the Lanczos sum itself overflows for tiny x
+              const _TV __r = __ax < _Tp(0x1p-56) ? _Tp(1) / __x : __r0;
+#if __FINITE_MATH_ONLY__
+              return __r;
+#else
+              // poles at zero (signed) and negative integers (and -∞)
+              return __x == _Tp() ? _Tp(1) / __x
+                                  : __neg & (_SuperImpl::_S_trunc(__x) == __x)
+                                      ? _TV() + __quiet_NaN_v<_Tp> : __r;
+#endif
+            }
+          else
+            static_assert(false);
+        }
+
+      // [sf.cmath] mathematical special functions
+      // Exponential integral Ei(x) = -E₁(-x) using the rational approximations of Boost.Math.
+      // All intervals are evaluated; they share a single division, one exponential, and two
+      // logarithms.
+      template <__vec_builtin _TV>
+        requires is_floating_point_v<__value_type_of<_TV>>
+        _GLIBCXX_SIMD_INTRINSIC static _TV
+        _S_expint(_TV __x)
+        {
+          using _Tp = __value_type_of<_TV>;
+          if constexpr (sizeof(_Tp) == sizeof(float))
+            return _S_as_double([](auto __xd) { return _SuperImpl::_S_expint(__xd); }, __x);
+          else if constexpr (sizeof(_Tp) == sizeof(double))
+            {
+              // the root of Ei: r1 + r2
+              constexpr _Tp __root = 0.372507410781366634461991866580119133535689497771654051;
+              constexpr _Tp __r1 = 1677624236387711. / 4503599627370496.;
+              constexpr _Tp __r2 = 0.131401834143860282009280387409357165515556574352422001206362e-16;
+              constexpr _Tp __exp40 = 2.35385266837019985407899910749034804508871617254555467236651e17;
+              const _TV __z = _S_fabs(__x);
+              const auto __neg = __x < _Tp();
+              const _TV __w = _Tp(1) / __z;
+              // E₁(z) for z <= 1:  P/Q + z - log(z) - Y
+              const _TV __pa = _S_horner(__z, -0.000111507792921197858394, -0.00399167106081113256961,
+                                         -0.0368031736257943745142, -0.245088216639761496153,
+                                         0.0320913665303559189999, 0.0865197248079397976498);
+              const _TV __qa = _S_horner(__z, -0.528611029520217142048e-6,
+                                         0.000131049900798434683324, 0.00427347600017103698101,
+                                         0.056770677104207528384, 0.37091387659397013215, 1.);
+              // E₁(z) for z > 1: (1 + P/Q(1/z)) e^-z / z
+              const _TV __pb = _S_horner(__w, -1185.45720315201027667, -14751.4895786128450662,
+                                         -54844.4587226402067411, -86273.1567711649528784,
+                                         -66598.2652345418633509, -27182.6254466733970467,
+                                         -6046.8250112711035463, -724.581482791462469795,
+                                         -43.3058660811817946037, -0.999999999999998811143,
+                                         -0.121013190657725568138e-18);
+              const _TV __qb = _S_horner(__w, -0.776491285282330997549, 1229.20784182403048905,
+                                         18455.4124737722049515, 86722.3403467334749201,
+                                         180329.498380501819718, 192104.047790227984431,
+                                         113057.05869159631492, 38129.5594484818471461,
+                                         7417.37624454689546708, 809.193214954550328455,
+                                         45.3058660811801465927, 1.);
+              // Ei(z) for z <= 6: (z - r) P/Q(z/3 - 1) + log(z / r)
+              const _TV __tc = __z * _Tp(1. / 3) - _Tp(1);
+              const _TV __pc = _S_horner(__tc, 0.2777056254402008721e-6, 0.798296365679269702435e-5,
+                                         0.000116419523609765200999, 0.00115478237227804306827,
+                                         0.00726224593341228159561, 0.0499434773576515260534,
+                                         0.114670926327032002811, 0.780836076283730801839,
+                                         0.356343618769377415068, 2.98677224343598593013);
+              const _TV __qc = _S_horner(__tc, -0.138972589601781706598e-4,
+                                         0.000389034007436065401822, -0.00504800158663705747345,
+                                         0.0391523431392967238166, -0.195114782069495403315,
+                                         0.62215109846016746276, -1.17090412365413911947, 1.);
+              // Ei(z) for z > 6: (Y + P/Q(t)) e^z / z + z
+              const _TV __td = __z * _Tp(.5) - _Tp(4);
+              const _TV __pd = _S_horner(__td, -0.396487648924804510056e-5,
+                                         -0.554086272024881826253e-4, -0.000374885917942100256775,
+                                         -0.00247496209592143627977, -0.00761224003005476438412,
+                                         -0.0264095520754134848538, -0.0349921221823888744966,
+                                         0.00139324086199402804173);
+              const _TV __qd = _S_horner(__td, 0.263649630720255691787e-4,
+                                         0.000402453408512476836472, 0.00365334190742316650106,
+                                         0.0223851099128506347278, 0.100128624977313872323,
+                                         0.329061095011767059236, 0.744625566823272107711, 1.);
+              const _TV __te = __z * _Tp(.2) - _Tp(3);
+              const _TV __pe = _S_horner(__te, -0.138652200349182596186e-4,
+                                         -0.000209750022660200888349, -0.00155941947035972031334,
+                                         -0.00720603636917482065907, -0.0226059218923777094596,
+                                         -0.0478447572647309671455, -0.0652810444222236895772,
+                                         -0.0484607730127134045806, -0.00893891094356945667451);
+              const _TV __qe = _S_horner(__te, 0.000159150281166108755531,
+                                         0.00278170769163303669021, 0.0233458478275769288159,
+                                         0.122537731979686102756, 0.438873285773088870812,
+                                         1.09601437090337519977, 1.86232465043073157508,
+                                         1.97017214039061194971, 1.);
+              const _TV __tf = __z * _Tp(.1) - _Tp(3);
+              const _TV __pf = _S_horner(__tf, -0.113161784705911400295e-9,
+                                         -0.000192178045857733706044, -0.00207592267812291726961,
+                                         -0.00994403059883350813295, -0.0272050837209380717069,
+                                         -0.0453759383048193402336, -0.0449814350482277917716,
+                                         -0.0229930320357982333406, -0.00356165148914447597995);
+              const _TV __qf = _S_horner(__tf, 0.00488071077519227853585, 0.0651165455496281337831,
+                                         0.383213198510794507409, 1.2985244073998398643,
+                                         2.75088464344293083595, 3.6599610090072393012,
+                                         2.84354408840148561131, 1.);
+              const _TV __pg = _S_horner(__w, -38703.1431362056714134, 18932.0850014925993025,
+                                         -2516.35323679844256203, 94.7365094537197236011,
+                                         0.19029710559486576682, -0.0130653381347656243849);
+              const _TV __qg = _S_horner(__w, 8297.16296356518409347, 54738.2833147775537106,
+                                         -70126.245140396567133, 22329.1459489893079041,
+                                         -2354.56211323420194283, 61.9733592849439884145, 1.);
+              const auto __ca = __neg & (__z <= _Tp(1));
+              const auto __cb = __neg;
+              const auto __cc = __z <= _Tp(6);
+              const auto __cd = __z <= _Tp(10);
+              const auto __ce = __z <= _Tp(20);
+              const auto __cf = __z <= _Tp(40);
+              const _TV __ratio
+                = (__ca ? __pa : __cb ? __pb : __cc ? __pc : __cd ? __pd : __ce ? __pe
+                               : __cf ? __pf : __pg)
+                    / (__ca ? __qa : __cb ? __qb : __cc ? __qc : __cd ? __qd : __ce ? __qe
+                                   : __cf ? __qf : __qg);
+              // for z <= 1, z - Y is exact and cancels before the logarithm is added
+              const _TV __yc = __ca ? __z - _Tp(0.66373538970947265625)
+                                    : _TV() + (__cb ? 1. : __cc ? 0. : __cd ? 1.158985137939453125
+                                                     : __ce ? 1.0869731903076171875
+                                                     : __cf ? 1.03937530517578125
+                                                            : 1.013065338134765625);
+              // e^x / z; beyond 40 the exponential is scaled by e^-40 to postpone the overflow
+              const auto __scaled = __x > _Tp(40);
+              const _TV __e = _SuperImpl::_S_exp(__scaled ? __x - _Tp(40) : __x) * __w;
+              const _TV __t = __builtin_assoc_barrier(__z - __r1) - __r2;
+              // subnormal z is scaled up so that the multiplication by 1/r stays exact enough
+              const auto __subnormal = __z < _Tp(0x1p-1022);
+              const _TV __zs = __subnormal ? __z * _Tp(0x1p54) : __z;
+              const _TV __log = _SuperImpl::_S_log(__neg ? __zs : __zs * _Tp(1 / __root))
+                                  - (__subnormal ? _TV() + 0x1.2b708872320e2p5 : _TV());
+              const _TV __log1p = _SuperImpl::_S_log1p(__t * _Tp(1 / __root));
+              // Ei(x) = (Y + P/Q) m + a
+              const _TV __m = __ca ? _TV() - 1 : __cb ? -__e : __cc ? __t
+                                : __scaled ? __e * __exp40 : __e;
+              const _TV __a = __ca ? __log
+                                : __cb ? -_TV()
+                                       : __cc ? _S_fabs(__t) < _Tp(.1) ? __log1p : __log : __z;
+              const _TV __r = (__yc + __ratio) * __m + __a;
+#if __FINITE_MATH_ONLY__
+              return __r;
+#else
+              return __x == __infinity_v<_Tp> ? __x : __r;
+#endif
+            }
+          else
+            static_assert(false);
+        }
+
+      // Complete elliptic integrals of the first and second kind (Cephes' ellpk and ellpe, which
+      // are polynomial in m₁ = 1 - k² apart from the logarithmic singularity at k = ±1).
+      template <__vec_builtin _TV>
+        requires is_floating_point_v<__value_type_of<_TV>>
+        _GLIBCXX_SIMD_INTRINSIC static _TV
+        _S_comp_ellint_1(_TV __k)
+        {
+          using _Tp = __value_type_of<_TV>;
+          if constexpr (sizeof(_Tp) == sizeof(float))
+            return _S_as_double([](auto __kd) { return _SuperImpl::_S_comp_ellint_1(__kd); }, __k);
+          else if constexpr (sizeof(_Tp) == sizeof(double))
+            {
+              // NaN for |k| > 1 via the logarithm
+              const _TV __m1 = (_Tp(1) - __k) * (_Tp(1) + __k);
+              const _TV __r
+                = _S_horner(__m1, 1.37982864606273237150E-4, 2.28025724005875567385E-3,
+                            7.97404013220415179367E-3, 9.85821379021226008714E-3,
+                            6.87489687449949877925E-3, 6.18901033637687613229E-3,
+                            8.79078273952743772254E-3, 1.49380448916805252718E-2,
+                            3.08851465246711995998E-2, 9.65735902811690126535E-2,
+                            1.38629436111989062502E0)
+                    - _SuperImpl::_S_log(__m1)
+                        * _S_horner(__m1, 2.94078955048598507511E-5, 9.14184723865917226571E-4,
+                                    5.94058303753167793257E-3, 1.54850516649762399335E-2,
+                                    2.39089602715924892727E-2, 3.01204715227604046988E-2,
+                                    3.73774314173823228969E-2, 4.88280347570998239232E-2,
+                                    7.03124996963957469739E-2, 1.24999999999870820058E-1,
+                                    4.99999999999999999821E-1);
+              // like std::comp_ellint_1, the pole at |k| = 1 is a domain error
+              return __m1 == _Tp() ? _TV() + __quiet_NaN_v<_Tp> : __r;
+            }
+          else
+            static_assert(false);
+        }
+
+      template <__vec_builtin _TV>
+        requires is_floating_point_v<__value_type_of<_TV>>
+        _GLIBCXX_SIMD_INTRINSIC static _TV
+        _S_comp_ellint_2(_TV __k)
+        {
+          using _Tp = __value_type_of<_TV>;
+          if constexpr (sizeof(_Tp) == sizeof(float))
+            return _S_as_double([](auto __kd) { return _SuperImpl::_S_comp_ellint_2(__kd); }, __k);
+          else if constexpr (sizeof(_Tp) == sizeof(double))
+            {
+              const _TV __m1 = (_Tp(1) - __k) * (_Tp(1) + __k);
+              const _TV __r
+                = _S_horner(__m1, 1.53552577301013293365E-4, 2.50888492163602060990E-3,
+                            8.68786816565889628429E-3, 1.07350949056076193403E-2,
+                            7.77395492516787092951E-3, 7.58395289413514708519E-3,
+                            1.15688436810574127319E-2, 2.18317996015557253103E-2,
+                            5.68051945617860553470E-2, 4.43147180560990850618E-1,
+                            1.00000000000000000299E0)
+                    - _SuperImpl::_S_log(__m1) * __m1
+                        * _S_horner(__m1, 3.27954898576485872656E-5, 1.00962792679356715133E-3,
+                                    6.50609489976927491433E-3, 1.68862163993311317300E-2,
+                                    2.61769742454493659583E-2, 3.34833904888224918614E-2,
+                                    4.27180926518931511717E-2, 5.85936634471101055642E-2,
+                                    9.37499997197644278445E-2, 2.49999999999888314361E-1);
+              // m₁ log(m₁) → 0
+              return __m1 == _Tp() ? _TV() + 1 : __r;
+            }
+          else
+            static_assert(false);
+        }
+
+      template <__vec_builtin _TV>
+        _GLIBCXX_SIMD_INTRINSIC static constexpr _MaskMember<_TV>
+        _S_isnan([[maybe_unused]] _TV __x)
+        {
+#if __FINITE_MATH_ONLY__
+          return {}; // false
+#elif not defined __SUPPORT_SNAN__ or not defined __STDC_IEC_559__
+          return ~(__x == __x);
+#else
+          using _Tp = __value_type_of<_TV>;
+          using _IV = __vec_builtin_type<__make_signed_int_t<_Tp>, _S_full_size>;
+          const auto __absn = __builtin_bit_cast(_IV, _SuperImpl::_S_abs(__x));
+          const auto __infn = __builtin_bit_cast(
+                                _IV, __vec_broadcast<_S_size>(__infinity_v<_Tp>));
+          return __infn < __absn;
+#endif
+        }
+
+      template <__vec_builtin _TV>
+        _GLIBCXX_SIMD_INTRINSIC static constexpr _MaskMember<_TV>
+        _S_isfinite([[maybe_unused]] _TV __x)
+        {
+#if __FINITE_MATH_ONLY__
+          return _S_allbits<_MaskMember<_TV>>;
+#else
+          // if all exponent bits are set, __x is either inf or NaN
+          using _Tp = __value_type_of<_TV>;
+          using _IV = __vec_builtin_type<__make_signed_int_t<_Tp>, _S_full_size>;
+          const auto __absn = __builtin_bit_cast(_IV, _SuperImpl::_S_abs(__x));
+          constexpr _IV __maxn
+            = __builtin_bit_cast(_IV, __vec_broadcast<_S_size>(__finite_max_v<_Tp>));
+          return _SuperImpl::_S_less_equal(__absn, __maxn);
+#endif
+        }
+
+      template <__vec_builtin _TV>
+        _GLIBCXX_SIMD_INTRINSIC static constexpr _MaskMember<_TV>
+        _S_isunordered(_TV __x, _TV __y)
+        { return __vec_or(_S_isnan(__x), _S_isnan(__y)); }
+
+      template <__vec_builtin _TV>
+        _GLIBCXX_SIMD_INTRINSIC static constexpr _MaskMember<_TV>
+        _S_signbit(_TV __x)
+        {
+          using _Tp = __value_type_of<_TV>;
+          using _IV = __vec_builtin_type<__make_signed_int_t<_Tp>, _S_full_size>;
+          return __builtin_bit_cast(_IV, __x) < 0;
+          // Arithmetic right shift (SRA) would also work (instead of compare), but
+          // 64-bit SRA isn't available on x86 before AVX512. And in general,
+          // compares are more likely to be efficient than SRA.
+        }
+
+      template <__vec_builtin _TV>
+        _GLIBCXX_SIMD_INTRINSIC static constexpr _MaskMember<_TV>
+        _S_isinf([[maybe_unused]] _TV __x)
+        {
+#if __FINITE_MATH_ONLY__
+          return {}; // false
+#else
+          using _Tp = __value_type_of<_TV>;
+          return _SuperImpl::_S_equal_to(_SuperImpl::_S_abs(__x),
+                                         __vec_broadcast<_S_size>(__infinity_v<_Tp>));
+          // alternative:
+          // compare to inf using the corresponding integer type
+          /*
+             return
+             __vector_bitcast<_Tp>(__vector_bitcast<__make_signed_int_t<_Tp>>(
+          _S_abs(__x))
+          ==
+          __vector_bitcast<__make_signed_int_t<_Tp>>(__vec_broadcast<_Np>(
+          __infinity_v<_Tp>)));
+           */
+#endif
+        }
+
+      template <__vec_builtin _TV>
+        _GLIBCXX_SIMD_INTRINSIC static constexpr _MaskMember<_TV>
+        _S_isnormal(_TV __x)
+        {
+          using _Tp = __value_type_of<_TV>;
+          using _IV = __vec_builtin_type<__make_signed_int_t<_Tp>, _S_full_size>;
+          const auto __absn = __builtin_bit_cast(_IV, _SuperImpl::_S_abs(__x));
+          const auto __minn = __builtin_bit_cast(
+                                _IV, __vec_broadcast<_S_size>(__norm_min_v<_Tp>));
+#if __FINITE_MATH_ONLY__
+          return __absn >= __minn;
+#else
+          const auto __maxn
+            = __builtin_bit_cast(_IV, __vec_broadcast<_S_size>(__finite_max_v<_Tp>));
+          return __minn <= __absn and __absn <= __maxn;
+#endif
+        }
+
+      template <__vec_builtin _TV>
+        _GLIBCXX_SIMD_INTRINSIC static constexpr
+        typename _Abi::template _Rebind<__make_dependent_t<int, _TV>>::template _SimdMember<int>
+        _S_fpclassify(_TV __x)
+        {
+          using _RAbi = typename _Abi::template _Rebind<int>;
+          using _RV = typename _RAbi::template _SimdMember<int>;
+          using _Tp = __value_type_of<_TV>;
+          using _Ip = __make_signed_int_t<_Tp>;
+          using _IV = __vec_builtin_type<_Ip, _S_full_size>;
+          const auto __xn = __builtin_bit_cast(_IV, _SuperImpl::_S_abs(__x));
+          constexpr size_t _NI = sizeof(__xn) / sizeof(_Ip);
+          constexpr auto __minn = __builtin_bit_cast(_IV, __vec_broadcast<_NI>(__norm_min_v<_Tp>));
+          constexpr auto __fp_normal = __vec_broadcast<_NI, _Ip>(FP_NORMAL);
+#if !__FINITE_MATH_ONLY__
+          constexpr auto __infn = __builtin_bit_cast(_IV, __vec_broadcast<_NI>(__infinity_v<_Tp>));
+          constexpr auto __fp_nan = __vec_broadcast<_NI, _Ip>(FP_NAN);
+          constexpr auto __fp_infinite = __vec_broadcast<_NI, _Ip>(FP_INFINITE);
+#endif
+#ifndef __FAST_MATH__
+          constexpr auto __fp_subnormal = __vec_broadcast<_NI, _Ip>(FP_SUBNORMAL);
+#endif
+          constexpr auto __fp_zero = __vec_broadcast<_NI, _Ip>(FP_ZERO);
+          _IV __tmp = (__xn < __minn)
+#ifdef __FAST_MATH__
+                        ? __fp_zero
+#else
+                        ? (__xn == 0 ? __fp_zero : __fp_subnormal)
+#endif
+#if __FINITE_MATH_ONLY__
+                        : __fp_normal;
+#else
+                        : (__xn < __infn ? __fp_normal
+                                         : (__xn == __infn ? __fp_infinite : __fp_nan));
+#endif
+          return _S_to_int_member(__tmp);
+        }
+
+      // Converts __x, which holds integers of the same width as the floating-point lanes, to the
+      // member type of rebind_simd_t<int, V>. For double this narrows 8-byte to 4-byte lanes.
+      template <__vec_builtin _IV>
+        _GLIBCXX_SIMD_INTRINSIC static constexpr
+        typename _Abi::template _Rebind<__make_dependent_t<int, _IV>>::template _SimdMember<int>
+        _S_to_int_member(_IV __x)
+        {
+          using _RAbi = typename _Abi::template _Rebind<int>;
+          using _RV = typename _RAbi::template _SimdMember<int>;
+          if constexpr (is_same_v<_IV, _RV>)
+            return __x;
+          else if constexpr (__vec_builtin<_RV>)
+            return __builtin_convertvector(__x, _RV);
+          else
+            return _RAbi::_SimdImpl::template _S_generator<int>(
+                     [&] [[__gnu__::__always_inline__]] (auto __i) {
+                       return static_cast<int>(__x[__i.value]);
+                     });
+        }
+
+      // [c.math] exponent and significand manipulation
+      // Returns the exponent of __x as integers of the same width as the floating-point lanes.
+      // Subnormal __x are scaled into the normal range (the scale is accounted for in the returned
+      // exponent). Zero returns min_exponent - 1 - digits, ∞ and NaN return max_exponent.
+      template <__vec_builtin _TV>
+        _GLIBCXX_SIMD_INTRINSIC static constexpr
+        __vec_builtin_type<__make_signed_int_t<__value_type_of<_TV>>, __width_of<_TV>>
+        _S_exponent_of(_TV& __x)
+        {
+          using _Tp = __value_type_of<_TV>;
+          using _IV = __vec_builtin_type<__make_signed_int_t<_Tp>, __width_of<_TV>>;
+          constexpr int __mant_bits = __digits_v<_Tp> - 1;
+          constexpr int __bias = __max_exponent_v<_Tp> - 1;
+          constexpr _IV __exp_mask = _IV() + (2 * __max_exponent_v<_Tp> - 1);
+#ifdef __FAST_MATH__
+          constexpr _IV __offset = _IV() + __bias;
+#else
+          const auto __subnormal = _S_fabs(__x) < __norm_min_v<_Tp>;
+          __x = __subnormal ? __x * _Tp(1ull << __digits_v<_Tp>) : __x;
+          const _IV __offset = __subnormal ? _IV() + (__bias + __digits_v<_Tp>) : _IV() + __bias;
+#endif
+          return ((__builtin_bit_cast(_IV, __x) >> __mant_bits) & __exp_mask) - __offset;
+        }
+
+      template <__vec_builtin _TV>
+        requires is_floating_point_v<__value_type_of<_TV>>
+        _GLIBCXX_SIMD_INTRINSIC static constexpr _TV
+        _S_logb(_TV __x)
+        {
+          using _Tp = __value_type_of<_TV>;
+          using _IV = __vec_builtin_type<__make_signed_int_t<_Tp>, __width_of<_TV>>;
+          _TV __ax = _S_fabs(__x);
+          const _IV __e = _S_exponent_of(__ax);
+          // adding __e to the bits of 1.5 * 2^mant_bits adds __e to its value (see _S_ldexp_fp)
+          constexpr _Tp __shifter = 0x1.8p0 * (1ull << (__digits_v<_Tp> - 1));
+          const _TV __r
+            = __builtin_bit_cast(_TV, __builtin_bit_cast(_IV, _TV() + __shifter) + __e) - __shifter;
+#if __FINITE_MATH_ONLY__
+          return __r;
+#else
+          constexpr _IV __inf_bits = __builtin_bit_cast(_IV, _TV() + __infinity_v<_Tp>);
+          return __ax == _Tp() ? _TV() - __infinity_v<_Tp>
+                               : __builtin_bit_cast(_IV, __ax) < __inf_bits ? __r : __ax * __ax;
+#endif
+        }
+
+      template <__vec_builtin _TV>
+        requires is_floating_point_v<__value_type_of<_TV>>
+        _GLIBCXX_SIMD_INTRINSIC static constexpr
+        typename _Abi::template _Rebind<__make_dependent_t<int, _TV>>::template _SimdMember<int>
+        _S_ilogb(_TV __x)
+        {
+          using _Tp = __value_type_of<_TV>;
+          using _IV = __vec_builtin_type<__make_signed_int_t<_Tp>, __width_of<_TV>>;
+          _TV __ax = _S_fabs(__x);
+          const _IV __e = _S_exponent_of(__ax);
+          const _IV __bits = __builtin_bit_cast(_IV, __ax);
+#if __FINITE_MATH_ONLY__
+          return _S_to_int_member(__bits == 0 ? _IV() + FP_ILOGB0 : __e);
+#else
+          constexpr _IV __inf_bits = __builtin_bit_cast(_IV, _TV() + __infinity_v<_Tp>);
+          return _S_to_int_member(__bits == 0 ? _IV() + FP_ILOGB0
+                                              : __bits < __inf_bits ? __e
+                                              : __bits == __inf_bits ? _IV() + __INT_MAX__
+                                                                     : _IV() + FP_ILOGBNAN);
+#endif
+        }
+
+      // Returns the significand of __x in [0.5, 1) and stores the exponent to __exp. ±0, ±∞, and
+      // NaN are returned unchanged with an exponent of 0.
+      template <__vec_builtin _TV>
+        requires is_floating_point_v<__value_type_of<_TV>>
+        _GLIBCXX_SIMD_INTRINSIC static constexpr _TV
+        _S_frexp(_TV __x, typename _Abi::template _Rebind<
+                            __make_dependent_t<int, _TV>>::template _SimdMember<int>& __exp)
+        {
+          using _Tp = __value_type_of<_TV>;
+          using _IV = __vec_builtin_type<__make_signed_int_t<_Tp>, __width_of<_TV>>;
+          constexpr _IV __exp_bits = __builtin_bit_cast(_IV, _TV() + __infinity_v<_Tp>);
+          constexpr _IV __half_bits = _IV() + __builtin_bit_cast(__make_signed_int_t<_Tp>, _Tp(.5));
+          _TV __xs = __x;
+          const _IV __e = _S_exponent_of(__xs) + 1;
+          const _TV __m = __builtin_bit_cast(
+                            _TV, (__builtin_bit_cast(_IV, __xs) & ~__exp_bits) | __half_bits);
+          const _IV __abits = __builtin_bit_cast(_IV, _S_fabs(__x));
+#if __FINITE_MATH_ONLY__
+          const auto __special = __abits == 0;
+#else
+          const auto __special = (__abits == 0) | (__abits >= __exp_bits);
+#endif
+          __exp = _S_to_int_member(__special ? _IV() : __e);
+          return __special ? __x : __m;
+        }
+
+      // Returns __x * 2^__exp for any int __exp, rounding only once (also for subnormal results).
+      template <__vec_builtin _TV>
+        requires is_floating_point_v<__value_type_of<_TV>>
+        _GLIBCXX_SIMD_INTRINSIC static constexpr _TV
+        _S_ldexp(_TV __x, typename _Abi::template _Rebind<
+                            __make_dependent_t<int, _TV>>::template _SimdMember<int> __exp)
+        {
+          using _Tp = __value_type_of<_TV>;
+          using _UV = __vec_builtin_type<__make_unsigned_int_t<_Tp>, __width_of<_TV>>;
+          using _RAbi = typename _Abi::template _Rebind<int>;
+          using _RV = typename _RAbi::template _SimdMember<int>;
+          constexpr int __mant_bits = __digits_v<_Tp> - 1;
+          constexpr int __max_exp = __max_exponent_v<_Tp> - 1;
+          constexpr int __min_exp = __min_exponent_v<_Tp> - 1;
+          // multiplying by 2^(min_exp + digits) keeps the intermediate product exact unless the
+          // result underflows to zero (the approach of musl's scalbn)
+          constexpr int __down = __min_exp + __digits_v<_Tp>;
+          constexpr _Tp __up_scale = __builtin_ldexp(1., __max_exp);
+          constexpr _Tp __down_scale = __builtin_ldexp(1., __down);
+          // beyond ±__lim every finite non-zero __x overflows or underflows to zero
+          constexpr _Tp __lim = 2 * __max_exponent_v<_Tp> + __digits_v<_Tp>;
+          _TV __n;
+          if constexpr (__vec_builtin<_RV>)
+            __n = _SimdConverter<int, _RAbi, _Tp, _Abi>()(__exp);
+          else // e.g. 8 floats without AVX2
+            __n = _S_generator<_Tp>([&] [[__gnu__::__always_inline__]] (auto __i) {
+                    return static_cast<_Tp>(_RAbi::_SimdImpl::_S_get(__exp, __i));
+                  });
+          __n = __n > __lim ? _TV() + __lim : __n < -__lim ? _TV() - __lim : __n;
+          for (int __i = 0; __i < 2; ++__i)
+            {
+              const auto __up = __n > _Tp(__max_exp);
+              __x = __up ? __x * __up_scale : __x;
+              __n = __up ? __n - _Tp(__max_exp) : __n;
+              const auto __dn = __n < _Tp(__min_exp);
+              __x = __dn ? __x * __down_scale : __x;
+              __n = __dn ? __n - _Tp(__down) : __n;
+            }
+          // 2^__n is a normal number now
+          constexpr _Tp __shifter = 0x1.8p0 * (1ull << __mant_bits);
+          const _UV __nbits = __builtin_bit_cast(_UV, __n + __shifter);
+          return __x * __builtin_bit_cast(_TV, (__nbits + __max_exp) << __mant_bits);
+        }
+
+      // Returns the fractional part of __x and stores the integral part to __iptr. Both have the
+      // sign of __x.
+      template <__vec_builtin _TV>
+        requires is_floating_point_v<__value_type_of<_TV>>
+        _GLIBCXX_SIMD_INTRINSIC static constexpr _TV
+        _S_modf(_TV __x, _TV& __iptr)
+        {
+          const _TV __sign = __vec_andnot(_S_absmask<_TV>, __x);
+          // the sign of an integral part of zero is not preserved by every _S_trunc implementation
+          __iptr = __vec_or(__sign, _SuperImpl::_S_trunc(__x));
+          // integral __x, including ±∞, have a fractional part of ±0
+          return __x == __iptr ? __sign : __x - __iptr;
         }
 
       template <__vec_builtin _TV>
@@ -969,9 +3307,11 @@ namespace std::__detail
                   else if constexpr (sizeof(_TV) < 8)
                     {
                       using _Up = __make_unsigned_int_t<_TV>;
+                      using _Ep = __make_unsigned_int_t<__value_type_of<_TV>>;
+                      constexpr int __bits = __CHAR_BIT__ * sizeof(_Ep);
                       _Up __tmp = __builtin_bit_cast(_Up, __k)
                                     & _GLIBCXX_SIMD_INT_PACK(_S_size, _Is, {
-                                        return ((_Up(__rhs) << (_Is * __CHAR_BIT__)) | ...);
+                                        return ((_Up(_Ep(__rhs)) << (_Is * __bits)) | ...);
                                       });
                       __lhs = __builtin_bit_cast(_TV, __tmp);
                       return;
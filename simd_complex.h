@@ -0,0 +1,305 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later WITH GCC-exception-3.1 */
+/* Copyright © 2025      GSI Helmholtzzentrum fuer Schwerionenforschung GmbH
+ *                       Matthias Kretz <m.kretz@gsi.de>
+ */
+
+#ifndef PROTOTYPE_SIMD_COMPLEX_H_
+#define PROTOTYPE_SIMD_COMPLEX_H_
+
+#include "simd.h"
+#include "loadstore.h"
+#include "permute.h"
+#include "simd_math.h"
+
+#include <complex>
+
+// P2663R7 Interleaved complex values support in std::simd
+//
+// basic_simd<complex<T>, Abi> stores its N values as 2N interleaved (real, imaginary) values of
+// type T in a basic_simd<T, Abi>. Consequently, Abi is the ABI tag of the 2N-element real simd
+// and contiguous complex<T> ranges load and store without shuffles.
+//
+// Deviations from P2663R7:
+// - mask_type is the mask type of the real simd with N elements (basic_simd_mask<sizeof(T)>).
+// - Multiplication, division, and abs use the textbook formulas (like -fcx-limited-range). They
+//   do not recover infinities from NaN results and can overflow/underflow for extreme values.
+// - arg, proj, polar, and the transcendental functions are not implemented yet.
+
+namespace std
+{
+  namespace __detail
+  {
+    // complex of the extended floating-point types (e.g. float16_t) is not implemented
+    template <__vectorizable _Tp>
+      requires same_as<_Tp, float> or same_as<_Tp, double>
+      struct __is_vectorizable_complex<complex<_Tp>>
+      : bool_constant<true>
+      {};
+
+    template <typename _Tp, _SimdSizeType _Np>
+      requires __is_vectorizable_complex<_Tp>::value
+      struct _DeduceAbi<_Tp, _Np>
+      { using type = __deduce_t<typename _Tp::value_type, 2 * _Np>; };
+  }
+
+  template <typename _Tp, typename _Abi>
+    requires __detail::__is_vectorizable_complex<_Tp>::value and requires { _Abi::_S_size; }
+    struct __simd_size<_Tp, _Abi>
+    : integral_constant<__detail::_SimdSizeType, _Abi::_S_size / 2>
+    {};
+
+  // loads and stores reinterpret the complex<T> range as a range of twice as many T
+
+  template <class _Vp = void, __detail::__sized_contiguous_range _Rg, typename... _Flags>
+    requires __detail::__is_vectorizable_complex<ranges::range_value_t<_Rg>>::value
+    _GLIBCXX_SIMD_ALWAYS_INLINE
+    constexpr __detail::__simd_load_return_t<_Vp, ranges::range_value_t<_Rg>>
+    simd_unchecked_load(_Rg&& __r, simd_flags<_Flags...> __f = {})
+    {
+      using _RV = __detail::__simd_load_return_t<_Vp, ranges::range_value_t<_Rg>>;
+      using _Cp = typename _RV::value_type;
+      using _Tp = typename _Cp::value_type;
+      static_assert(is_same_v<remove_cv_t<ranges::range_value_t<_Rg>>, _Cp>,
+                    "converting loads of complex values are not supported");
+      using _RealSimd = decltype(declval<const _RV&>()._M_data);
+      constexpr size_t __static_size = __detail::__static_range_size(__r);
+      if consteval
+        {
+          const auto __rg_size = ranges::size(__r);
+          return _RV([&](size_t __i) {
+                   return __i < __rg_size ? ranges::data(__r)[__i] : _Cp();
+                 });
+        }
+      else
+        {
+          const _Tp* __ptr = reinterpret_cast<const _Tp*>(ranges::data(__r));
+          if constexpr (__static_size == dynamic_extent)
+            return {__detail::__private_init,
+                    simd_unchecked_load<_RealSimd>(
+                      span<const _Tp>(__ptr, 2 * ranges::size(__r)), __f)};
+          else
+            return {__detail::__private_init,
+                    simd_unchecked_load<_RealSimd>(
+                      span<const _Tp, 2 * __static_size>(__ptr, 2 * __static_size), __f)};
+        }
+    }
+
+  template <typename _Tp, typename _Abi, __detail::__sized_contiguous_range _Rg, typename... _Flags>
+    requires indirectly_writable<ranges::iterator_t<_Rg>, complex<_Tp>>
+    _GLIBCXX_SIMD_ALWAYS_INLINE
+    constexpr void
+    simd_unchecked_store(const basic_simd<complex<_Tp>, _Abi>& __v, _Rg&& __r,
+                         simd_flags<_Flags...> __f = {})
+    {
+      static_assert(is_same_v<ranges::range_value_t<_Rg>, complex<_Tp>>,
+                    "converting stores of complex values are not supported");
+      constexpr size_t __static_size = __detail::__static_range_size(__r);
+      if consteval
+        {
+          constexpr bool __allow_out_of_bounds
+            = (... or (is_same_v<_Flags, __detail::_Throw>
+                         or is_same_v<_Flags, __detail::_AllowPartialLoadStore>));
+          const size_t __rg_size = ranges::size(__r);
+          const size_t __n = __allow_out_of_bounds and __rg_size < __v.size() ? __rg_size
+                                                                                : __v.size();
+          for (size_t __i = 0; __i < __n; ++__i)
+            ranges::data(__r)[__i] = __v[__i];
+        }
+      else
+        {
+          _Tp* __ptr = reinterpret_cast<_Tp*>(ranges::data(__r));
+          if constexpr (__static_size == dynamic_extent)
+            simd_unchecked_store(__v._M_data, span<_Tp>(__ptr, 2 * ranges::size(__r)), __f);
+          else
+            simd_unchecked_store(__v._M_data, span<_Tp, 2 * __static_size>(__ptr, 2 * __static_size),
+                                 __f);
+        }
+    }
+
+  template <typename _Tp, typename _Abi>
+    requires __detail::__is_vectorizable_complex<complex<_Tp>>::value
+      and __detail::__valid_abi_tag<_Abi, _Tp> and (_Abi::_S_size % 2 == 0)
+    class basic_simd<complex<_Tp>, _Abi>
+    {
+      using _RealSimd = basic_simd<_Tp, _Abi>;
+
+      using _RealMask = typename _RealSimd::mask_type;
+
+      static constexpr _RealMask _S_imag_lanes = _RealMask([](int __i) { return __i % 2 == 1; });
+
+    public:
+      // interleaved (real, imaginary) pairs
+      _RealSimd _M_data;
+
+      using value_type = complex<_Tp>;
+
+      using abi_type = _Abi;
+
+      static constexpr auto size = __detail::__ic<_Abi::_S_size / 2>;
+
+      using real_type = simd<_Tp, size.value>;
+
+      using mask_type = typename real_type::mask_type;
+
+      constexpr
+      basic_simd() = default;
+
+      constexpr
+      basic_simd(__detail::_PrivateInit, const _RealSimd& __init)
+      : _M_data(__init)
+      {}
+
+      // broadcast constructor
+      template <typename _Up>
+        requires convertible_to<_Up, value_type>
+        constexpr
+        basic_simd(const _Up& __x) noexcept
+        : _M_data([__c = static_cast<value_type>(__x)](int __i) {
+            return __i % 2 == 0 ? __c.real() : __c.imag();
+          })
+        {}
+
+      constexpr
+      basic_simd(const real_type& __reals, const real_type& __imags = {}) noexcept
+      : _M_data([&](auto __i) {
+          if constexpr (__i % 2 == 0)
+            return __reals[__i / 2];
+          else
+            return __imags[__i / 2];
+        })
+      {}
+
+      // generator constructor, calls __gen exactly once per element
+      template <__detail::__simd_generator_invokable<value_type, size.value> _Fp>
+        constexpr explicit
+        basic_simd(_Fp&& __gen)
+        : _M_data(_GLIBCXX_SIMD_INT_PACK(size.value, _Is, {
+                    const value_type __values[] = {static_cast<value_type>(
+                                                     __gen(__detail::__ic<_Is>))...};
+                    return _RealSimd([&](int __i) {
+                             return __i % 2 == 0 ? __values[__i / 2].real()
+                                                 : __values[__i / 2].imag();
+                           });
+                  }))
+        {}
+
+      template <__detail::__static_sized_range<size.value> _Rg, typename... _Flags>
+        constexpr // implicit!
+        basic_simd(_Rg&& __range, simd_flags<_Flags...> __flags = {})
+        : _M_data(std::simd_unchecked_load<basic_simd>(__range, __flags)._M_data)
+        {}
+
+      constexpr value_type
+      operator[](__detail::_SimdSizeType __i) const
+      {
+        __glibcxx_simd_precondition(__i >= 0 and __i < size.value, "subscript is out of bounds");
+        return value_type(_M_data[2 * __i], _M_data[2 * __i + 1]);
+      }
+
+      constexpr real_type
+      real() const noexcept
+      { return permute<size.value>(_M_data, [](int __i) { return 2 * __i; }); }
+
+      constexpr real_type
+      imag() const noexcept
+      { return permute<size.value>(_M_data, [](int __i) { return 2 * __i + 1; }); }
+
+      constexpr void
+      real(const real_type& __x) noexcept
+      { *this = basic_simd(__x, imag()); }
+
+      constexpr void
+      imag(const real_type& __x) noexcept
+      { *this = basic_simd(real(), __x); }
+
+      // unary operators
+      constexpr basic_simd
+      operator+() const noexcept
+      { return *this; }
+
+      constexpr basic_simd
+      operator-() const noexcept
+      { return {__detail::__private_init, -_M_data}; }
+
+      // binary operators
+      friend constexpr basic_simd
+      operator+(const basic_simd& __x, const basic_simd& __y) noexcept
+      { return {__detail::__private_init, __x._M_data + __y._M_data}; }
+
+      friend constexpr basic_simd
+      operator-(const basic_simd& __x, const basic_simd& __y) noexcept
+      { return {__detail::__private_init, __x._M_data - __y._M_data}; }
+
+      friend constexpr basic_simd
+      operator*(const basic_simd& __x, const basic_simd& __y) noexcept
+      {
+        return {__detail::__private_init,
+                _RealSimd(__detail::__private_init,
+                          _RealSimd::_Impl::_S_complex_multiplies(__data(__x._M_data),
+                                                                  __data(__y._M_data)))};
+      }
+
+      /**
+       * x * conj(y) / norm(y), with the norm of each value in both lanes of its pair.
+       */
+      friend constexpr basic_simd
+      operator/(const basic_simd& __x, const basic_simd& __y) noexcept
+      {
+        const _RealSimd __squares = __y._M_data * __y._M_data;
+        const _RealSimd __norms = __squares + permute(__squares, permutations::swap_neighbors<>);
+        return {__detail::__private_init, (__x * conj(__y))._M_data / __norms};
+      }
+
+      friend constexpr basic_simd&
+      operator+=(basic_simd& __x, const basic_simd& __y) noexcept
+      { return __x = __x + __y; }
+
+      friend constexpr basic_simd&
+      operator-=(basic_simd& __x, const basic_simd& __y) noexcept
+      { return __x = __x - __y; }
+
+      friend constexpr basic_simd&
+      operator*=(basic_simd& __x, const basic_simd& __y) noexcept
+      { return __x = __x * __y; }
+
+      friend constexpr basic_simd&
+      operator/=(basic_simd& __x, const basic_simd& __y) noexcept
+      { return __x = __x / __y; }
+
+      // compares
+      friend constexpr mask_type
+      operator==(const basic_simd& __x, const basic_simd& __y) noexcept
+      { return __x.real() == __y.real() and __x.imag() == __y.imag(); }
+
+      friend constexpr mask_type
+      operator!=(const basic_simd& __x, const basic_simd& __y) noexcept
+      { return __x.real() != __y.real() or __x.imag() != __y.imag(); }
+
+      // non-members of P2663
+      friend constexpr real_type
+      real(const basic_simd& __x) noexcept
+      { return __x.real(); }
+
+      friend constexpr real_type
+      imag(const basic_simd& __x) noexcept
+      { return __x.imag(); }
+
+      friend constexpr basic_simd
+      conj(const basic_simd& __x) noexcept
+      { return {__detail::__private_init, simd_select(_S_imag_lanes, -__x._M_data, __x._M_data)}; }
+
+      friend constexpr real_type
+      norm(const basic_simd& __x) noexcept
+      {
+        const _RealSimd __squares = __x._M_data * __x._M_data;
+        return permute<size.value>(__squares, [](int __i) { return 2 * __i; })
+                 + permute<size.value>(__squares, [](int __i) { return 2 * __i + 1; });
+      }
+
+      friend constexpr real_type
+      abs(const basic_simd& __x) noexcept
+      { return sqrt(norm(__x)); }
+    };
+}
+
+#endif  // PROTOTYPE_SIMD_COMPLEX_H_
@@ -33,7 +33,12 @@ namespace std::__detail
 
       _GLIBCXX_SIMD_INTRINSIC constexpr _ToV
       operator()(_FromV __from) const
-      { return __vec_convert<_ToV>(__from); }
+      {
+        if constexpr (is_integral_v<_From> and is_integral_v<_To> and sizeof(_From) == sizeof(_To))
+          return __vec_bitcast<_To>(__from); // only the signedness changes
+        else
+          return __vec_convert<_ToV>(__from);
+      }
     };
 
   template <__vectorizable_canon _From, __vectorizable_canon _To, int _Width, int _Np>
@@ -42,9 +47,71 @@ namespace std::__detail
       using _FromV = typename _VecAbi<_Width>::template _SimdMember<_From>;
       using _ToV = typename _VecAbi<_Width * _Np>::template _SimdMember<_To>;
 
+      // the parts are converted here rather than in the variadic __vec_convert, so that
+      // target-specific __vec_convert overloads are found
       _GLIBCXX_SIMD_INTRINSIC constexpr _ToV
       operator()(const array<_FromV, _Np>& __x) const
-      { return _GLIBCXX_SIMD_INT_PACK(_Np, _Is, { return __vec_convert<_ToV>(__x[_Is]...); }); }
+      {
+        using _T2 = __vec_builtin_type_bytes<_To, sizeof(_ToV) / std::__bit_ceil(unsigned(_Np))>;
+        return _GLIBCXX_SIMD_INT_PACK(_Np, _Is, {
+                 return __vec_concat(__vec_convert<_T2>(__x[_Is])...);
+               });
+      }
+    };
+
+  // widening conversions, e.g. float16_t -> float, split one vector into an array of vectors
+  template <__vectorizable_canon _From, __vectorizable_canon _To, int _Width, int _Np>
+    struct _SimdConverter<_From, _VecAbi<_Width * _Np>, _To, _AbiArray<_VecAbi<_Width>, _Np>>
+    {
+      using _FromV = typename _VecAbi<_Width * _Np>::template _SimdMember<_From>;
+      using _To0V = typename _VecAbi<_Width>::template _SimdMember<_To>;
+      using _ToV = array<_To0V, _Np>;
+
+      _GLIBCXX_SIMD_INTRINSIC constexpr _ToV
+      operator()(_FromV __x) const
+      {
+        constexpr int __parts = __width_of<_FromV> / __width_of<_To0V>;
+        return _GLIBCXX_SIMD_INT_PACK(_Np, _Is, {
+                 return _ToV{__vec_convert<_To0V>(__vec_extract_part<_Is, __parts>(__x))...};
+               });
+      }
+    };
+
+  // arrays with different partitioning, e.g. float16_t <-> float
+  template <__vectorizable_canon _From, __vectorizable_canon _To, int _W0, int _N0, int _W1,
+            int _N1>
+    requires (_W0 * _N0 == _W1 * _N1) and (_W0 != _W1)
+    struct _SimdConverter<_From, _AbiArray<_VecAbi<_W0>, _N0>, _To, _AbiArray<_VecAbi<_W1>, _N1>>
+    {
+      using _FromV = typename _AbiArray<_VecAbi<_W0>, _N0>::template _SimdMember<_From>;
+      using _ToV = typename _AbiArray<_VecAbi<_W1>, _N1>::template _SimdMember<_To>;
+
+      _GLIBCXX_SIMD_INTRINSIC constexpr _ToV
+      operator()(const _FromV& __x) const
+      {
+        _ToV __r;
+        if constexpr (_W0 > _W1)
+          {
+            constexpr int __parts = _W0 / _W1;
+            _SimdConverter<_From, _VecAbi<_W0>, _To, _AbiArray<_VecAbi<_W1>, __parts>> __cvt;
+            for (int __i = 0; __i < _N0; ++__i)
+              {
+                const auto __tmp = __cvt(__x[__i]);
+                for (int __j = 0; __j < __parts; ++__j)
+                  __r[__i * __parts + __j] = __tmp[__j];
+              }
+          }
+        else
+          {
+            constexpr int __parts = _W1 / _W0;
+            _SimdConverter<_From, _AbiArray<_VecAbi<_W0>, __parts>, _To, _VecAbi<_W1>> __cvt;
+            for (int __i = 0; __i < _N1; ++__i)
+              __r[__i] = _GLIBCXX_SIMD_INT_PACK(__parts, _Is, {
+                           return __cvt({__x[__i * __parts + _Is]...});
+                         });
+          }
+        return __r;
+      }
     };
 
   template <__vectorizable_canon _From, __vectorizable_canon _To, int _Np, int _Mp>
@@ -84,6 +151,57 @@ namespace std::__detail
       }
     };
 
+  template <__vectorizable_canon _From, __vectorizable_canon _To>
+    requires (not std::is_same_v<_To, _From>)
+    struct _SimdConverter<_From, _ScalarAbi, _To, _ScalarAbi>
+    {
+      _GLIBCXX_SIMD_INTRINSIC constexpr _To
+      operator()(_From __x) const
+      { return static_cast<_To>(__x); }
+    };
+
+  template <__vectorizable_canon _From, __vectorizable_canon _To, typename _Abi0, int _Np>
+    requires (not std::is_same_v<_To, _From>)
+    struct _SimdConverter<_From, _AbiArray<_Abi0, _Np>, _To, _AbiArray<_Abi0, _Np>>
+    {
+      using _FromV = typename _AbiArray<_Abi0, _Np>::template _SimdMember<_From>;
+      using _ToV = typename _AbiArray<_Abi0, _Np>::template _SimdMember<_To>;
+
+      _GLIBCXX_SIMD_INTRINSIC constexpr _ToV
+      operator()(const _FromV& __x) const
+      {
+        _SimdConverter<_From, _Abi0, _To, _Abi0> __cvt0;
+        return _GLIBCXX_SIMD_INT_PACK(_Np, _Is, { return _ToV{__cvt0(__x[_Is])...}; });
+      }
+    };
+
+  // equal sizeof implies equal partitioning of the _SimdTuple
+  template <__vectorizable_canon _From, __vectorizable_canon _To, int _Np, typename _Tag>
+    requires (not std::is_same_v<_To, _From>) and (sizeof(_From) == sizeof(_To))
+    struct _SimdConverter<_From, _AbiCombine<_Np, _Tag>, _To, _AbiCombine<_Np, _Tag>>
+    {
+      using _FromV = typename _AbiCombine<_Np, _Tag>::template _SimdMember<_From>;
+      using _ToV = typename _AbiCombine<_Np, _Tag>::template _SimdMember<_To>;
+
+      template <typename _ToT, typename _FromT>
+        _GLIBCXX_SIMD_INTRINSIC static constexpr _ToT
+        _S_convert(const _FromT& __x)
+        {
+          static_assert(_FromT::_S_size == _ToT::_S_size);
+          _SimdConverter<_From, typename _FromT::_Abi0, _To, typename _ToT::_Abi0> __cvt0;
+          if constexpr (_FromT::_S_recurse)
+            return _ToT(__cvt0(__x._M_x),
+                        _S_convert<remove_cvref_t<decltype(declval<const _ToT&>()._M_tail)>>(
+                          __x._M_tail));
+          else
+            return _ToT(__cvt0(__x._M_x));
+        }
+
+      _GLIBCXX_SIMD_INTRINSIC constexpr _ToV
+      operator()(const _FromV& __x) const
+      { return _S_convert<_ToV>(__x); }
+    };
+
   // fallback (not optimized)
   template <__vectorizable_canon _From, __simd_abi_tag _FAbi,
             __vectorizable_canon _To, __simd_abi_tag _TAbi>
@@ -0,0 +1,188 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later WITH GCC-exception-3.1 */
+/* Copyright © 2025      GSI Helmholtzzentrum fuer Schwerionenforschung GmbH
+ *                       Matthias Kretz <m.kretz@gsi.de>
+ */
+
+#ifndef PROTOTYPE_SIMD_DISPATCH_H_
+#define PROTOTYPE_SIMD_DISPATCH_H_
+
+#include "simd.h"
+
+// Runtime ISA dispatch.
+//
+// The ABI tags (and thus the width of simd<T>) and the instructions used by the implementation
+// are determined from the target macros of the translation unit (see simd_config.h). A
+// `[[gnu::target]]` attribute does not change them. Therefore one binary with native-width
+// basic_simd on every host needs one translation unit per ISA level. The kernel is written once,
+// inside `namespace SIMD_ISA_NAMESPACE`, and that TU is compiled once per ISA level, e.g. with
+// -march=x86-64, -march=x86-64-v2, -march=x86-64-v3, and -march=x86-64-v4. SIMD_ISA_NAMESPACE
+// expands to a different name for each level, so the kernels don't collide at link time:
+//
+//   // kernel.cpp
+//   namespace SIMD_ISA_NAMESPACE
+//   {
+//     float sum(std::span<const float> x)
+//     { return std::simd_reduce(x); }
+//   }
+//
+// The caller is compiled for the baseline and lists the kernels in order of simd_isa:
+//
+//   namespace simd_isa_generic { float sum(std::span<const float>); }
+//   namespace simd_isa_x86_64_v3 { float sum(std::span<const float>); }
+//   namespace simd_isa_x86_64_v4 { float sum(std::span<const float>); }
+//
+//   float r = std::simd_dispatch<&simd_isa_generic::sum, nullptr, &simd_isa_x86_64_v3::sum,
+//                                &simd_isa_x86_64_v4::sum>(data);
+//
+// Caveat: non-template inline functions (and templates not depending on __build_flags) that are
+// defined in the kernel TUs are merged by the linker, possibly picking the copy compiled for the
+// highest ISA level. Declare helpers of the kernel inside SIMD_ISA_NAMESPACE (or with internal
+// linkage).
+
+#if _GLIBCXX_SIMD_HAVE_SSE3 and _GLIBCXX_SIMD_HAVE_SSSE3 and _GLIBCXX_SIMD_HAVE_SSE4_1            \
+      and _GLIBCXX_SIMD_HAVE_SSE4_2 and _GLIBCXX_SIMD_HAVE_POPCNT
+#if _GLIBCXX_SIMD_HAVE_AVX and _GLIBCXX_SIMD_HAVE_AVX2 and _GLIBCXX_SIMD_HAVE_BMI                 \
+      and _GLIBCXX_SIMD_HAVE_BMI2 and _GLIBCXX_SIMD_HAVE_F16C and _GLIBCXX_SIMD_HAVE_FMA           \
+      and _GLIBCXX_SIMD_HAVE_LZCNT
+#if _GLIBCXX_SIMD_HAVE_AVX512F and _GLIBCXX_SIMD_HAVE_AVX512BW and _GLIBCXX_SIMD_HAVE_AVX512CD     \
+      and _GLIBCXX_SIMD_HAVE_AVX512DQ and _GLIBCXX_SIMD_HAVE_AVX512VL
+#define _GLIBCXX_SIMD_ISA_LEVEL x86_64_v4
+#else
+#define _GLIBCXX_SIMD_ISA_LEVEL x86_64_v3
+#endif
+#else
+#define _GLIBCXX_SIMD_ISA_LEVEL x86_64_v2
+#endif
+#else
+#define _GLIBCXX_SIMD_ISA_LEVEL generic
+#endif
+
+#define _GLIBCXX_SIMD_ISA_NAMESPACE_IMPL(level) simd_isa_##level
+#define _GLIBCXX_SIMD_ISA_NAMESPACE(level) _GLIBCXX_SIMD_ISA_NAMESPACE_IMPL(level)
+
+/**
+ * The name of the namespace for kernels compiled in this translation unit.
+ */
+#define SIMD_ISA_NAMESPACE _GLIBCXX_SIMD_ISA_NAMESPACE(_GLIBCXX_SIMD_ISA_LEVEL)
+
+namespace std
+{
+  /**
+   * ISA levels for dispatching. On x86 these are the micro-architecture levels of the x86-64
+   * psABI. Every other target only knows generic. Higher levels imply all lower levels.
+   */
+  enum class simd_isa : unsigned char
+  {
+    generic = 1,
+    x86_64_v2,
+    x86_64_v3,
+    x86_64_v4
+  };
+
+  /**
+   * The ISA level the current translation unit is compiled for.
+   */
+  inline constexpr simd_isa simd_compiled_isa = simd_isa::_GLIBCXX_SIMD_ISA_LEVEL;
+
+  namespace __detail
+  {
+    inline simd_isa
+    __detect_host_isa() noexcept
+    {
+#if defined __x86_64__ or defined __i386__
+      __builtin_cpu_init();
+      if (not (__builtin_cpu_supports("sse3") and __builtin_cpu_supports("ssse3")
+                 and __builtin_cpu_supports("sse4.1") and __builtin_cpu_supports("sse4.2")
+                 and __builtin_cpu_supports("popcnt")))
+        return simd_isa::generic;
+      if (not (__builtin_cpu_supports("avx") and __builtin_cpu_supports("avx2")
+                 and __builtin_cpu_supports("bmi") and __builtin_cpu_supports("bmi2")
+                 and __builtin_cpu_supports("f16c") and __builtin_cpu_supports("fma")
+#ifndef __clang__
+                 and __builtin_cpu_supports("lzcnt")
+#endif
+              ))
+        return simd_isa::x86_64_v2;
+      if (not (__builtin_cpu_supports("avx512f") and __builtin_cpu_supports("avx512bw")
+                 and __builtin_cpu_supports("avx512cd") and __builtin_cpu_supports("avx512dq")
+                 and __builtin_cpu_supports("avx512vl")))
+        return simd_isa::x86_64_v3;
+      return simd_isa::x86_64_v4;
+#else
+      return simd_isa::generic;
+#endif
+    }
+  }
+
+  /**
+   * The highest ISA level the executing CPU supports. The CPU is queried only on the first call.
+   */
+  inline simd_isa
+  simd_host_isa() noexcept
+  {
+    static const simd_isa __isa = __detail::__detect_host_isa();
+    return __isa;
+  }
+
+  /**
+   * A kernel function together with the ISA level it was compiled for.
+   */
+  template <typename _Fp>
+    requires is_function_v<_Fp>
+    struct simd_kernel
+    {
+      simd_isa isa;
+      _Fp* fn;
+    };
+
+  template <typename _Fp>
+    simd_kernel(simd_isa, _Fp*) -> simd_kernel<_Fp>;
+
+  /**
+   * Returns the kernel for the highest ISA level not above __host. If several kernels have that
+   * level, the first one wins. Kernels with fn == nullptr are ignored. Returns nullptr if no
+   * kernel can execute on __host.
+   */
+  template <typename _Fp, same_as<simd_kernel<_Fp>>... _More>
+    constexpr _Fp*
+    simd_select_kernel(simd_isa __host, const simd_kernel<_Fp>& __k0, const _More&... __more)
+    {
+      _Fp* __fn = nullptr;
+      simd_isa __best = {};
+      for (const simd_kernel<_Fp>& __k : {__k0, __more...})
+        {
+          if (__k.fn != nullptr and __k.isa <= __host and __k.isa > __best)
+            {
+              __fn = __k.fn;
+              __best = __k.isa;
+            }
+        }
+      return __fn;
+    }
+
+  /**
+   * Calls the kernel for the best ISA level of the executing CPU with __args. The kernels are
+   * listed in the order of simd_isa, starting with generic. Pass nullptr for levels without a
+   * kernel.
+   *
+   * The kernel is selected on the first call and stored in a static, subsequent calls only cost
+   * an indirect call.
+   */
+  template <auto _Generic, auto... _Kernels, typename... _Args>
+    requires is_function_v<remove_pointer_t<decltype(_Generic)>>
+      and ((same_as<decltype(_Generic), decltype(_Kernels)>
+              or is_null_pointer_v<decltype(_Kernels)>) and ...)
+      and (sizeof...(_Kernels) < 4) and is_invocable_v<decltype(_Generic), _Args...>
+    inline decltype(auto)
+    simd_dispatch(_Args&&... __args)
+    {
+      using _Fp = remove_pointer_t<decltype(_Generic)>;
+      static _Fp* const __fn = []<size_t... _Is>(index_sequence<_Is...>) {
+        return simd_select_kernel(simd_host_isa(), simd_kernel<_Fp>{simd_isa::generic, _Generic},
+                                  simd_kernel<_Fp>{simd_isa(_Is + 2), _Kernels}...);
+      }(make_index_sequence<sizeof...(_Kernels)>());
+      return __fn(std::forward<_Args>(__args)...);
+    }
+}
+
+#endif  // PROTOTYPE_SIMD_DISPATCH_H_
@@ -0,0 +1,162 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later WITH GCC-exception-3.1 */
+/* Copyright © 2025      GSI Helmholtzzentrum fuer Schwerionenforschung GmbH
+ *                       Matthias Kretz <m.kretz@gsi.de>
+ */
+
+#ifndef PROTOTYPE_SIMD_DIVISOR_H_
+#define PROTOTYPE_SIMD_DIVISOR_H_
+
+#include "simd.h"
+
+#include <bit>
+
+// Division by a runtime-invariant integer via multiply-high and shift.
+// See T. Granlund and P. L. Montgomery, "Division by Invariant Integers using Multiplication",
+// PLDI 1994 (Figures 4.1 and 5.2).
+
+namespace std
+{
+  namespace __detail
+  {
+    template <typename _Up, typename _Vp>
+      struct __rebind_value_type
+      { using type = rebind_simd_t<_Up, _Vp>; };
+
+    template <typename _Up, __vectorizable _Vp>
+      struct __rebind_value_type<_Up, _Vp>
+      { using type = _Up; };
+
+    /**
+     * Returns the high half of the full product of __x and __y. _Vp is either _Tp or a
+     * basic_simd with value_type _Tp.
+     */
+    template <typename _Tp, typename _Vp>
+      _GLIBCXX_SIMD_ALWAYS_INLINE constexpr _Vp
+      __mulhi(const _Vp& __x, _Tp __y)
+      {
+        if constexpr (is_same_v<_Vp, _Tp>)
+          return _SimdImplScalar::_S_mulhi(__x, __y);
+        else
+          return _Vp(__private_init, _Vp::_Impl::_S_mulhi(__data(__x), __data(_Vp(__y))));
+      }
+  }
+
+  /**
+   * Precomputes the multiplier and shift counts for dividing by an invariant divisor. Division
+   * (and modulus) of a basic_simd<_Tp, _Abi> or _Tp by a simd_divisor<_Tp> is then implemented
+   * with one multiply-high, a few additions, and shifts.
+   */
+  template <typename _Tp>
+    requires integral<_Tp> and (not same_as<_Tp, bool>) and (sizeof(_Tp) <= 8)
+    class simd_divisor
+    {
+      using _Up = __detail::__make_unsigned_int_t<_Tp>;
+
+      static constexpr int _S_bits = __CHAR_BIT__ * sizeof(_Tp);
+
+      // unsigned __int128 is needed for computing the multiplier of 64-bit divisors
+      using _Wp = conditional_t<(sizeof(_Tp) < 8), unsigned long long, unsigned __int128>;
+
+      _Tp _M_divisor;
+
+      _Tp _M_multiplier;
+
+      // unsigned: the shift counts before and after adding the multiply-high result
+      // signed: _M_shift0 is the shift count, _M_shift1 is unused
+      int _M_shift0;
+
+      int _M_shift1;
+
+      // all bits set if the (signed) divisor is negative
+      _Up _M_sign = 0;
+
+      /**
+       * ceil(log2(__d)), __d > 0
+       */
+      static constexpr int
+      _S_ceil_log2(_Up __d)
+      { return __d == 1 ? 0 : _S_bits - std::countl_zero(_Up(__d - 1)); }
+
+      template <typename _Vp>
+        _GLIBCXX_SIMD_ALWAYS_INLINE constexpr _Vp
+        _M_divide(const _Vp& __x) const
+        {
+          using _UV = typename __detail::__rebind_value_type<_Up, _Vp>::type;
+          const _Vp __hi = __detail::__mulhi(__x, _M_multiplier);
+          if constexpr (is_unsigned_v<_Tp>)
+            return _Vp((__hi + _Vp((__x - __hi) >> _M_shift0)) >> _M_shift1);
+          else
+            { // the additions and subtractions wrap (only) for __x == min and |divisor| == 1
+              const _Vp __q0 = static_cast<_Vp>(static_cast<_UV>(__x) + static_cast<_UV>(__hi));
+              const _UV __q1 = static_cast<_UV>(__q0 >> _M_shift0)
+                                 - static_cast<_UV>(__x >> (_S_bits - 1));
+              return static_cast<_Vp>(static_cast<_UV>((__q1 ^ _M_sign) - _M_sign));
+            }
+        }
+
+      template <typename _Vp>
+        _GLIBCXX_SIMD_ALWAYS_INLINE constexpr _Vp
+        _M_modulus(const _Vp& __x) const
+        { return _Vp(__x - _Vp(_M_divide(__x) * _M_divisor)); }
+
+    public:
+      using value_type = _Tp;
+
+      constexpr explicit
+      simd_divisor(_Tp __d)
+      : _M_divisor(__d)
+      {
+        __glibcxx_simd_precondition(__d != 0, "division by zero");
+        if constexpr (is_unsigned_v<_Tp>)
+          {
+            const int __l = _S_ceil_log2(__d);
+            _M_multiplier = _Tp((((_Wp(1) << __l) - __d) << _S_bits) / __d + 1);
+            _M_shift0 = std::min(__l, 1);
+            _M_shift1 = std::max(__l - 1, 0);
+          }
+        else
+          {
+            const _Up __abs = __d < 0 ? _Up(-_Up(__d)) : _Up(__d);
+            const int __l = std::max(_S_ceil_log2(__abs), 1);
+            _M_multiplier = _Tp(_Up((_Wp(1) << (_S_bits + __l - 1)) / __abs + 1));
+            _M_shift0 = __l - 1;
+            _M_shift1 = 0;
+            _M_sign = __d < 0 ? _Up(~_Up()) : _Up();
+          }
+      }
+
+      constexpr _Tp
+      divisor() const
+      { return _M_divisor; }
+
+      template <typename _Abi>
+        _GLIBCXX_SIMD_ALWAYS_INLINE friend constexpr basic_simd<_Tp, _Abi>
+        operator/(const basic_simd<_Tp, _Abi>& __x, const simd_divisor& __d)
+        { return __d._M_divide(__x); }
+
+      template <typename _Abi>
+        _GLIBCXX_SIMD_ALWAYS_INLINE friend constexpr basic_simd<_Tp, _Abi>
+        operator%(const basic_simd<_Tp, _Abi>& __x, const simd_divisor& __d)
+        { return __d._M_modulus(__x); }
+
+      template <typename _Abi>
+        _GLIBCXX_SIMD_ALWAYS_INLINE friend constexpr basic_simd<_Tp, _Abi>&
+        operator/=(basic_simd<_Tp, _Abi>& __x, const simd_divisor& __d)
+        { return __x = __d._M_divide(__x); }
+
+      template <typename _Abi>
+        _GLIBCXX_SIMD_ALWAYS_INLINE friend constexpr basic_simd<_Tp, _Abi>&
+        operator%=(basic_simd<_Tp, _Abi>& __x, const simd_divisor& __d)
+        { return __x = __d._M_modulus(__x); }
+
+      _GLIBCXX_SIMD_ALWAYS_INLINE friend constexpr _Tp
+      operator/(_Tp __x, const simd_divisor& __d)
+      { return __d._M_divide(__x); }
+
+      _GLIBCXX_SIMD_ALWAYS_INLINE friend constexpr _Tp
+      operator%(_Tp __x, const simd_divisor& __d)
+      { return __d._M_modulus(__x); }
+    };
+}
+
+#endif  // PROTOTYPE_SIMD_DIVISOR_H_
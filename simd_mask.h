@@ -10,8 +10,10 @@
 #include "simd_abi.h"
 #include "simd_iterator.h"
 
+#include <bitset>
 #include <concepts>
 #include <climits>
+#include <ranges>
 
 namespace std
 {
@@ -134,7 +136,11 @@ namespace std
       : _M_data(__init)
       {}
 
-      // TODO bitset conversions
+      // [simd.mask.ctor] bitset conversion (P2876)
+      _GLIBCXX_SIMD_ALWAYS_INLINE constexpr
+      basic_simd_mask(const bitset<size()>& __b) noexcept
+      : _M_data(_S_from_bitset(__b))
+      {}
 
       // broadcast ctor
       _GLIBCXX_SIMD_ALWAYS_INLINE constexpr explicit
@@ -194,6 +200,45 @@ namespace std
         }
 #endif
 
+      // [simd.mask.conv] bitset conversions (P2876)
+      // Lowers to movmsk/kmov via _S_to_bits instead of one extraction per element.
+      _GLIBCXX_SIMD_ALWAYS_INLINE constexpr bitset<size()>
+      to_bitset() const noexcept
+      {
+        if constexpr (size.value <= __CHAR_BIT__ * sizeof(0ULL))
+          return _Impl::_S_to_bits(_M_data)._M_sanitized()._M_to_bitset();
+        else
+          {
+            // _S_to_bits is limited to one ullong; _AbiArray can be larger. Its chunks are at most
+            // 64 elements wide, so shift in one _S_to_bits per chunk, starting with the last one.
+            using _Impl0 = typename _Abi::_Abi0Type::_MaskImpl;
+            constexpr int __chunk = _Abi::_Abi0Type::_S_size;
+            static_assert(__chunk <= __CHAR_BIT__ * sizeof(0ULL));
+            bitset<size()> __r;
+            for (int __i = _Abi::_S_abiarray_size - 1; __i >= 0; --__i)
+              {
+                __r <<= __chunk;
+                __r |= bitset<size()>(_Impl0::_S_to_bits(_M_data[__i])._M_sanitized()._M_to_bits());
+              }
+            return __r;
+          }
+      }
+
+      _GLIBCXX_SIMD_ALWAYS_INLINE constexpr unsigned long long
+      to_ullong() const
+      {
+        if constexpr (size.value <= __CHAR_BIT__ * sizeof(0ULL))
+          return _Impl::_S_to_bits(_M_data)._M_sanitized()._M_to_bits();
+        else
+          {
+            __glibcxx_simd_precondition(
+              _GLIBCXX_SIMD_INT_PACK(size.value - __CHAR_BIT__ * sizeof(0ULL), _Is, {
+                return not (... or (*this)[__CHAR_BIT__ * sizeof(0ULL) + _Is]);
+              }), "to_ullong() requires all elements beyond the first 64 to be false");
+            return to_bitset().to_ullong();
+          }
+      }
+
       // [simd.mask.unary]
       _GLIBCXX_SIMD_ALWAYS_INLINE constexpr basic_simd_mask
       operator!() const noexcept
@@ -360,6 +405,21 @@ namespace std
       __data(basic_simd_mask& __x)
       { return __x._M_data; }
 
+      _GLIBCXX_SIMD_INTRINSIC static constexpr _MemberType
+      _S_from_bitset(const bitset<size()>& __b)
+      {
+        if constexpr (size.value <= __CHAR_BIT__ * sizeof(0ULL))
+          {
+            const __detail::_SanitizedBitMask<size()> __bits = __b;
+            if constexpr (requires { _Impl::template _S_convert_mask<_MemberType>(__bits); })
+              return _Impl::template _S_convert_mask<_MemberType>(__bits);
+            else
+              return __bits;
+          }
+        else
+          return basic_simd_mask([&](int __i) { return __b[__i]; })._M_data;
+      }
+
       _GLIBCXX_SIMD_INTRINSIC constexpr bool
       _M_is_constprop() const
       {
@@ -376,6 +436,65 @@ namespace std
     struct is_mask<basic_simd_mask<_Bs, _Abi>>
     : is_default_constructible<basic_simd_mask<_Bs, _Abi>>
     {};
+
+  /**
+   * Packs the elements of all masks in \p __masks into a contiguous bitmap at \p __out: element
+   * \c j of the \c i-th mask is stored at bit position <tt>i * size + j</tt>. Bits after the last
+   * element in the last word are zero.
+   *
+   * Every mask is converted with a single movmsk/kmov (to_ullong) and merged via shift-or. If
+   * the mask size divides 64, whole words are assembled from a compile-time number of masks.
+   *
+   * \returns pointer one past the last written word.
+   */
+  template <ranges::input_range _Rg>
+    requires __detail::__mask_type<ranges::range_value_t<_Rg>>
+      and (ranges::range_value_t<_Rg>::size() <= 64)
+    constexpr uint64_t*
+    simd_mask_to_bits(_Rg&& __masks, uint64_t* __out)
+    {
+      constexpr int _Np = ranges::range_value_t<_Rg>::size();
+      if constexpr (64 % _Np == 0 and ranges::random_access_range<_Rg>
+                      and ranges::sized_range<_Rg>)
+        {
+          constexpr int __per_word = 64 / _Np;
+          const auto __it = ranges::begin(__masks);
+          const size_t __n = ranges::size(__masks);
+          size_t __i = 0;
+          for (; __i + __per_word <= __n; __i += __per_word)
+            *__out++ = _GLIBCXX_SIMD_INT_PACK(__per_word, _Is, {
+                         return ((uint64_t(__it[__i + _Is].to_ullong()) << (_Is * _Np)) | ...);
+                       });
+          if (__i < __n)
+            {
+              uint64_t __word = 0;
+              for (int __shift = 0; __i < __n; ++__i, __shift += _Np)
+                __word |= uint64_t(__it[__i].to_ullong()) << __shift;
+              *__out++ = __word;
+            }
+        }
+      else
+        {
+          uint64_t __word = 0;
+          int __fill = 0;
+          for (const auto& __k : __masks)
+            {
+              const uint64_t __bits = __k.to_ullong();
+              __word |= __bits << __fill;
+              __fill += _Np;
+              if (__fill >= 64)
+                {
+                  *__out++ = __word;
+                  __fill -= 64;
+                  // the bits that did not fit into the previous word (shift by 64 is UB)
+                  __word = __fill == 0 ? 0 : __bits >> (_Np - __fill);
+                }
+            }
+          if (__fill > 0)
+            *__out++ = __word;
+        }
+      return __out;
+    }
 }
 
 #endif  // PROTOTYPE_SIMD_MASK2_H_
@@ -87,7 +87,9 @@ namespace std
       using _Vp = __detail::__deduced_simd_t<_Up>;                                                 \
       using _Tp [[maybe_unused]] = __detail::__canonical_vec_type_t<typename _Vp::value_type>;     \
       const _Vp& __x = __xx;                                                                       \
-      if consteval                                                                                 \
+      if constexpr (sizeof(_Tp) == 2) /* float16_t: evaluate in float */                           \
+        return _Vp(name(rebind_simd_t<float, _Vp>(__x)));                                          \
+      else if consteval                                                                            \
         {                                                                                          \
           return _Vp([&] (int __i) {                                                               \
                    if constexpr (sizeof(__x[0]) == sizeof(float))                                  \
@@ -116,7 +118,7 @@ namespace std
               using _VPart = basic_simd<_Tp, typename _Vp::abi_type::_Abi0Type>;                   \
               _Vp __r;                                                                             \
               const auto& __arr0 = __x._M_data;                                                    \
-              _GLIBCXX_SIMD_INT_PACK(__arr0.size(), _Is, {                                         \
+              _GLIBCXX_SIMD_INT_PACK(_Vp::abi_type::_S_abiarray_size, _Is, {                       \
                 ((__r._M_data[_Is] = name(_VPart(__arr0[_Is]))._M_data), ...);                     \
               });                                                                                  \
               return __r;                                                                          \
@@ -148,7 +150,12 @@ namespace std
       using _Tp [[maybe_unused]] = __detail::__canonical_vec_type_t<typename _Vp::value_type>;     \
       const _Vp& __x = __x0;                                                                       \
       const _Vp& __y = __x1;                                                                       \
-      if consteval                                                                                 \
+      if constexpr (sizeof(_Tp) == 2) /* float16_t: evaluate in float */                           \
+        {                                                                                          \
+          using _Fv = rebind_simd_t<float, _Vp>;                                                   \
+          return _Vp(name(_Fv(__x), _Fv(__y)));                                                    \
+        }                                                                                          \
+      else if consteval                                                                            \
         {                                                                                          \
           return _Vp([&] (int __i) {                                                               \
                    if constexpr (sizeof(__x[0]) == sizeof(float))                                  \
@@ -179,7 +186,7 @@ namespace std
               _Vp __r;                                                                             \
               const auto& __arr0 = __x._M_data;                                                    \
               const auto& __arr1 = __y._M_data;                                                    \
-              _GLIBCXX_SIMD_INT_PACK(__arr0.size(), _Is, {                                         \
+              _GLIBCXX_SIMD_INT_PACK(_Vp::abi_type::_S_abiarray_size, _Is, {                       \
                 ((__r._M_data[_Is] = name(_VPart(__arr0[_Is]), _VPart(__arr1[_Is]))._M_data), ...);\
               });                                                                                  \
               return __r;                                                                          \
@@ -212,16 +219,15 @@ namespace std
       const _Vp& __x = __x0;                                                                       \
       const _Vp& __y = __x1;                                                                       \
       const _Vp& __z = __x2;                                                                       \
-      if consteval                                                                                 \
+      if constexpr (sizeof(_Tp) == 2) /* float16_t: evaluate in float */                           \
+        {                                                                                          \
+          using _Fv = rebind_simd_t<float, _Vp>;                                                   \
+          return _Vp(name(_Fv(__x), _Fv(__y), _Fv(__z)));                                          \
+        }                                                                                          \
+      else if consteval                                                                            \
         {                                                                                          \
-           return _Vp([&] (int __i) {                                                              \
-                    if constexpr (sizeof(__x[0]) == sizeof(float))                                 \
-                      return __builtin_##name##f(__x[__i], __y[__i], __z[__i]);                    \
-                    else if constexpr (sizeof(__x[0]) == sizeof(double))                           \
-                      return __builtin_##name(__x[__i], __y[__i], __z[__i]);                       \
-                    else                                                                           \
-                      static_assert(false);                                                        \
-                  });                                                                              \
+           /* there are no three-argument builtins for hypot and lerp */                           \
+           return _Vp([&] (int __i) { return std::name(__x[__i], __y[__i], __z[__i]); });          \
          }                                                                                         \
       else                                                                                         \
         {                                                                                          \
@@ -245,7 +251,7 @@ namespace std
               const auto& __arr0 = __x._M_data;                                                    \
               const auto& __arr1 = __y._M_data;                                                    \
               const auto& __arr2 = __z._M_data;                                                    \
-              _GLIBCXX_SIMD_INT_PACK(__arr0.size(), _Is, {                                         \
+              _GLIBCXX_SIMD_INT_PACK(_Vp::abi_type::_S_abiarray_size, _Is, {                       \
                 ((__r._M_data[_Is] = name(_VPart(__arr0[_Is]), _VPart(__arr1[_Is]),                \
                                           _VPart(__arr2[_Is]))._M_data), ...);                     \
               });                                                                                  \
@@ -258,12 +264,7 @@ namespace std
             {                                                                                      \
               using _VB = typename _Vp::_MemberType;                                               \
               return _GLIBCXX_SIMD_INT_PACK(_Vp::size(), _Is, {                                    \
-                     if constexpr (sizeof(_Tp) == sizeof(float))                                   \
-                       return _VB{__builtin_##name##f(__x[_Is], __y[_Is], __z[_Is])...};           \
-                     else if constexpr (sizeof(_Tp) == sizeof(double))                             \
-                       return _VB{__builtin_##name(__x[_Is], __y[_Is], __z[_Is])...};              \
-                     else                                                                          \
-                       static_assert(false);                                                       \
+                     return _VB{std::name(__x[_Is], __y[_Is], __z[_Is])...};                       \
                    });                                                                             \
             }                                                                                      \
         }                                                                                          \
@@ -320,6 +321,267 @@ _GLIBCXX_SIMD_MATH_3ARG(lerp) // missing noexcept
 #undef _GLIBCXX_SIMD_MATH_2ARG
 #undef _GLIBCXX_SIMD_MATH_3ARG
 
+namespace std
+{
+  // Extension: returns {sin(x), cos(x)}, computing the argument reduction only once.
+  template <__detail::__math_floating_point _Up>
+    _GLIBCXX_ALWAYS_INLINE constexpr pair<__detail::__deduced_simd_t<_Up>,
+                                          __detail::__deduced_simd_t<_Up>>
+    sincos(const _Up& __xx)
+    {
+      using _Vp = __detail::__deduced_simd_t<_Up>;
+      using _Tp [[maybe_unused]] = __detail::__canonical_vec_type_t<typename _Vp::value_type>;
+      const _Vp& __x = __xx;
+      if constexpr (sizeof(_Tp) == 2) // float16_t: evaluate in float
+        {
+          const auto [__s, __c] = sincos(rebind_simd_t<float, _Vp>(__x));
+          return {_Vp(__s), _Vp(__c)};
+        }
+      else if consteval
+        {
+          return {sin(__x), cos(__x)};
+        }
+      else
+        {
+          using _VB = typename _Vp::_MemberType;
+          if constexpr (requires(_VB& __r) { _Vp::_Impl::_S_sincos(__x._M_data, __r, __r); })
+            {
+              _VB __s, __c;
+              _Vp::_Impl::_S_sincos(__x._M_data, __s, __c);
+              return {_Vp(__detail::__private_init, __s), _Vp(__detail::__private_init, __c)};
+            }
+          else if constexpr (requires { typename _Vp::abi_type::_AbiCombineTag; })
+            {
+              pair<_Vp, _Vp> __r = {__x, _Vp()};
+              __r.first._M_data._M_forall(__r.second._M_data,
+                                          [](auto __meta, auto& __s, auto& __c) {
+                                            const auto [__s0, __c0]
+                                              = sincos(__meta._S_to_simd(__s));
+                                            __s = __data(__s0);
+                                            __c = __data(__c0);
+                                          });
+              return __r;
+            }
+          else if constexpr (requires { typename _Vp::abi_type::_Abi0Type; })
+            {
+              using _VPart = basic_simd<_Tp, typename _Vp::abi_type::_Abi0Type>;
+              pair<_Vp, _Vp> __r;
+              const auto& __arr0 = __x._M_data;
+              for (size_t __i = 0; __i < __arr0.size(); ++__i)
+                {
+                  const auto [__s0, __c0] = sincos(_VPart(__arr0[__i]));
+                  __r.first._M_data[__i] = __s0._M_data;
+                  __r.second._M_data[__i] = __c0._M_data;
+                }
+              return __r;
+            }
+          else
+            return {sin(__x), cos(__x)};
+        }
+    }
+}
+
+namespace std::__detail
+{
+  // Scalar definitions of the activation function extensions below. They are used for constant
+  // evaluation and for ABIs without vectorized implementation.
+  template <typename _Tp>
+    constexpr _Tp
+    __sigmoid(_Tp __x)
+    {
+      const _Tp __e = std::exp(-std::fabs(__x));
+      const _Tp __r = _Tp(1) / (_Tp(1) + __e);
+      return __x < _Tp() ? __e * __r : __r;
+    }
+
+  template <typename _Tp>
+    constexpr _Tp
+    __sigmoid_fast(_Tp __x)
+    { return _Tp(1) / (_Tp(1) + std::exp(-__x)); }
+
+  template <typename _Tp>
+    constexpr _Tp
+    __gelu(_Tp __x)
+    {
+      if (__x == -numeric_limits<_Tp>::infinity())
+        return -_Tp();
+      // -x / √2 = __z + __dz: erfc amplifies the relative error of __z by 2z² towards the tail,
+      // which the first-order correction -__dz 2/√π e^-z² compensates
+      constexpr _Tp __c = -0x1.6a09e667f3bcdp-1;
+      constexpr _Tp __c_lo = sizeof(_Tp) == sizeof(float) ? -0x1.9fcef32422cbfp-27
+                                                           : 0x1.bdd3413b26456p-55;
+      const _Tp __z = __x * __c;
+      const _Tp __r = std::erfc(__z);
+      if (not (__z > _Tp(1)))
+        return _Tp(.5) * __x * __r;
+      const _Tp __dz = std::fma(__x, __c, -__z) + __x * __c_lo;
+      return _Tp(.5) * __x * (__r - __dz * _Tp(0x1.20dd750429b6dp+0) * std::exp(-__z * __z));
+    }
+
+  template <typename _Tp>
+    constexpr _Tp
+    __gelu_fast(_Tp __x)
+    {
+      if (__x == -numeric_limits<_Tp>::infinity())
+        return -_Tp();
+      return __x / (_Tp(1) + std::exp(__x * (_Tp(-1.5957691216057308)
+                                                - _Tp(0.0713548162726009) * __x * __x)));
+    }
+}
+
+#define _GLIBCXX_SIMD_MATH_EXT_1ARG(name)                                                          \
+namespace std                                                                                      \
+{                                                                                                  \
+  template <__detail::__math_floating_point _Up>                                                   \
+    _GLIBCXX_ALWAYS_INLINE constexpr __detail::__deduced_simd_t<_Up>                               \
+    simd_##name(const _Up& __xx)                                                                   \
+    {                                                                                              \
+      using _Vp = __detail::__deduced_simd_t<_Up>;                                                 \
+      using _Tp [[maybe_unused]] = __detail::__canonical_vec_type_t<typename _Vp::value_type>;     \
+      const _Vp& __x = __xx;                                                                       \
+      if constexpr (sizeof(_Tp) == 2) /* float16_t: evaluate in float */                           \
+        return _Vp(simd_##name(rebind_simd_t<float, _Vp>(__x)));                                   \
+      else if consteval                                                                            \
+        {                                                                                          \
+          return _Vp([&] (int __i) { return __detail::__##name(_Tp(__x[__i])); });                 \
+        }                                                                                          \
+      else                                                                                         \
+        {                                                                                          \
+          if constexpr (requires { _Vp::_Impl::_S_##name(__x._M_data); })                          \
+            return _Vp::_Impl::_S_##name(__x._M_data);                                             \
+          else if constexpr (requires { typename _Vp::abi_type::_AbiCombineTag; })                 \
+            {                                                                                      \
+              using _Tup = typename _Vp::abi_type::template _SimdMember<_Tp>;                      \
+              return _Vp(__detail::__private_init,                                                 \
+                         _Tup::_S_generate_persimd(                                                \
+                           [&] [[gnu::always_inline]] (vir::constexpr_value auto __i) {            \
+                             return __data(simd_##name(__x._M_data._M_simd_at(__i)));              \
+                           }));                                                                    \
+            }                                                                                      \
+          else if constexpr (requires { typename _Vp::abi_type::_Abi0Type; })                      \
+            {                                                                                      \
+              using _VPart = basic_simd<_Tp, typename _Vp::abi_type::_Abi0Type>;                   \
+              _Vp __r;                                                                             \
+              const auto& __arr0 = __x._M_data;                                                    \
+              _GLIBCXX_SIMD_INT_PACK(_Vp::abi_type::_S_abiarray_size, _Is, {                       \
+                ((__r._M_data[_Is] = simd_##name(_VPart(__arr0[_Is]))._M_data), ...);              \
+              });                                                                                  \
+              return __r;                                                                          \
+            }                                                                                      \
+          else                                                                                     \
+            return _Vp([&] (int __i) { return __detail::__##name(_Tp(__x[__i])); });               \
+        }                                                                                          \
+    }                                                                                              \
+}
+
+// Extensions: activation functions. simd_sigmoid(x) = 1 / (1 + e^-x) and simd_gelu(x) = x Φ(x)
+// are accurate to a few ulp. simd_sigmoid_fast has a relative error below 2^-20 (float) / 2^-48
+// (double) and flushes results below 2 norm_min to zero. simd_gelu_fast evaluates the tanh
+// approximation x (1 + tanh(√(2/π) (x + 0.044715 x³))) / 2, which is within 5e-4 of x Φ(x).
+_GLIBCXX_SIMD_MATH_EXT_1ARG(sigmoid)
+_GLIBCXX_SIMD_MATH_EXT_1ARG(sigmoid_fast)
+_GLIBCXX_SIMD_MATH_EXT_1ARG(gelu)
+_GLIBCXX_SIMD_MATH_EXT_1ARG(gelu_fast)
+
+#undef _GLIBCXX_SIMD_MATH_EXT_1ARG
+
+// [sf.cmath] mathematical special functions. These are not constexpr, just like their scalar
+// counterparts, which are used for ABIs without vectorized implementation.
+#define _GLIBCXX_SIMD_MATH_SF_1ARG(name)                                                           \
+namespace std                                                                                      \
+{                                                                                                  \
+  template <__detail::__math_floating_point _Up>                                                   \
+    _GLIBCXX_ALWAYS_INLINE __detail::__deduced_simd_t<_Up>                                         \
+    name(const _Up& __xx)                                                                          \
+    {                                                                                              \
+      using _Vp = __detail::__deduced_simd_t<_Up>;                                                 \
+      using _Tp [[maybe_unused]] = __detail::__canonical_vec_type_t<typename _Vp::value_type>;     \
+      const _Vp& __x = __xx;                                                                       \
+      if constexpr (sizeof(_Tp) == 2) /* float16_t: evaluate in float */                           \
+        return _Vp(name(rebind_simd_t<float, _Vp>(__x)));                                          \
+      else if constexpr (requires { _Vp::_Impl::_S_##name(__x._M_data); })                         \
+        return _Vp::_Impl::_S_##name(__x._M_data);                                                 \
+      else if constexpr (requires { typename _Vp::abi_type::_AbiCombineTag; })                     \
+        {                                                                                          \
+          using _Tup = typename _Vp::abi_type::template _SimdMember<_Tp>;                          \
+          return _Vp(__detail::__private_init,                                                     \
+                     _Tup::_S_generate_persimd(                                                    \
+                       [&] [[gnu::always_inline]] (vir::constexpr_value auto __i) {                \
+                         return __data(name(__x._M_data._M_simd_at(__i)));                         \
+                       }));                                                                        \
+        }                                                                                          \
+      else if constexpr (requires { typename _Vp::abi_type::_Abi0Type; })                          \
+        {                                                                                          \
+          using _VPart = basic_simd<_Tp, typename _Vp::abi_type::_Abi0Type>;                       \
+          _Vp __r;                                                                                 \
+          const auto& __arr0 = __x._M_data;                                                        \
+          _GLIBCXX_SIMD_INT_PACK(_Vp::abi_type::_S_abiarray_size, _Is, {                           \
+            ((__r._M_data[_Is] = name(_VPart(__arr0[_Is]))._M_data), ...);                         \
+          });                                                                                      \
+          return __r;                                                                              \
+        }                                                                                          \
+      else                                                                                         \
+        return _Vp([&] (int __i) { return std::name(_Tp(__x[__i])); });                           \
+    }                                                                                              \
+}
+
+// expint is accurate to 5 ulp (double) and comp_ellint_1/comp_ellint_2 to 2 ulp. As for the scalar
+// functions, comp_ellint_1(±1) is NaN.
+_GLIBCXX_SIMD_MATH_SF_1ARG(expint)
+_GLIBCXX_SIMD_MATH_SF_1ARG(comp_ellint_1)
+_GLIBCXX_SIMD_MATH_SF_1ARG(comp_ellint_2)
+
+#undef _GLIBCXX_SIMD_MATH_SF_1ARG
+
+namespace std::__detail
+{
+  // float16_t is classified via its bit pattern, which avoids the conversion to float
+  template <typename _Vp>
+    constexpr rebind_simd_t<unsigned short, _Vp>
+    __half_abs_bits(const _Vp& __x)
+    {
+      using _Up = rebind_simd_t<unsigned short, _Vp>;
+      return __builtin_bit_cast(_Up, __x) & static_cast<unsigned short>(0x7fff);
+    }
+
+  template <typename _Tp>
+    constexpr unsigned short __half_inf_bits
+      = __builtin_bit_cast(unsigned short, numeric_limits<_Tp>::infinity());
+
+  template <typename _Tp>
+    constexpr unsigned short __half_min_bits
+      = __builtin_bit_cast(unsigned short, numeric_limits<_Tp>::min());
+
+  template <typename _Vp>
+    constexpr auto
+    __half_isfinite(const _Vp& __x)
+    { return __half_abs_bits(__x) < __half_inf_bits<typename _Vp::value_type>; }
+
+  template <typename _Vp>
+    constexpr auto
+    __half_isinf(const _Vp& __x)
+    { return __half_abs_bits(__x) == __half_inf_bits<typename _Vp::value_type>; }
+
+  template <typename _Vp>
+    constexpr auto
+    __half_isnan(const _Vp& __x)
+    { return __half_abs_bits(__x) > __half_inf_bits<typename _Vp::value_type>; }
+
+  template <typename _Vp>
+    constexpr auto
+    __half_isnormal(const _Vp& __x)
+    {
+      using _Tp = typename _Vp::value_type;
+      const auto __a = __half_abs_bits(__x);
+      return __a >= __half_min_bits<_Tp> and __a < __half_inf_bits<_Tp>;
+    }
+
+  template <typename _Vp>
+    constexpr auto
+    __half_signbit(const _Vp& __x)
+    { return __builtin_bit_cast(rebind_simd_t<short, _Vp>, __x) < short(); }
+}
+
 #define _GLIBCXX_SIMD_MATH_CLASSIFICATION_1ARG(name)                                               \
 namespace std                                                                                      \
 {                                                                                                  \
@@ -331,7 +593,9 @@ namespace std
       using _Kp = typename _Vp::mask_type;                                                         \
       using _Tp [[maybe_unused]] = typename _Vp::value_type;                                       \
       const _Vp& __x = __xx;                                                                       \
-      if consteval                                                                                 \
+      if constexpr (sizeof(_Tp) == 2) /* float16_t */                                              \
+        return _Kp(__detail::__half_##name(__x));                                                  \
+      else if consteval                                                                            \
         {                                                                                          \
           return _Kp([&] (int __i) -> bool {                                                       \
                    if constexpr (sizeof(__x[0]) == sizeof(float))                                  \
@@ -357,6 +621,178 @@ _GLIBCXX_SIMD_MATH_CLASSIFICATION_1ARG(signbit)
 
 #undef _GLIBCXX_SIMD_MATH_CLASSIFICATION_1ARG
 
+namespace std::__detail
+{
+  // The exponent and significand kernels of _Vp::_Impl take and return the member type of this
+  // type. Its ABI tag can differ from the one of rebind_simd_t<int, _Vp>.
+  template <typename _Vp>
+    using __exponent_simd = basic_simd<int, typename _Vp::abi_type::template _Rebind<int>>;
+}
+
+namespace std
+{
+  // [c.math] exponent and significand manipulation
+  template <__detail::__math_floating_point _Up>
+    _GLIBCXX_ALWAYS_INLINE __detail::__deduced_simd_t<_Up>
+    frexp(const _Up& __xx, rebind_simd_t<int, __detail::__deduced_simd_t<_Up>>* __exp)
+    {
+      using _Vp = __detail::__deduced_simd_t<_Up>;
+      using _Tp [[maybe_unused]] = __detail::__canonical_vec_type_t<typename _Vp::value_type>;
+      const _Vp& __x = __xx;
+      if constexpr (sizeof(_Tp) == 2) // float16_t: evaluate in float
+        return _Vp(frexp(rebind_simd_t<float, _Vp>(__x), __exp));
+      else if constexpr (requires(__detail::__exponent_simd<_Vp>& __e) {
+                           _Vp::_Impl::_S_frexp(__x._M_data, __e._M_data);
+                         })
+        {
+          __detail::__exponent_simd<_Vp> __e;
+          const _Vp __r(__detail::__private_init, _Vp::_Impl::_S_frexp(__x._M_data, __e._M_data));
+          *__exp = __e;
+          return __r;
+        }
+      else
+        {
+          int __e[_Vp::size()];
+          const _Vp __r([&] (int __i) { return std::frexp(_Tp(__x[__i]), &__e[__i]); });
+          *__exp = rebind_simd_t<int, _Vp>([&] (int __i) { return __e[__i]; });
+          return __r;
+        }
+    }
+
+  template <__detail::__math_floating_point _Up>
+    _GLIBCXX_ALWAYS_INLINE constexpr rebind_simd_t<int, __detail::__deduced_simd_t<_Up>>
+    ilogb(const _Up& __xx)
+    {
+      using _Vp = __detail::__deduced_simd_t<_Up>;
+      using _Tp [[maybe_unused]] = __detail::__canonical_vec_type_t<typename _Vp::value_type>;
+      using _Ip = rebind_simd_t<int, _Vp>;
+      const _Vp& __x = __xx;
+      if constexpr (sizeof(_Tp) == 2) // float16_t: evaluate in float
+        return ilogb(rebind_simd_t<float, _Vp>(__x));
+      else if consteval
+        {
+          return _Ip([&] (int __i) {
+                   if constexpr (sizeof(_Tp) == sizeof(float))
+                     return __builtin_ilogbf(__x[__i]);
+                   else
+                     return __builtin_ilogb(__x[__i]);
+                 });
+        }
+      else
+        {
+          if constexpr (requires {
+                          __detail::__exponent_simd<_Vp>(
+                            __detail::__private_init, _Vp::_Impl::_S_ilogb(__x._M_data));
+                        })
+            return __detail::__exponent_simd<_Vp>(__detail::__private_init,
+                                                  _Vp::_Impl::_S_ilogb(__x._M_data));
+          else
+            return _Ip([&] (int __i) { return std::ilogb(_Tp(__x[__i])); });
+        }
+    }
+
+  template <__detail::__math_floating_point _Up>
+    _GLIBCXX_ALWAYS_INLINE constexpr __detail::__deduced_simd_t<_Up>
+    ldexp(const _Up& __xx, const rebind_simd_t<int, __detail::__deduced_simd_t<_Up>>& __exp)
+    {
+      using _Vp = __detail::__deduced_simd_t<_Up>;
+      using _Tp [[maybe_unused]] = __detail::__canonical_vec_type_t<typename _Vp::value_type>;
+      const _Vp& __x = __xx;
+      if constexpr (sizeof(_Tp) == 2) // float16_t: evaluate in float
+        return _Vp(ldexp(rebind_simd_t<float, _Vp>(__x), __exp));
+      else if consteval
+        {
+          return _Vp([&] (int __i) {
+                   if constexpr (sizeof(_Tp) == sizeof(float))
+                     return __builtin_ldexpf(__x[__i], __exp[__i]);
+                   else
+                     return __builtin_ldexp(__x[__i], __exp[__i]);
+                 });
+        }
+      else
+        {
+          if constexpr (requires(const __detail::__exponent_simd<_Vp>& __e) {
+                          _Vp::_Impl::_S_ldexp(__x._M_data, __e._M_data);
+                        })
+            {
+              const __detail::__exponent_simd<_Vp> __e(__exp);
+              return _Vp(__detail::__private_init,
+                         _Vp::_Impl::_S_ldexp(__x._M_data, __e._M_data));
+            }
+          else
+            return _Vp([&] (int __i) { return std::ldexp(_Tp(__x[__i]), __exp[__i]); });
+        }
+    }
+
+  // FLT_RADIX is 2, therefore scalbn is ldexp.
+  template <__detail::__math_floating_point _Up>
+    _GLIBCXX_ALWAYS_INLINE constexpr __detail::__deduced_simd_t<_Up>
+    scalbn(const _Up& __x, const rebind_simd_t<int, __detail::__deduced_simd_t<_Up>>& __n)
+    { return ldexp(__x, __n); }
+
+  template <__detail::__math_floating_point _Up>
+    _GLIBCXX_ALWAYS_INLINE constexpr __detail::__deduced_simd_t<_Up>
+    scalbln(const _Up& __x, const rebind_simd_t<long, __detail::__deduced_simd_t<_Up>>& __n)
+    {
+      using _Vp = __detail::__deduced_simd_t<_Up>;
+      using _Lp = rebind_simd_t<long, _Vp>;
+      using _Tp = __detail::__canonical_vec_type_t<typename _Vp::value_type>;
+      // Beyond ±__lim every finite non-zero __x overflows or underflows to zero. Therefore,
+      // clamping __n to the int range does not change the result.
+      constexpr long __lim = 2 * numeric_limits<_Tp>::max_exponent + numeric_limits<_Tp>::digits;
+      const _Lp __clamped = __select_impl(__n > __lim, _Lp(__lim),
+                                          __select_impl(__n < -__lim, _Lp(-__lim), __n));
+      using _Ip = rebind_simd_t<int, _Vp>;
+      if consteval
+        {
+          // the vector conversion is not usable in constant expressions
+          return ldexp(__x, _Ip([&](int __i) { return int(__clamped[__i]); }));
+        }
+      else
+        {
+          return ldexp(__x, _Ip(__clamped));
+        }
+    }
+
+  template <typename _Tp, typename _Abi>
+    requires ext::simd_floating_point<basic_simd<_Tp, _Abi>>
+    _GLIBCXX_ALWAYS_INLINE constexpr basic_simd<_Tp, _Abi>
+    modf(const type_identity_t<basic_simd<_Tp, _Abi>>& __x, basic_simd<_Tp, _Abi>* __iptr)
+    {
+      using _Vp = basic_simd<_Tp, _Abi>;
+      if constexpr (sizeof(_Tp) == 2) // float16_t: evaluate in float
+        {
+          using _Fv = rebind_simd_t<float, _Vp>;
+          _Fv __i;
+          const _Vp __r(modf(_Fv(__x), &__i));
+          *__iptr = _Vp(__i);
+          return __r;
+        }
+      else if consteval
+        {
+          *__iptr = copysign(trunc(__x), __x);
+          return copysign(__select_impl(__x == *__iptr, _Vp(), __x - *__iptr), __x);
+        }
+      else
+        {
+          if constexpr (requires(typename _Vp::_MemberType& __i) {
+                          _Vp::_Impl::_S_modf(__x._M_data, __i);
+                        })
+            {
+              typename _Vp::_MemberType __i;
+              const _Vp __r(__detail::__private_init, _Vp::_Impl::_S_modf(__x._M_data, __i));
+              *__iptr = _Vp(__detail::__private_init, __i);
+              return __r;
+            }
+          else
+            {
+              *__iptr = copysign(trunc(__x), __x);
+              return copysign(__select_impl(__x == *__iptr, _Vp(), __x - *__iptr), __x);
+            }
+        }
+    }
+}
+
 
 // the following depend on the global rounding mode (not constexpr):
 //template<@\mathfloatingpoint@ V> @\deducedsimd@<V> nearbyint(const V& x);
@@ -365,12 +801,6 @@ _GLIBCXX_SIMD_MATH_CLASSIFICATION_1ARG(signbit)
 //template<@\mathfloatingpoint@ V> rebind_simd_t<long long int, V> llrint(const @\deducedsimd@<V>& x);
 
 #if 0
-frexp(const V& value, rebind_simd_t<int, @\deducedsimd@<V>>* exp);
-constexpr rebind_simd_t<int, @\deducedsimd@<V>> ilogb(const V& x);
-constexpr @\deducedsimd@<V> ldexp(const V& x, const rebind_simd_t<int, @\deducedsimd@<V>>& exp);
-constexpr basic_simd<T, Abi> modf(const type_identity_t<basic_simd<T, Abi>>& value, basic_simd<T, Abi>* iptr);
-constexpr @\deducedsimd@<V> scalbn(const V& x, const rebind_simd_t<int, @\deducedsimd@<V>>& n);
-constexpr @\deducedsimd@<V> scalbln(const V& x, const rebind_simd_t<long int, @\deducedsimd@<V>>& n);
 template<signed_integral T, class Abi> constexpr basic_simd<T, Abi> abs(const basic_simd<T, Abi>& j);
 
   template<@\mathfloatingpoint@ V> constexpr rebind_simd_t<long int, @\deducedsimd@<V>> lround(const V& x);
@@ -394,8 +824,6 @@ template<signed_integral T, class Abi> constexpr basic_simd<T, Abi> abs(const ba
                      const V& x);
   template<class V0, class V1>
     @\mathcommonsimd@<V0, V1> beta(const V0& x, const V1& y);
-  template<@\mathfloatingpoint@ V> @\deducedsimd@<V> comp_ellint_1(const V& k);
-  template<@\mathfloatingpoint@ V> @\deducedsimd@<V> comp_ellint_2(const V& k);
   template<class V0, class V1>
     @\mathcommonsimd@<V0, V1> comp_ellint_3(const V0& k, const V1& nu);
   template<class V0, class V1>
@@ -412,7 +840,6 @@ template<signed_integral T, class Abi> constexpr basic_simd<T, Abi> abs(const ba
     @\mathcommonsimd@<V0, V1> ellint_2(const V0& k, const V1& phi);
   template<class V0, class V1, class V2>
     @\mathcommonsimd@<V0, V1, V2> ellint_3(const V0& k, const V1& nu, const V2& phi);
-  template<@\mathfloatingpoint@ V> @\deducedsimd@<V> expint(const V& x);
   template<@\mathfloatingpoint@ V>
     @\deducedsimd@<V> hermite(const rebind_simd_t<unsigned, @\deducedsimd@<V>>& n, const V& x);
   template<@\mathfloatingpoint@ V>
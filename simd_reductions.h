@@ -87,8 +87,9 @@ namespace std
           constexpr int __missing = __max_size - _V1::size.value;
           if constexpr (sizeof(_V1) == sizeof(std::resize_simd_t<__max_size, _V1>)
                           and (__missing < __right_size)
-                          and not same_as<decltype(__detail::__identity_element_for
-                                                     <_Tp, _BinaryOperation>), nullptr_t>)
+                          and not same_as<remove_cv_t<decltype(__detail::__identity_element_for
+                                                                 <_Tp, _BinaryOperation>)>,
+                                          nullptr_t>)
             {
               using _V2 = std::resize_simd_t<__max_size, _V1>;
               constexpr std::simd<_Tp, __missing> __padding
@@ -9,6 +9,7 @@
 #include "detail.h"
 #include "detail_bitmask.h"
 
+#include <bit>
 #include <cmath>
 
 namespace std::__detail
@@ -140,6 +141,11 @@ namespace std::__detail
       _S_partial_load(const _Up* __mem, size_t __mem_size, _TypeTag<_Tp>) noexcept
       { return __mem_size == 0 ? _Tp() : static_cast<_Tp>(__mem[0]); }
 
+    template <typename _Tp, typename _Up>
+      _GLIBCXX_SIMD_INTRINSIC static constexpr _Tp
+      _S_stream_load(const _Up* __mem, _TypeTag<_Tp> __tag) noexcept
+      { return _S_load(__mem, __tag); }
+
     template <typename _Tp, typename _Up>
       _GLIBCXX_SIMD_INTRINSIC static constexpr _Tp
       _S_masked_load(bool __k, const _Up* __mem, _TypeTag<_Tp>) noexcept
@@ -159,6 +165,11 @@ namespace std::__detail
       _S_store(_Tp __v, _Up* __mem, _TypeTag<_Tp>) noexcept
       { __mem[0] = static_cast<_Up>(__v); }
 
+    template <typename _Tp, typename _Up>
+      _GLIBCXX_SIMD_INTRINSIC static constexpr void
+      _S_stream_store(_Tp __v, _Up* __mem, _TypeTag<_Tp> __tag) noexcept
+      { _S_store(__v, __mem, __tag); }
+
     template <typename _Tp, typename _Up>
       _GLIBCXX_SIMD_INTRINSIC static constexpr void
       _S_partial_store(_Tp __v, _Up* __mem, size_t __mem_size, _TypeTag<_Tp>) noexcept
@@ -253,6 +264,68 @@ namespace std::__detail
                                   % __promote_preserving_unsigned(__y));
       }
 
+    /**
+     * The high half of the full product of __x and __y.
+     */
+    template <integral _Tp>
+      _GLIBCXX_SIMD_INTRINSIC static constexpr _Tp
+      _S_mulhi(_Tp __x, _Tp __y)
+      {
+        constexpr int __bits = __CHAR_BIT__ * sizeof(_Tp);
+        if constexpr (sizeof(_Tp) == 8)
+          {
+            using _Wp = conditional_t<is_signed_v<_Tp>, __int128, unsigned __int128>;
+            return static_cast<_Tp>((_Wp(__x) * _Wp(__y)) >> __bits);
+          }
+        else
+          {
+            using _Up = typename __make_unsigned_int<2 * sizeof(_Tp)>::type;
+            using _Wp = conditional_t<is_signed_v<_Tp>, make_signed_t<_Up>, _Up>;
+            return static_cast<_Tp>((_Wp(__x) * _Wp(__y)) >> __bits);
+          }
+      }
+
+    // <bit> functions; _Tp is an unsigned integer type
+    template <integral _Tp>
+      _GLIBCXX_SIMD_INTRINSIC static constexpr _Tp
+      _S_bit_popcount(_Tp __x)
+      { return static_cast<_Tp>(std::popcount(static_cast<__make_unsigned_int_t<_Tp>>(__x))); }
+
+    template <integral _Tp>
+      _GLIBCXX_SIMD_INTRINSIC static constexpr _Tp
+      _S_countl_zero(_Tp __x)
+      { return static_cast<_Tp>(std::countl_zero(static_cast<__make_unsigned_int_t<_Tp>>(__x))); }
+
+    template <integral _Tp>
+      _GLIBCXX_SIMD_INTRINSIC static constexpr _Tp
+      _S_countr_zero(_Tp __x)
+      { return static_cast<_Tp>(std::countr_zero(static_cast<__make_unsigned_int_t<_Tp>>(__x))); }
+
+    template <integral _Tp>
+      _GLIBCXX_SIMD_INTRINSIC static constexpr _Tp
+      _S_byteswap(_Tp __x)
+      { return std::byteswap(__x); }
+
+    template <integral _Tp>
+      _GLIBCXX_SIMD_INTRINSIC static constexpr _Tp
+      _S_rotl(_Tp __x, int __y)
+      { return static_cast<_Tp>(std::rotl(static_cast<__make_unsigned_int_t<_Tp>>(__x), __y)); }
+
+    template <integral _Tp>
+      _GLIBCXX_SIMD_INTRINSIC static constexpr _Tp
+      _S_rotl(_Tp __x, _Tp __y)
+      { return _S_rotl(__x, int(__y & (__CHAR_BIT__ * sizeof(_Tp) - 1))); }
+
+    template <integral _Tp>
+      _GLIBCXX_SIMD_INTRINSIC static constexpr _Tp
+      _S_rotr(_Tp __x, int __y)
+      { return static_cast<_Tp>(std::rotr(static_cast<__make_unsigned_int_t<_Tp>>(__x), __y)); }
+
+    template <integral _Tp>
+      _GLIBCXX_SIMD_INTRINSIC static constexpr _Tp
+      _S_rotr(_Tp __x, _Tp __y)
+      { return _S_rotr(__x, int(__y & (__CHAR_BIT__ * sizeof(_Tp) - 1))); }
+
     template <typename _Tp>
       _GLIBCXX_SIMD_INTRINSIC static constexpr _Tp
       _S_bit_and(_Tp __x, _Tp __y)
@@ -702,6 +775,11 @@ namespace std::__detail
       _S_mask_broadcast(bool __x)
       { return __x; }
 
+    template <typename>
+      _GLIBCXX_SIMD_INTRINSIC static constexpr bool
+      _S_mask_with_n_true(unsigned __n)
+      { return __n != 0; }
+
     _GLIBCXX_SIMD_INTRINSIC static constexpr _SanitizedBitMask<1>
     _S_to_bits(bool __x)
     { return _SanitizedBitMask<1>::__create_unchecked(__x); }
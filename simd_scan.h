@@ -0,0 +1,270 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later WITH GCC-exception-3.1 */
+/* Copyright © 2025      GSI Helmholtzzentrum fuer Schwerionenforschung GmbH
+ *                       Matthias Kretz <m.kretz@gsi.de>
+ */
+
+#ifndef PROTOTYPE_SIMD_SCAN_H_
+#define PROTOTYPE_SIMD_SCAN_H_
+
+#include "simd.h"
+#include "simd_alg.h"
+#include "simd_reductions.h"
+#include "permute.h"
+
+#include <bit>
+
+namespace std
+{
+  namespace __detail
+  {
+    /**
+     * Step _Np (a power of two) of the Sklansky scan: every element with bit _Np set in its index
+     * combines with the last element of the preceding block of _Np elements.
+     */
+    template <unsigned _Np>
+      requires (std::has_single_bit(_Np))
+      struct __prefix_scan_permutation
+      {
+        consteval unsigned
+        operator()(unsigned __i) const
+        { return __i & _Np ? (__i ^ _Np) | (_Np - 1) : __i; }
+      };
+
+    template <typename _Vp>
+      inline constexpr typename _Vp::mask_type __first_element_mask
+        = typename _Vp::mask_type([](int __i) { return __i == 0; });
+
+    /**
+     * Shifts __x up by one element and inserts __init as the first element.
+     */
+    template <typename _Vp>
+      _GLIBCXX_SIMD_ALWAYS_INLINE constexpr _Vp
+      __shift_in_first(const _Vp& __x, const _Vp& __init)
+      {
+        return simd_select(__first_element_mask<_Vp>, __init,
+                           permute(__x, permutations::shift<-1>));
+      }
+  }
+
+  /**
+   * Returns the inclusive prefix scan of __x, i.e. element i is the reduction of the elements
+   * [0, i] of __x with __binary_op. The operation must be associative; it does not need to be
+   * commutative (earlier elements are always passed as the left operand). Since the scan needs
+   * only log2(size) steps, the result for floating-point addition can differ from a sequential
+   * scan in the last bits.
+   */
+  template <typename _Tp, typename _Abi,
+            __detail::__binary_operation<_Tp> _BinaryOperation = plus<>>
+    constexpr basic_simd<_Tp, _Abi>
+    inclusive_scan(const basic_simd<_Tp, _Abi>& __x, _BinaryOperation __binary_op = {})
+    {
+      using _Vp = basic_simd<_Tp, _Abi>;
+      using _Mp = typename _Vp::mask_type;
+      if constexpr (_Vp::size() == 1)
+        return __x;
+      else if constexpr (requires { typename _Abi::_Abi0Type; })
+        {
+          // scan every register on its own, then carry the total of the preceding registers
+          using _VPart = basic_simd<_Tp, typename _Abi::_Abi0Type>;
+          _Vp __r;
+          _VPart __carry;
+          _GLIBCXX_SIMD_INT_PACK(_Abi::_S_abiarray_size, _Is, {
+            ([&] {
+              _VPart __y = inclusive_scan(_VPart(__data(__x)[_Is]), __binary_op);
+              if constexpr (_Is > 0)
+                __y = __binary_op(__carry, __y);
+              if constexpr (_Is + 1 < _Abi::_S_abiarray_size)
+                __carry = permute(__y, permutations::broadcast_last);
+              __data(__r)[_Is] = __data(__y);
+            }(), ...);
+          });
+          return __r;
+        }
+      else
+        {
+          _Vp __r = __x;
+          _GLIBCXX_SIMD_INT_PACK(std::bit_width(unsigned(_Vp::size() - 1)), _Is, {
+            ([&] {
+              constexpr unsigned __n = 1u << _Is;
+              constexpr _Mp __k([](unsigned __i) { return (__i & __n) != 0; });
+              __r = simd_select(__k, __binary_op(permute(__r, __detail::__prefix_scan_permutation<
+                                                                __n>()), __r), __r);
+            }(), ...);
+          });
+          return __r;
+        }
+    }
+
+  /**
+   * As above, but __init is combined (as left operand) with every element of the result.
+   */
+  template <typename _Tp, typename _Abi, __detail::__binary_operation<_Tp> _BinaryOperation>
+    constexpr basic_simd<_Tp, _Abi>
+    inclusive_scan(const basic_simd<_Tp, _Abi>& __x, _BinaryOperation __binary_op,
+                   __type_identity_t<_Tp> __init)
+    { return __binary_op(basic_simd<_Tp, _Abi>(__init), inclusive_scan(__x, __binary_op)); }
+
+  /**
+   * Inclusive scan over the elements selected by __k. Unselected elements are replaced by
+   * __identity_element and thus repeat the result of the preceding element.
+   */
+  template <typename _Tp, typename _Abi,
+            __detail::__binary_operation<_Tp> _BinaryOperation = plus<>>
+    constexpr basic_simd<_Tp, _Abi>
+    inclusive_scan(const basic_simd<_Tp, _Abi>& __x,
+                   const typename basic_simd<_Tp, _Abi>::mask_type& __k,
+                   _BinaryOperation __binary_op = {},
+                   __type_identity_t<_Tp> __identity_element
+                     = __detail::__default_identity_element<_Tp, _BinaryOperation>())
+    { return inclusive_scan(simd_select(__k, __x, __identity_element), __binary_op); }
+
+  /**
+   * Returns the exclusive prefix scan of __x: element 0 is __init, element i is the reduction of
+   * __init and the elements [0, i) of __x with __binary_op.
+   */
+  template <typename _Tp, typename _Abi,
+            __detail::__binary_operation<_Tp> _BinaryOperation = plus<>>
+    constexpr basic_simd<_Tp, _Abi>
+    exclusive_scan(const basic_simd<_Tp, _Abi>& __x, __type_identity_t<_Tp> __init,
+                   _BinaryOperation __binary_op = {})
+    {
+      using _Vp = basic_simd<_Tp, _Abi>;
+      return inclusive_scan(__detail::__shift_in_first(__x, _Vp(__init)), __binary_op);
+    }
+
+  /**
+   * Exclusive scan over the elements selected by __k. Unselected elements are replaced by
+   * __identity_element.
+   */
+  template <typename _Tp, typename _Abi,
+            __detail::__binary_operation<_Tp> _BinaryOperation = plus<>>
+    constexpr basic_simd<_Tp, _Abi>
+    exclusive_scan(const basic_simd<_Tp, _Abi>& __x,
+                   const typename basic_simd<_Tp, _Abi>::mask_type& __k,
+                   __type_identity_t<_Tp> __init, _BinaryOperation __binary_op = {},
+                   __type_identity_t<_Tp> __identity_element
+                     = __detail::__default_identity_element<_Tp, _BinaryOperation>())
+    { return exclusive_scan(simd_select(__k, __x, __identity_element), __init, __binary_op); }
+
+  /**
+   * Inclusive scan of the linear recurrence y[i] = x[i] + __a * y[i - 1] (with plus<> as
+   * __binary_op), i.e. element i is the sum over j <= i of __a^(i - j) * x[j].
+   */
+  template <typename _Tp, typename _Abi,
+            __detail::__binary_operation<_Tp> _BinaryOperation = plus<>>
+    constexpr basic_simd<_Tp, _Abi>
+    scaled_inclusive_scan(const basic_simd<_Tp, _Abi>& __x, __type_identity_t<_Tp> __a,
+                          _BinaryOperation __binary_op = {})
+    {
+      using _Vp = basic_simd<_Tp, _Abi>;
+      using _Mp = typename _Vp::mask_type;
+      _Vp __r = __x;
+      _Vp __factor = __a;
+      _GLIBCXX_SIMD_INT_PACK(std::bit_width(unsigned(_Vp::size() - 1)), _Is, {
+        ([&] {
+          constexpr unsigned __n = 1u << _Is;
+          constexpr _Mp __k([](unsigned __i) { return (__i & __n) != 0; });
+          const _Vp __prev = permute(__r, __detail::__prefix_scan_permutation<__n>());
+          __r = simd_select(__k, __binary_op(__factor * __prev, __r), __r);
+          __factor = simd_select(__k, __a * __factor, __factor);
+          __a *= __a;
+        }(), ...);
+      });
+      return __r;
+    }
+
+  namespace __detail
+  {
+    /**
+     * Scans the range __in chunk-wise into __out. The total of the preceding chunks is carried
+     * (broadcast to all elements) into the next chunk. Without _HasInit the first chunk starts
+     * without carry and __init is ignored. An exclusive scan always needs __init.
+     */
+    template <typename _Vp, bool _Exclusive, bool _HasInit, typename _Rg, typename _Out,
+              typename _BinaryOperation>
+      constexpr _Out
+      __simd_range_scan(_Rg&& __in, _Out __out, _BinaryOperation __binary_op,
+                        typename _Vp::value_type __init)
+      {
+        static_assert(_HasInit or not _Exclusive);
+        constexpr size_t __size = _Vp::size();
+        const size_t __n = ranges::size(__in);
+        const auto __first = ranges::begin(__in);
+        _Vp __carry = __init;
+
+        auto __step = [&] [[__gnu__::__always_inline__]] (const _Vp& __x, auto __with_carry) {
+          _Vp __y = inclusive_scan(__x, __binary_op);
+          if constexpr (__with_carry)
+            __y = __binary_op(__carry, __y);
+          const _Vp __r = [&] {
+            if constexpr (_Exclusive)
+              return __shift_in_first(__y, __carry);
+            else
+              return __y;
+          }();
+          __carry = permute(__y, permutations::broadcast_last);
+          return __r;
+        };
+
+        size_t __i = 0;
+        if constexpr (not _HasInit)
+          {
+            if (__n == 0)
+              return __out;
+            __i = std::min(__n, __size);
+            simd_partial_store(__step(simd_partial_load<_Vp>(__first, __i), false_type()),
+                               __out, __i);
+          }
+        for (; __i + __size <= __n; __i += __size)
+          simd_unchecked_store(__step(simd_unchecked_load<_Vp>(__first + __i, __size),
+                                      true_type()), __out + __i, __size);
+        if (__i < __n)
+          simd_partial_store(__step(simd_partial_load<_Vp>(__first + __i, __n - __i),
+                                    true_type()), __out + __i, __n - __i);
+        return __out + __n;
+      }
+  }
+
+  /**
+   * Writes the inclusive prefix scan of __in to __out and returns the end of the output range.
+   * __out may equal ranges::begin(__in). The range is processed in chunks of _Vp (default:
+   * simd<range_value_t<_Rg>>), carrying the running total from one chunk to the next.
+   */
+  template <class _Vp = void, __detail::__sized_contiguous_range _Rg, contiguous_iterator _Out,
+            __detail::__binary_operation<ranges::range_value_t<_Rg>> _BinaryOperation = plus<>>
+    requires indirectly_writable<_Out, ranges::range_value_t<_Rg>>
+    constexpr _Out
+    simd_inclusive_scan(_Rg&& __in, _Out __out, _BinaryOperation __binary_op = {})
+    {
+      using _Rp = __detail::__simd_load_return_t<_Vp, ranges::range_value_t<_Rg>>;
+      return __detail::__simd_range_scan<_Rp, false, false>(__in, __out, __binary_op, {});
+    }
+
+  template <class _Vp = void, __detail::__sized_contiguous_range _Rg, contiguous_iterator _Out,
+            __detail::__binary_operation<ranges::range_value_t<_Rg>> _BinaryOperation>
+    requires indirectly_writable<_Out, ranges::range_value_t<_Rg>>
+    constexpr _Out
+    simd_inclusive_scan(_Rg&& __in, _Out __out, _BinaryOperation __binary_op,
+                        ranges::range_value_t<_Rg> __init)
+    {
+      using _Rp = __detail::__simd_load_return_t<_Vp, ranges::range_value_t<_Rg>>;
+      return __detail::__simd_range_scan<_Rp, false, true>(__in, __out, __binary_op, __init);
+    }
+
+  /**
+   * Writes the exclusive prefix scan of __in, starting with __init, to __out and returns the end
+   * of the output range.
+   */
+  template <class _Vp = void, __detail::__sized_contiguous_range _Rg, contiguous_iterator _Out,
+            __detail::__binary_operation<ranges::range_value_t<_Rg>> _BinaryOperation = plus<>>
+    requires indirectly_writable<_Out, ranges::range_value_t<_Rg>>
+    constexpr _Out
+    simd_exclusive_scan(_Rg&& __in, _Out __out, ranges::range_value_t<_Rg> __init,
+                        _BinaryOperation __binary_op = {})
+    {
+      using _Rp = __detail::__simd_load_return_t<_Vp, ranges::range_value_t<_Rg>>;
+      return __detail::__simd_range_scan<_Rp, true, true>(__in, __out, __binary_op, __init);
+    }
+}
+
+#endif  // PROTOTYPE_SIMD_SCAN_H_
@@ -0,0 +1,494 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later WITH GCC-exception-3.1 */
+/* Copyright © 2025      GSI Helmholtzzentrum fuer Schwerionenforschung GmbH
+ *                       Matthias Kretz <m.kretz@gsi.de>
+ */
+
+#ifndef PROTOTYPE_SIMD_SOA_H_
+#define PROTOTYPE_SIMD_SOA_H_
+
+#include "simd.h"
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <new>
+#include <span>
+#include <tuple>
+#include <utility>
+
+namespace std
+{
+  namespace __detail
+  {
+    struct __any_initializer
+    {
+      template <typename _Tp>
+        operator _Tp() const;
+    };
+
+    /**
+     * The number of initializers _Sp accepts in aggregate initialization (at most 8).
+     */
+    template <typename _Sp, typename... _Args>
+      consteval size_t
+      __aggregate_member_count()
+      {
+        if constexpr (sizeof...(_Args) < 8 and requires { _Sp{_Args()..., __any_initializer()}; })
+          return __aggregate_member_count<_Sp, _Args..., __any_initializer>();
+        else
+          return sizeof...(_Args);
+      }
+
+    template <typename _Sp>
+      consteval size_t
+      __soa_member_count()
+      {
+        if constexpr (requires { tuple_size<_Sp>::value; })
+          return tuple_size<_Sp>::value;
+        else if constexpr (is_aggregate_v<_Sp>)
+          return __aggregate_member_count<_Sp>();
+        else
+          return 0;
+      }
+
+    /**
+     * Returns a tuple of references to the members of __s (via structured bindings).
+     */
+    template <size_t _Np, typename _Sp>
+      _GLIBCXX_SIMD_INTRINSIC constexpr auto
+      __tie_members(_Sp& __s)
+      {
+        if constexpr (_Np == 1)
+          {
+            auto& [__m0] = __s;
+            return std::tie(__m0);
+          }
+        else if constexpr (_Np == 2)
+          {
+            auto& [__m0, __m1] = __s;
+            return std::tie(__m0, __m1);
+          }
+        else if constexpr (_Np == 3)
+          {
+            auto& [__m0, __m1, __m2] = __s;
+            return std::tie(__m0, __m1, __m2);
+          }
+        else if constexpr (_Np == 4)
+          {
+            auto& [__m0, __m1, __m2, __m3] = __s;
+            return std::tie(__m0, __m1, __m2, __m3);
+          }
+        else if constexpr (_Np == 5)
+          {
+            auto& [__m0, __m1, __m2, __m3, __m4] = __s;
+            return std::tie(__m0, __m1, __m2, __m3, __m4);
+          }
+        else if constexpr (_Np == 6)
+          {
+            auto& [__m0, __m1, __m2, __m3, __m4, __m5] = __s;
+            return std::tie(__m0, __m1, __m2, __m3, __m4, __m5);
+          }
+        else if constexpr (_Np == 7)
+          {
+            auto& [__m0, __m1, __m2, __m3, __m4, __m5, __m6] = __s;
+            return std::tie(__m0, __m1, __m2, __m3, __m4, __m5, __m6);
+          }
+        else if constexpr (_Np == 8)
+          {
+            auto& [__m0, __m1, __m2, __m3, __m4, __m5, __m6, __m7] = __s;
+            return std::tie(__m0, __m1, __m2, __m3, __m4, __m5, __m6, __m7);
+          }
+      }
+
+    template <typename _Tuple>
+      struct __soa_members;
+
+    template <typename... _Ts>
+      struct __soa_members<tuple<_Ts&...>>
+      {
+        using _Values = tuple<remove_cv_t<_Ts>...>;
+
+        using _Pointers = tuple<remove_cv_t<_Ts>*...>;
+
+        static constexpr bool _S_vectorizable = (__vectorizable<remove_cv_t<_Ts>> and ...);
+
+        static constexpr _SimdSizeType _S_default_width
+          = std::min({__simd_size_v<remove_cv_t<_Ts>, _NativeAbi<remove_cv_t<_Ts>>>...});
+
+        template <_SimdSizeType _Wp>
+          using _Block = tuple<simd<remove_cv_t<_Ts>, _Wp>...>;
+      };
+
+    template <typename _Sp>
+      using __soa_members_t = __soa_members<decltype(__tie_members<__soa_member_count<_Sp>()>(
+                                                       declval<_Sp&>()))>;
+
+    template <typename _Sp>
+      concept __soa_struct = default_initializable<_Sp> and copyable<_Sp>
+                               and (__soa_member_count<_Sp>() >= 1)
+                               and (__soa_member_count<_Sp>() <= 8)
+                               and __soa_members_t<_Sp>::_S_vectorizable;
+  }
+
+  /**
+   * A structure-of-arrays container for an aggregate (or tuple-like) _Struct with up to 8
+   * members of vectorizable type. Every member is stored in its own column.
+   *
+   * The columns are aligned and their capacity is a multiple of _Wp. Thus the container can be
+   * processed in blocks of _Wp elements, each block being a tuple of simd<member type, _Wp>,
+   * without partial loads or stores. The elements after size() in the last block (the padding)
+   * are value-initialized unless overwritten via store_block.
+   *
+   * The default _Wp is the smallest native simd width of all member types.
+   */
+  template <__detail::__soa_struct _Struct,
+            __detail::_SimdSizeType _Wp = __detail::__soa_members_t<_Struct>::_S_default_width>
+    requires (_Wp >= 1)
+    class simd_soa_vector
+    {
+      using _Members = __detail::__soa_members_t<_Struct>;
+
+    public:
+      static constexpr size_t member_count = __detail::__soa_member_count<_Struct>();
+
+      template <size_t _Ip>
+        using member_type = tuple_element_t<_Ip, typename _Members::_Values>;
+
+      template <size_t _Ip>
+        using simd_type = simd<member_type<_Ip>, _Wp>;
+
+      using value_type = _Struct;
+
+      using block_type = typename _Members::template _Block<_Wp>;
+
+      static constexpr integral_constant<__detail::_SimdSizeType, _Wp> block_size {};
+
+    private:
+      typename _Members::_Pointers _M_columns = {};
+
+      size_t _M_size = 0;
+
+      size_t _M_capacity = 0;
+
+      template <size_t _Ip>
+        static constexpr align_val_t _S_alignment
+          = align_val_t(simd_alignment_v<simd_type<_Ip>>);
+
+      // simd_flag_aligned holds for every block if the block size is a multiple of the alignment
+      template <size_t _Ip>
+        static constexpr bool _S_aligned_blocks
+          = _Wp * sizeof(member_type<_Ip>) % simd_alignment_v<simd_type<_Ip>> == 0;
+
+      template <size_t _Ip>
+        static constexpr auto _S_block_flags = [] {
+          if constexpr (_S_aligned_blocks<_Ip>)
+            return simd_flag_aligned;
+          else
+            return simd_flag_default;
+        }();
+
+      static constexpr void
+      _S_for_each_member(auto&& __fun)
+      {
+        [&]<size_t... _Is>(index_sequence<_Is...>) {
+          (__fun(integral_constant<size_t, _Is>()), ...);
+        }(make_index_sequence<member_count>());
+      }
+
+      static constexpr size_t
+      _S_round_up(size_t __n)
+      { return (__n + _Wp - 1) / _Wp * _Wp; }
+
+      static void
+      _S_deallocate(typename _Members::_Pointers& __columns) noexcept
+      {
+        _S_for_each_member([&](auto __i) {
+          if (get<__i>(__columns))
+            ::operator delete(get<__i>(__columns), _S_alignment<__i>);
+          get<__i>(__columns) = nullptr;
+        });
+      }
+
+      void
+      _M_deallocate() noexcept
+      { _S_deallocate(_M_columns); }
+
+      // owns the columns under construction, so that they are freed if a later allocation throws
+      struct _ColumnsGuard
+      {
+        typename _Members::_Pointers _M_columns = {};
+
+        ~_ColumnsGuard()
+        { _S_deallocate(_M_columns); }
+
+        typename _Members::_Pointers
+        _M_release() noexcept
+        { return std::exchange(_M_columns, {}); }
+      };
+
+      // allocates columns of capacity __capacity, copies the first __n elements of __from, and
+      // value-initializes the rest
+      static typename _Members::_Pointers
+      _S_allocate(size_t __capacity, const typename _Members::_Pointers& __from, size_t __n)
+      {
+        _ColumnsGuard __guard;
+        _S_for_each_member([&](auto __i) {
+          using _Tp = member_type<__i>;
+          _Tp* __ptr = static_cast<_Tp*>(::operator new(__capacity * sizeof(_Tp),
+                                                        _S_alignment<__i>));
+          get<__i>(__guard._M_columns) = __ptr;
+          if (__n > 0)
+            std::memcpy(__ptr, get<__i>(__from), __n * sizeof(_Tp));
+          std::fill(__ptr + __n, __ptr + __capacity, _Tp());
+        });
+        return __guard._M_release();
+      }
+
+      void
+      _M_reallocate(size_t __capacity, size_t __n)
+      {
+        const auto __new = _S_allocate(__capacity, _M_columns, __n);
+        _M_deallocate();
+        _M_columns = __new;
+        _M_capacity = __capacity;
+      }
+
+      // value-initializes the elements [__first, __last) of all columns
+      void
+      _M_value_initialize(size_t __first, size_t __last) noexcept
+      {
+        _S_for_each_member([&](auto __i) {
+          std::fill(get<__i>(_M_columns) + __first, get<__i>(_M_columns) + __last,
+                    member_type<__i>());
+        });
+      }
+
+    public:
+      simd_soa_vector() = default;
+
+      explicit
+      simd_soa_vector(size_t __n)
+      { resize(__n); }
+
+      simd_soa_vector(const simd_soa_vector& __rhs)
+      : _M_size(__rhs._M_size)
+      {
+        if (__rhs._M_capacity > 0)
+          {
+            _M_columns = _S_allocate(__rhs._M_capacity, __rhs._M_columns, __rhs._M_capacity);
+            _M_capacity = __rhs._M_capacity;
+          }
+      }
+
+      simd_soa_vector(simd_soa_vector&& __rhs) noexcept
+      : _M_columns(std::exchange(__rhs._M_columns, {})),
+        _M_size(std::exchange(__rhs._M_size, 0)),
+        _M_capacity(std::exchange(__rhs._M_capacity, 0))
+      {}
+
+      simd_soa_vector&
+      operator=(const simd_soa_vector& __rhs)
+      {
+        if (this != &__rhs)
+          *this = simd_soa_vector(__rhs);
+        return *this;
+      }
+
+      simd_soa_vector&
+      operator=(simd_soa_vector&& __rhs) noexcept
+      {
+        if (this != &__rhs)
+          {
+            _M_deallocate();
+            _M_columns = std::exchange(__rhs._M_columns, {});
+            _M_size = std::exchange(__rhs._M_size, 0);
+            _M_capacity = std::exchange(__rhs._M_capacity, 0);
+          }
+        return *this;
+      }
+
+      ~simd_soa_vector()
+      { _M_deallocate(); }
+
+      size_t
+      size() const noexcept
+      { return _M_size; }
+
+      bool
+      empty() const noexcept
+      { return _M_size == 0; }
+
+      /**
+       * Always a multiple of block_size.
+       */
+      size_t
+      capacity() const noexcept
+      { return _M_capacity; }
+
+      void
+      reserve(size_t __n)
+      {
+        if (__n > _M_capacity)
+          _M_reallocate(_S_round_up(__n), _M_size);
+      }
+
+      void
+      resize(size_t __n)
+      {
+        if (__n > _M_capacity)
+          _M_reallocate(_S_round_up(std::max(__n, 2 * _M_capacity)), _M_size);
+        else if (__n > _M_size)
+          _M_value_initialize(_M_size, __n);
+        else // the removed elements become padding
+          _M_value_initialize(__n, _M_size);
+        _M_size = __n;
+      }
+
+      void
+      clear() noexcept
+      {
+        _M_value_initialize(0, _M_size);
+        _M_size = 0;
+      }
+
+      void
+      push_back(const _Struct& __s)
+      {
+        if (_M_size == _M_capacity)
+          _M_reallocate(_S_round_up(std::max(_M_size + 1, 2 * _M_capacity)), _M_size);
+        set(_M_size++, __s);
+      }
+
+      _Struct
+      operator[](size_t __i) const
+      {
+        __glibcxx_simd_precondition(__i < _M_size, "index out of bounds");
+        _Struct __r {};
+        auto __refs = __detail::__tie_members<member_count>(__r);
+        _S_for_each_member([&](auto __m) { get<__m>(__refs) = get<__m>(_M_columns)[__i]; });
+        return __r;
+      }
+
+      void
+      set(size_t __i, const _Struct& __s)
+      {
+        __glibcxx_simd_precondition(__i < _M_size, "index out of bounds");
+        const auto __refs = __detail::__tie_members<member_count>(__s);
+        _S_for_each_member([&](auto __m) { get<__m>(_M_columns)[__i] = get<__m>(__refs); });
+      }
+
+      /**
+       * The contiguous storage of member _Ip of all elements.
+       */
+      template <size_t _Ip>
+        requires (_Ip < member_count)
+        span<member_type<_Ip>>
+        column() noexcept
+        { return {get<_Ip>(_M_columns), _M_size}; }
+
+      template <size_t _Ip>
+        requires (_Ip < member_count)
+        span<const member_type<_Ip>>
+        column() const noexcept
+        { return {get<_Ip>(_M_columns), _M_size}; }
+
+      /**
+       * The number of blocks covering all elements. The last block may contain padding.
+       */
+      size_t
+      block_count() const noexcept
+      { return (_M_size + _Wp - 1) / _Wp; }
+
+      /**
+       * Loads elements [__b * block_size, (__b + 1) * block_size) of all members.
+       */
+      block_type
+      load_block(size_t __b) const
+      {
+        __glibcxx_simd_precondition(__b < block_count(), "block index out of bounds");
+        return [&]<size_t... _Is>(index_sequence<_Is...>) {
+          return block_type {
+            simd_unchecked_load<simd_type<_Is>>(
+              span<const member_type<_Is>, _Wp>(get<_Is>(_M_columns) + __b * _Wp, _Wp),
+              _S_block_flags<_Is>)...
+          };
+        }(make_index_sequence<member_count>());
+      }
+
+      /**
+       * Stores __x to elements [__b * block_size, (__b + 1) * block_size) of all members.
+       */
+      void
+      store_block(size_t __b, const block_type& __x)
+      {
+        __glibcxx_simd_precondition(__b < block_count(), "block index out of bounds");
+        _S_for_each_member([&](auto __i) {
+          simd_unchecked_store(get<__i>(__x),
+                               span<member_type<__i>, _Wp>(get<__i>(_M_columns) + __b * _Wp, _Wp),
+                               _S_block_flags<__i>);
+        });
+      }
+
+      /**
+       * Iterates over the blocks. Dereferencing loads the block.
+       */
+      class const_iterator
+      {
+        const simd_soa_vector* _M_v = nullptr;
+
+        size_t _M_block = 0;
+
+      public:
+        using value_type = block_type;
+
+        using difference_type = ptrdiff_t;
+
+        using iterator_concept = forward_iterator_tag;
+
+        const_iterator() = default;
+
+        const_iterator(const simd_soa_vector* __v, size_t __b)
+        : _M_v(__v), _M_block(__b)
+        {}
+
+        value_type
+        operator*() const
+        { return _M_v->load_block(_M_block); }
+
+        const_iterator&
+        operator++()
+        {
+          ++_M_block;
+          return *this;
+        }
+
+        const_iterator
+        operator++(int)
+        {
+          const_iterator __tmp = *this;
+          ++_M_block;
+          return __tmp;
+        }
+
+        /**
+         * The index of the current block.
+         */
+        size_t
+        index() const
+        { return _M_block; }
+
+        friend bool
+        operator==(const const_iterator&, const const_iterator&) = default;
+      };
+
+      const_iterator
+      begin() const
+      { return {this, 0}; }
+
+      const_iterator
+      end() const
+      { return {this, block_count()}; }
+    };
+}
+
+#endif  // PROTOTYPE_SIMD_SOA_H_
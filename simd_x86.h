@@ -10,6 +10,7 @@
 #include "simd_builtin.h"
 #include "x86_detail.h"
 
+#include <bit>
 #include <x86intrin.h>
 
 namespace std
@@ -417,11 +418,13 @@ namespace std::__detail
               else
                 {
                   static_assert(not _S_use_bitmasks);
+                  // the mask is only reinterpreted for the 4- and 8-Byte element types supported
+                  // by vmaskmov
                   using _IV = __vec_builtin_type<
                                 conditional_t<sizeof(_Up) == 4, int, long long>, _S_full_size>;
-                  const auto __vk = reinterpret_cast<_IV>(__k);
                   if constexpr (_Flags._M_have_avx2() and is_integral_v<_Up> and sizeof(_Up) >= 4)
                     {
+                      const auto __vk = reinterpret_cast<_IV>(__k);
                       const auto* __vmem = reinterpret_cast<const _IV*>(__mem);
                       if constexpr (sizeof(_Up) == 4 and __vecbytes == 32)
                         return reinterpret_cast<_TV>(__builtin_ia32_maskloadd256(__vmem, __vk));
@@ -434,6 +437,7 @@ namespace std::__detail
                     }
                   else if constexpr (_Flags._M_have_avx() and sizeof(_Up) >= 4)
                     {
+                      const auto __vk = reinterpret_cast<_IV>(__k);
                       using _FV = __vec_builtin_type<
                                     conditional_t<sizeof(_Up) == 4, float, double>, _S_full_size>;
                       const auto* __vmem = reinterpret_cast<const _FV*>(__mem);
@@ -608,6 +612,536 @@ namespace std::__detail
 #undef _GLIBCXX_SIMD_MASK_LOAD_FLT
         }
 
+      // Non-temporal load via movntdqa (SSE4.1, AVX2 for 32 Bytes, AVX-512F for 64 Bytes). __mem
+      // is aligned to simd_alignment_v. Converting loads and loads of less than a full register
+      // use the regular load.
+      template <typename _Tp, typename _Up>
+        _GLIBCXX_SIMD_INTRINSIC static _SimdMember<_Tp>
+        _S_stream_load(const _Up* __mem, _TypeTag<_Tp> __tag)
+        {
+          using _TV = _SimdMember<_Tp>;
+          constexpr bool __need_cvt = sizeof(_Tp) != sizeof(_Up)
+                                        or is_integral_v<_Tp> != is_integral_v<_Up>;
+          constexpr size_t __bytes = sizeof(_Tp) * _S_size;
+          // movntdqa does not write to memory, but the builtins take a non-const pointer
+          auto* __ptr = const_cast<_Up*>(__mem);
+          if constexpr (__need_cvt or __bytes != sizeof(_TV))
+            return _Base::_S_load(__mem, __tag);
+          else if constexpr (__bytes == 16 and _Flags._M_have_sse4_1())
+            return reinterpret_cast<_TV>(
+                     __builtin_ia32_movntdqa(reinterpret_cast<__v2llong*>(__ptr)));
+          else if constexpr (__bytes == 32 and _Flags._M_have_avx2())
+            return reinterpret_cast<_TV>(
+                     __builtin_ia32_movntdqa256(reinterpret_cast<__v4llong*>(__ptr)));
+          else if constexpr (__bytes == 64 and _Flags._M_have_avx512f())
+            return reinterpret_cast<_TV>(
+                     __builtin_ia32_movntdqa512(reinterpret_cast<__v8llong*>(__ptr)));
+          else
+            return _Base::_S_load(__mem, __tag);
+        }
+
+      // Non-temporal store via movnt{ps,pd,dq} for full registers and movnti for 4 and 8 Bytes.
+      // __mem is aligned to simd_alignment_v. Converting stores and all other sizes use the
+      // regular store.
+      template <__vec_builtin _TV, typename _Up>
+        _GLIBCXX_SIMD_INTRINSIC static void
+        _S_stream_store(_TV __v, _Up* __mem, _TypeTag<__value_type_of<_TV>> __tag) noexcept
+        {
+          using _Tp = __value_type_of<_TV>;
+          constexpr bool __need_cvt = sizeof(_Tp) != sizeof(_Up)
+                                        or is_integral_v<_Tp> != is_integral_v<_Up>;
+          constexpr size_t __bytes = sizeof(_Tp) * _S_size;
+          constexpr bool __ps = is_floating_point_v<_Tp> and sizeof(_Tp) == 4;
+          constexpr bool __pd = is_floating_point_v<_Tp> and sizeof(_Tp) == 8;
+          if constexpr (__need_cvt)
+            _Base::_S_store(__v, __mem, __tag);
+          else if constexpr (__bytes == 4)
+            __builtin_ia32_movnti(reinterpret_cast<int*>(__mem),
+                                  reinterpret_cast<__v4int32>(__vec_zero_pad_to_16(__v))[0]);
+#ifdef __x86_64__
+          else if constexpr (__bytes == 8)
+            __builtin_ia32_movnti64(reinterpret_cast<long long*>(__mem),
+                                    reinterpret_cast<__v2llong>(__vec_zero_pad_to_16(__v))[0]);
+#endif
+          else if constexpr (__bytes != sizeof(_TV))
+            _Base::_S_store(__v, __mem, __tag);
+          else if constexpr (__bytes == 16 and __ps)
+            __builtin_ia32_movntps(reinterpret_cast<float*>(__mem),
+                                   reinterpret_cast<__v4float>(__v));
+          else if constexpr (__bytes == 16 and __pd)
+            __builtin_ia32_movntpd(reinterpret_cast<double*>(__mem),
+                                   reinterpret_cast<__v2double>(__v));
+          else if constexpr (__bytes == 16)
+            __builtin_ia32_movntdq(reinterpret_cast<__v2llong*>(__mem),
+                                   reinterpret_cast<__v2llong>(__v));
+          else if constexpr (__bytes == 32 and __ps)
+            __builtin_ia32_movntps256(reinterpret_cast<float*>(__mem),
+                                      reinterpret_cast<__v8float>(__v));
+          else if constexpr (__bytes == 32 and __pd)
+            __builtin_ia32_movntpd256(reinterpret_cast<double*>(__mem),
+                                      reinterpret_cast<__v4double>(__v));
+          else if constexpr (__bytes == 32)
+            __builtin_ia32_movntdq256(reinterpret_cast<__v4llong*>(__mem),
+                                      reinterpret_cast<__v4llong>(__v));
+          else if constexpr (__bytes == 64 and __ps)
+            __builtin_ia32_movntps512(reinterpret_cast<float*>(__mem),
+                                      reinterpret_cast<__v16float>(__v));
+          else if constexpr (__bytes == 64 and __pd)
+            __builtin_ia32_movntpd512(reinterpret_cast<double*>(__mem),
+                                      reinterpret_cast<__v8double>(__v));
+          else if constexpr (__bytes == 64)
+            __builtin_ia32_movntdq512(reinterpret_cast<__v8llong*>(__mem),
+                                      reinterpret_cast<__v8llong>(__v));
+          else
+            _Base::_S_store(__v, __mem, __tag);
+        }
+
+      // True if a vgather/vscatter instruction exists for the given value, memory, and index
+      // types. vscatter requires AVX-512 (bitmasks). Unsigned 32-bit indexes are excluded because
+      // the instructions sign-extend the index.
+      template <__vec_builtin _TV, typename _Up, __vec_builtin _IV>
+        static constexpr bool _S_have_gather_scatter_insn = [] {
+          using _Tp = __value_type_of<_TV>;
+          using _Ip = __value_type_of<_IV>;
+          constexpr int __bytes = sizeof(_TV);
+          constexpr int __ibytes = sizeof(_IV);
+          if constexpr (sizeof(_Tp) != sizeof(_Up) or is_integral_v<_Tp> != is_integral_v<_Up>
+                          or (sizeof(_Tp) != 4 and sizeof(_Tp) != 8)
+                          or (sizeof(_Ip) != 4 and sizeof(_Ip) != 8)
+                          or (sizeof(_Ip) == 4 and is_unsigned_v<_Ip>)
+                          or __width_of<_TV> != __width_of<_IV>
+                          or __bytes < 16 or __ibytes < 16)
+            return false;
+          else if constexpr (_S_use_bitmasks)
+            return std::max(__bytes, __ibytes) == 64 or _Flags._M_have_avx512vl();
+          else
+            return _Flags._M_have_avx2() and __bytes <= 32 and __ibytes <= 32;
+        }();
+
+      template <typename _Tp, typename _Up, __vec_builtin _IV>
+        _GLIBCXX_SIMD_INTRINSIC static _SimdMember<_Tp>
+        _S_gather(const _Up* __mem, _IV __idx, _TypeTag<_Tp> __tag)
+        {
+          using _TV = _SimdMember<_Tp>;
+          if constexpr (_S_have_gather_scatter_insn<_TV, _Up, _IV>)
+            return _S_masked_gather(_TV(), _Abi::template _S_implicit_mask<_Tp>, __mem, __idx);
+          else
+            return _Base::_S_gather(__mem, __idx, __tag);
+        }
+
+      template <__vec_builtin _TV, typename _Up, __vec_builtin _IV>
+        _GLIBCXX_SIMD_INTRINSIC static _TV
+        _S_masked_gather(_TV __merge, _MaskMember<_TV> __k, const _Up* __mem, _IV __idx)
+        {
+          if constexpr (_S_have_gather_scatter_insn<_TV, _Up, _IV>)
+            {
+              using _Tp = __value_type_of<_TV>;
+              using _Ep = conditional_t<is_integral_v<_Tp>, __x86_builtin_int_t<_Tp>, _Tp>;
+              using _EV = __vec_builtin_type_bytes<_Ep, sizeof(_TV)>;
+              using _IntV = __vec_builtin_type_bytes<__x86_builtin_int_t<__value_type_of<_IV>>,
+                                                     sizeof(_IV)>;
+              constexpr int __bytes = sizeof(_TV);
+              constexpr bool __idx32 = sizeof(__value_type_of<_IV>) == 4;
+              const auto* __ptr = reinterpret_cast<const _Ep*>(__mem);
+              const _EV __src = reinterpret_cast<_EV>(__merge);
+              const _IntV __ii = reinterpret_cast<_IntV>(__idx);
+              const auto __kk = [&] {
+                if constexpr (_S_use_bitmasks)
+                  return _S_to_bitmask(__k);
+                else
+                  return reinterpret_cast<_EV>(__k);
+              }();
+
+#define _GLIBCXX_SIMD_GATHER(name, flt, in)                                                        \
+  if constexpr (is_integral_v<_Tp>)                                                                \
+    return reinterpret_cast<_TV>(                                                                  \
+             __builtin_ia32_##name##in(__src, __ptr, __ii, __kk, sizeof(_Up)));                    \
+  else                                                                                             \
+    return reinterpret_cast<_TV>(                                                                  \
+             __builtin_ia32_##name##flt(__src, __ptr, __ii, __kk, sizeof(_Up)))
+
+              if constexpr (not _S_use_bitmasks)
+                {
+                  if constexpr (sizeof(_Tp) == 4 and __idx32 and __bytes == 16)
+                    { _GLIBCXX_SIMD_GATHER(gathersiv4, sf, si); }
+                  else if constexpr (sizeof(_Tp) == 4 and __idx32 and __bytes == 32)
+                    { _GLIBCXX_SIMD_GATHER(gathersiv8, sf, si); }
+                  else if constexpr (sizeof(_Tp) == 4 and __bytes == 16)
+                    { _GLIBCXX_SIMD_GATHER(gatherdiv4, sf256, si256); }
+                  else if constexpr (__idx32 and __bytes == 32)
+                    { _GLIBCXX_SIMD_GATHER(gathersiv4, df, di); }
+                  else if constexpr (not __idx32 and __bytes == 16)
+                    { _GLIBCXX_SIMD_GATHER(gatherdiv2, df, di); }
+                  else if constexpr (not __idx32 and __bytes == 32)
+                    { _GLIBCXX_SIMD_GATHER(gatherdiv4, df, di); }
+                  else
+                    static_assert(false);
+                }
+              else if constexpr (sizeof(_Tp) == 4 and __idx32)
+                {
+                  if constexpr (__bytes == 16)
+                    { _GLIBCXX_SIMD_GATHER(gather3siv4, sf, si); }
+                  else if constexpr (__bytes == 32)
+                    { _GLIBCXX_SIMD_GATHER(gather3siv8, sf, si); }
+                  else
+                    { _GLIBCXX_SIMD_GATHER(gathersiv16, sf, si); }
+                }
+              else if constexpr (sizeof(_Tp) == 4)
+                {
+                  if constexpr (__bytes == 16)
+                    { _GLIBCXX_SIMD_GATHER(gather3div8, sf, si); }
+                  else
+                    { _GLIBCXX_SIMD_GATHER(gatherdiv16, sf, si); }
+                }
+              else if constexpr (__idx32)
+                {
+                  if constexpr (__bytes == 32)
+                    { _GLIBCXX_SIMD_GATHER(gather3siv4, df, di); }
+                  else
+                    { _GLIBCXX_SIMD_GATHER(gathersiv8, df, di); }
+                }
+              else
+                {
+                  if constexpr (__bytes == 16)
+                    { _GLIBCXX_SIMD_GATHER(gather3div2, df, di); }
+                  else if constexpr (__bytes == 32)
+                    { _GLIBCXX_SIMD_GATHER(gather3div4, df, di); }
+                  else
+                    { _GLIBCXX_SIMD_GATHER(gatherdiv8, df, di); }
+                }
+#undef _GLIBCXX_SIMD_GATHER
+            }
+          else
+            return _Base::_S_masked_gather(__merge, __k, __mem, __idx);
+        }
+
+      template <__vec_builtin _TV, typename _Up, __vec_builtin _IV>
+        _GLIBCXX_SIMD_INTRINSIC static void
+        _S_scatter(_TV __v, _Up* __mem, _IV __idx)
+        {
+          if constexpr (_S_use_bitmasks and _S_have_gather_scatter_insn<_TV, _Up, _IV>)
+            _S_masked_scatter(__v, _Abi::template _S_implicit_mask<__value_type_of<_TV>>, __mem,
+                              __idx);
+          else
+            _Base::_S_scatter(__v, __mem, __idx);
+        }
+
+      template <__vec_builtin _TV, typename _Up, __vec_builtin _IV>
+        _GLIBCXX_SIMD_INTRINSIC static void
+        _S_masked_scatter(_TV __v, _MaskMember<_TV> __k, _Up* __mem, _IV __idx)
+        {
+          if constexpr (_S_use_bitmasks and _S_have_gather_scatter_insn<_TV, _Up, _IV>)
+            {
+              using _Tp = __value_type_of<_TV>;
+              using _Ep = conditional_t<is_integral_v<_Tp>, __x86_builtin_int_t<_Tp>, _Tp>;
+              using _EV = __vec_builtin_type_bytes<_Ep, sizeof(_TV)>;
+              using _IntV = __vec_builtin_type_bytes<__x86_builtin_int_t<__value_type_of<_IV>>,
+                                                     sizeof(_IV)>;
+              constexpr int __bytes = sizeof(_TV);
+              constexpr bool __idx32 = sizeof(__value_type_of<_IV>) == 4;
+              auto* __ptr = reinterpret_cast<_Ep*>(__mem);
+              const _EV __vv = reinterpret_cast<_EV>(__v);
+              const _IntV __ii = reinterpret_cast<_IntV>(__idx);
+              const auto __kk = _S_to_bitmask(__k);
+
+#define _GLIBCXX_SIMD_SCATTER(name, flt, in)                                                       \
+  if constexpr (is_integral_v<_Tp>)                                                                \
+    __builtin_ia32_##name##in(__ptr, __kk, __ii, __vv, sizeof(_Up));                               \
+  else                                                                                             \
+    __builtin_ia32_##name##flt(__ptr, __kk, __ii, __vv, sizeof(_Up))
+
+              if constexpr (sizeof(_Tp) == 4 and __idx32)
+                {
+                  if constexpr (__bytes == 16)
+                    { _GLIBCXX_SIMD_SCATTER(scattersiv4, sf, si); }
+                  else if constexpr (__bytes == 32)
+                    { _GLIBCXX_SIMD_SCATTER(scattersiv8, sf, si); }
+                  else
+                    { _GLIBCXX_SIMD_SCATTER(scattersiv16, sf, si); }
+                }
+              else if constexpr (sizeof(_Tp) == 4)
+                {
+                  if constexpr (__bytes == 16)
+                    { _GLIBCXX_SIMD_SCATTER(scatterdiv8, sf, si); }
+                  else
+                    { _GLIBCXX_SIMD_SCATTER(scatterdiv16, sf, si); }
+                }
+              else if constexpr (__idx32)
+                {
+                  if constexpr (__bytes == 32)
+                    { _GLIBCXX_SIMD_SCATTER(scattersiv4, df, di); }
+                  else
+                    { _GLIBCXX_SIMD_SCATTER(scattersiv8, df, di); }
+                }
+              else
+                {
+                  if constexpr (__bytes == 16)
+                    { _GLIBCXX_SIMD_SCATTER(scatterdiv2, df, di); }
+                  else if constexpr (__bytes == 32)
+                    { _GLIBCXX_SIMD_SCATTER(scatterdiv4, df, di); }
+                  else
+                    { _GLIBCXX_SIMD_SCATTER(scatterdiv8, df, di); }
+                }
+#undef _GLIBCXX_SIMD_SCATTER
+            }
+          else
+            _Base::_S_masked_scatter(__v, __k, __mem, __idx);
+        }
+
+      // True if vpcompress/vpexpand can be used for _TV.
+      template <__vec_builtin _TV>
+        static constexpr bool _S_have_compress_insn
+          = _S_use_bitmasks and sizeof(_TV) >= 16
+              and (sizeof(_TV) == 64 or _Flags._M_have_avx512vl())
+              and (sizeof(__value_type_of<_TV>) >= 4 or _Flags._M_have_avx512vbmi2());
+
+#define _GLIBCXX_SIMD_COMPRESS_EXPAND(op, u, a, b, ...)                                            \
+  [&] {                                                                                            \
+    using _Tp = __value_type_of<_TV>;                                                              \
+    using _Ep = conditional_t<is_floating_point_v<_Tp>, _Tp, __x86_builtin_int_t<_Tp>>;            \
+    using _EV = __vec_builtin_type_bytes<_Ep, sizeof(_TV)>;                                        \
+    [[maybe_unused]] const _EV __aa = reinterpret_cast<_EV>(a);                                    \
+    [[maybe_unused]] const _EV __bb = reinterpret_cast<_EV>(b);                                    \
+    const auto __kk = _S_to_bitmask(__k);                                                          \
+    _GLIBCXX_SIMD_COMPRESS_EXPAND_T(op, u##qi, sizeof(_Tp) == 1, __VA_ARGS__)                      \
+    else _GLIBCXX_SIMD_COMPRESS_EXPAND_T(op, u##hi, sizeof(_Tp) == 2, __VA_ARGS__)                 \
+    else _GLIBCXX_SIMD_COMPRESS_EXPAND_T(op, sf, (is_same_v<_Ep, float>), __VA_ARGS__)             \
+    else _GLIBCXX_SIMD_COMPRESS_EXPAND_T(op, si, sizeof(_Tp) == 4, __VA_ARGS__)                    \
+    else _GLIBCXX_SIMD_COMPRESS_EXPAND_T(op, df, (is_same_v<_Ep, double>), __VA_ARGS__)            \
+    else _GLIBCXX_SIMD_COMPRESS_EXPAND_T(op, di, sizeof(_Tp) == 8, __VA_ARGS__)                    \
+    else                                                                                           \
+      static_assert(false);                                                                        \
+  }()
+
+#define _GLIBCXX_SIMD_COMPRESS_EXPAND_T(op, type, cond, ...)                                       \
+  if constexpr (cond and sizeof(_TV) == 16)                                                        \
+    return __builtin_ia32_##op##type##128_mask(__VA_ARGS__);                                       \
+  else if constexpr (cond and sizeof(_TV) == 32)                                                   \
+    return __builtin_ia32_##op##type##256_mask(__VA_ARGS__);                                       \
+  else if constexpr (cond and sizeof(_TV) == 64)                                                   \
+    return __builtin_ia32_##op##type##512_mask(__VA_ARGS__);
+
+      // pshufb indexes for compressing (_Expand = false) or expanding (_Expand = true) the 4-byte
+      // elements selected by the 4-bit table index. Unselected bytes are 0x80 (i.e. zeroed).
+      template <bool _Expand>
+        alignas(16) static constexpr array<array<char, 16>, 16> _S_dword_shuffle_table = [] {
+          array<array<char, 16>, 16> __r = {};
+          for (int __m = 0; __m < 16; ++__m)
+            {
+              for (char& __x : __r[__m])
+                __x = char(0x80);
+              int __n = 0;
+              for (int __i = 0; __i < 4; ++__i)
+                {
+                  if (((__m >> __i) & 1) == 0)
+                    continue;
+                  for (int __b = 0; __b < 4; ++__b)
+                    {
+                      if constexpr (_Expand)
+                        __r[__m][__i * 4 + __b] = char(__n * 4 + __b);
+                      else
+                        __r[__m][__n * 4 + __b] = char(__i * 4 + __b);
+                    }
+                  ++__n;
+                }
+            }
+          return __r;
+        }();
+
+      // Returns the indexes of the bytes selected by the 16-bit __m in ascending order in the
+      // low bytes of the result. The remaining bytes are 0x80 (i.e. pshufb zeros them).
+      _GLIBCXX_SIMD_INTRINSIC static __v16qi
+      _S_compress_byte_indexes(unsigned __m)
+      {
+        using _V16 = __vec_builtin_type_bytes<signed char, 16>;
+        constexpr _V16 __iota = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15};
+        const unsigned long long __lo_sel
+          = __builtin_ia32_pdep_di(__m & 0xff, 0x0101010101010101ull) * 0xff;
+        const unsigned long long __hi_sel
+          = __builtin_ia32_pdep_di(__m >> 8, 0x0101010101010101ull) * 0xff;
+        const unsigned long long __lo = __builtin_ia32_pext_di(0x0706050403020100ull, __lo_sel);
+        const unsigned long long __hi = __builtin_ia32_pext_di(0x0f0e0d0c0b0a0908ull, __hi_sel);
+        // the low half holds __nlo indexes, the remaining bytes are filled from __hi (shift
+        // twice to avoid UB for shifts by 64)
+        const unsigned __nlo4 = 4 * __builtin_popcount(__m & 0xff);
+        _V16 __idx = reinterpret_cast<_V16>(
+                       __v2du{__lo | ((__hi << __nlo4) << __nlo4),
+                              (__hi >> (32 - __nlo4)) >> (32 - __nlo4)});
+        __idx |= __iota >= static_cast<signed char>(__builtin_popcount(__m));
+        return reinterpret_cast<__v16qi>(__idx);
+      }
+
+      // Returns the byte indexes 0, 1, 2, ... deposited at the bytes selected by the 16-bit __m.
+      // The remaining bytes are zero.
+      _GLIBCXX_SIMD_INTRINSIC static __v16qi
+      _S_expand_byte_indexes(unsigned __m)
+      {
+        const unsigned long long __lo_sel
+          = __builtin_ia32_pdep_di(__m & 0xff, 0x0101010101010101ull) * 0xff;
+        const unsigned long long __hi_sel
+          = __builtin_ia32_pdep_di(__m >> 8, 0x0101010101010101ull) * 0xff;
+        const unsigned long long __nlo = __builtin_popcount(__m & 0xff);
+        const unsigned long long __lo = __builtin_ia32_pdep_di(0x0706050403020100ull, __lo_sel);
+        const unsigned long long __hi
+          = __builtin_ia32_pdep_di(0x0706050403020100ull + __nlo * 0x0101010101010101ull,
+                                   __hi_sel);
+        return reinterpret_cast<__v16qi>(__v2du{__lo, __hi});
+      }
+
+      // True if _S_compress/_S_expand have a shuffle-based implementation for the vector mask
+      // _TV.
+      template <__vec_builtin _TV>
+        static constexpr bool _S_have_compress_shuffle
+          = not _S_use_bitmasks and sizeof(_TV) <= 16 and _Flags._M_have_ssse3()
+              and (sizeof(__value_type_of<_TV>) >= 4 or _Flags._M_have_bmi2());
+
+      template <__vec_builtin _TV>
+        _GLIBCXX_SIMD_INTRINSIC static _TV
+        _S_compress(_TV __v, _MaskMember<_TV> __k)
+        {
+          using _Tp = __value_type_of<_TV>;
+          // padding elements must not be selected
+          __k = _Abi::_S_masked(__k);
+          if constexpr (_S_have_compress_insn<_TV>)
+            return reinterpret_cast<_TV>(
+                     _GLIBCXX_SIMD_COMPRESS_EXPAND(compress, , __v, _TV(), __aa, __bb, __kk));
+          else if constexpr (_S_have_compress_shuffle<_TV> and sizeof(_TV) < 16)
+            return __vec_bitcast_trunc<_TV>(
+                     _S_compress_shuffle(__vec_zero_pad_to_16(__v), __vec_zero_pad_to_16(__k)));
+          else if constexpr (_S_have_compress_shuffle<_TV>)
+            return _S_compress_shuffle(__v, __k);
+          else if constexpr (sizeof(_TV) == 32 and sizeof(_Tp) >= 4 and _Flags._M_have_avx2()
+                               and _Flags._M_have_bmi2())
+            {
+              // compress the dword indexes via pext and permute with vpermd
+              const unsigned __m = __builtin_ia32_movmskps256(reinterpret_cast<__v8sf>(__k));
+              const unsigned long long __sel
+                = __builtin_ia32_pdep_di(__m, 0x0101010101010101ull) * 0xff;
+              const unsigned long long __idx
+                = __builtin_ia32_pext_di(0x0706050403020100ull, __sel);
+              const __v8si __perm = __builtin_ia32_pmovzxbd256(
+                                      reinterpret_cast<__v16qi>(__v2du{__idx, 0}));
+              const _TV __r = reinterpret_cast<_TV>(
+                                __builtin_ia32_permvarsi256(reinterpret_cast<__v8si>(__v), __perm));
+              using _Ip = __mask_integer_from<sizeof(_Tp)>;
+              // _Base::_S_mask_with_n_true because __n == _S_size is valid here
+              const int __n = __builtin_popcount(__m) / (sizeof(_Tp) / 4);
+              return __vec_and(__r, reinterpret_cast<_TV>(
+                                      _Base::template _S_mask_with_n_true<_Ip>(__n)));
+            }
+          else
+            return _Base::_S_compress(__v, __k);
+        }
+
+      // Implements _S_compress for 16-byte vectors via pshufb. __k must not select padding
+      // elements.
+      template <__vec_builtin _TV, __vec_builtin _KV>
+        requires (sizeof(_TV) == 16 and sizeof(_KV) == 16)
+        _GLIBCXX_SIMD_INTRINSIC static _TV
+        _S_compress_shuffle(_TV __v, _KV __k)
+        {
+          __v16qi __idx;
+          if constexpr (sizeof(__value_type_of<_TV>) >= 4)
+            // table lookup, indexed by the 4-bit dword mask
+            __idx = __builtin_bit_cast(
+                      __v16qi, _S_dword_shuffle_table<false>[
+                                 __builtin_ia32_movmskps(reinterpret_cast<__v4sf>(__k))]);
+          else
+            // compress the byte indexes via pext
+            __idx = _S_compress_byte_indexes(__movmsk(reinterpret_cast<__v16qi>(__k)));
+          return reinterpret_cast<_TV>(
+                   __builtin_ia32_pshufb128(reinterpret_cast<__v16qi>(__v), __idx));
+        }
+
+      template <__vec_builtin _TV>
+        _GLIBCXX_SIMD_INTRINSIC static _TV
+        _S_expand(_TV __v, _MaskMember<_TV> __k, _TV __orig)
+        {
+          using _Tp = __value_type_of<_TV>;
+          __k = _Abi::_S_masked(__k);
+          if constexpr (_S_have_compress_insn<_TV>)
+            return reinterpret_cast<_TV>(
+                     _GLIBCXX_SIMD_COMPRESS_EXPAND(expand, , __v, __orig, __aa, __bb, __kk));
+          else if constexpr (_S_have_compress_shuffle<_TV>)
+            {
+              const auto __v16 = reinterpret_cast<__v16qi>(__vec_zero_pad_to_16(__v));
+              const auto __k16 = reinterpret_cast<__v16qi>(__vec_zero_pad_to_16(__k));
+              __v16qi __idx;
+              if constexpr (sizeof(_Tp) >= 4)
+                __idx = __builtin_bit_cast(
+                          __v16qi, _S_dword_shuffle_table<true>[
+                                     __builtin_ia32_movmskps(reinterpret_cast<__v4sf>(__k16))]);
+              else
+                __idx = _S_expand_byte_indexes(__movmsk(__k16));
+              const _TV __r = __vec_bitcast_trunc<_TV>(__builtin_ia32_pshufb128(__v16, __idx));
+              const _TV __kv = reinterpret_cast<_TV>(__k);
+              return __vec_or(__vec_and(__kv, __r), __vec_andnot(__kv, __orig));
+            }
+          else if constexpr (sizeof(_TV) == 32 and sizeof(_Tp) >= 4 and _Flags._M_have_avx2()
+                               and _Flags._M_have_bmi2())
+            {
+              const unsigned __m = __builtin_ia32_movmskps256(reinterpret_cast<__v8sf>(__k));
+              const unsigned long long __sel
+                = __builtin_ia32_pdep_di(__m, 0x0101010101010101ull) * 0xff;
+              const unsigned long long __idx
+                = __builtin_ia32_pdep_di(0x0706050403020100ull, __sel);
+              const __v8si __perm = __builtin_ia32_pmovzxbd256(
+                                      reinterpret_cast<__v16qi>(__v2du{__idx, 0}));
+              const _TV __r = reinterpret_cast<_TV>(
+                                __builtin_ia32_permvarsi256(reinterpret_cast<__v8si>(__v), __perm));
+              const _TV __kv = reinterpret_cast<_TV>(__k);
+              return __vec_or(__vec_and(__kv, __r), __vec_andnot(__kv, __orig));
+            }
+          else
+            return _Base::_S_expand(__v, __k, __orig);
+        }
+
+      // Writes exactly reduce_count(__k) elements: vpcompress with a memory operand on AVX-512,
+      // a masked store of the compressed vector on AVX2.
+      template <__vec_builtin _TV>
+        _GLIBCXX_SIMD_INTRINSIC static int
+        _S_compress_store(_TV __v, _MaskMember<_TV> __k, __value_type_of<_TV>* __mem)
+        {
+          using _Tp = __value_type_of<_TV>;
+          __k = _Abi::_S_masked(__k);
+          if constexpr (_S_have_compress_insn<_TV>)
+            {
+              _GLIBCXX_SIMD_COMPRESS_EXPAND(compressstore, u, __v, __v,
+                                            reinterpret_cast<_EV*>(__mem), __aa, __kk);
+              return __builtin_popcountll(_S_to_bitmask(__k));
+            }
+          else if constexpr (not _S_use_bitmasks and sizeof(_TV) >= 16 and sizeof(_Tp) >= 4
+                               and _Flags._M_have_avx2())
+            {
+              const int __n = __builtin_popcount(__movmsk(__k));
+              const _TV __c = _S_compress(__v, __k);
+              using _Ip = __mask_integer_from<sizeof(_Tp)>;
+              const auto __kn = _Base::template _S_mask_with_n_true<_Ip>(__n);
+              if constexpr (sizeof(_Tp) == 4 and sizeof(_TV) == 16)
+                __builtin_ia32_maskstored(reinterpret_cast<__v4si*>(__mem), __kn,
+                                          reinterpret_cast<__v4si>(__c));
+              else if constexpr (sizeof(_Tp) == 4 and sizeof(_TV) == 32)
+                __builtin_ia32_maskstored256(reinterpret_cast<__v8si*>(__mem), __kn,
+                                             reinterpret_cast<__v8si>(__c));
+              else if constexpr (sizeof(_Tp) == 8 and sizeof(_TV) == 16)
+                __builtin_ia32_maskstoreq(reinterpret_cast<__v2di*>(__mem),
+                                          reinterpret_cast<__v2di>(__kn),
+                                          reinterpret_cast<__v2di>(__c));
+              else if constexpr (sizeof(_Tp) == 8 and sizeof(_TV) == 32)
+                __builtin_ia32_maskstoreq256(reinterpret_cast<__v4di*>(__mem),
+                                             reinterpret_cast<__v4di>(__kn),
+                                             reinterpret_cast<__v4di>(__c));
+              else
+                static_assert(false);
+              return __n;
+            }
+          else
+            return _Base::_S_compress_store(__v, __k, __mem);
+        }
+
+#undef _GLIBCXX_SIMD_COMPRESS_EXPAND
+#undef _GLIBCXX_SIMD_COMPRESS_EXPAND_T
+
       // Returns: __k ? __a : __b
       // Requires: _TV to be a __vec_builtin_type matching valuetype for the bitmask __k
       template <std::integral _Kp, __vec_builtin _TV>
@@ -947,12 +1481,63 @@ namespace std::__detail
 
       using _Base::_S_convert_mask;
 
+      /**
+       * There are no arithmetic instructions for float16_t without AVX512-FP16. Evaluate in float
+       * and round the result once. For +, -, *, /, and sqrt this yields the correctly rounded result
+       * because float has more than twice as many mantissa digits.
+       */
+      template <typename _Tp>
+        static constexpr bool _S_eval_in_float
+          = __half_float<_Tp> and not _Flags._M_have_avx512fp16();
+
+      template <__vec_builtin _TV, same_as<_TV>... _More>
+        _GLIBCXX_SIMD_INTRINSIC static _TV
+        _S_as_float(auto __fun, _TV __x, _More... __more)
+        {
+          using _FV = __vec_builtin_type<float, __width_of<_TV>>;
+          constexpr size_t __max_bytes = _Flags._M_have_avx512f() ? 64
+                                           : _Flags._M_have_avx() ? 32 : 16;
+          if constexpr (sizeof(_FV) > __max_bytes)
+            return __vec_concat(_S_as_float(__fun, __vec_extract_part<0, 2>(__x),
+                                            __vec_extract_part<0, 2>(__more)...),
+                                _S_as_float(__fun, __vec_extract_part<1, 2>(__x),
+                                            __vec_extract_part<1, 2>(__more)...));
+          else
+            return __vec_convert<_TV>(__fun(__vec_convert<_FV>(__x),
+                                            __vec_convert<_FV>(__more)...));
+        }
+
+      template <__vec_builtin _TV>
+        _GLIBCXX_SIMD_INTRINSIC static constexpr _TV
+        _S_plus(_TV __x, _TV __y)
+        {
+          if constexpr (_S_eval_in_float<__value_type_of<_TV>>)
+            if (not __builtin_is_constant_evaluated())
+              return _S_as_float([](auto __a, auto __b) { return __a + __b; }, __x, __y);
+          return _Base::_S_plus(__x, __y);
+        }
+
+      template <__vec_builtin _TV>
+        _GLIBCXX_SIMD_INTRINSIC static constexpr _TV
+        _S_minus(_TV __x, _TV __y)
+        {
+          if constexpr (_S_eval_in_float<__value_type_of<_TV>>)
+            if (not __builtin_is_constant_evaluated())
+              return _S_as_float([](auto __a, auto __b) { return __a - __b; }, __x, __y);
+          return _Base::_S_minus(__x, __y);
+        }
+
 #ifndef __clang__
       template <__vec_builtin _TV>
         _GLIBCXX_SIMD_INTRINSIC static constexpr _TV
         _S_multiplies(_TV __x, _TV __y)
         {
           using _Tp = __value_type_of<_TV>;
+          if constexpr (_S_eval_in_float<_Tp>)
+            {
+              if (not __builtin_is_constant_evaluated())
+                return _S_as_float([](auto __a, auto __b) { return __a * __b; }, __x, __y);
+            }
           if (__builtin_is_constant_evaluated() or __builtin_constant_p(__x)
                 or __builtin_constant_p(__y))
             return __x * __y;
@@ -1026,6 +1611,18 @@ namespace std::__detail
           else
             return _Base::_S_multiplies(__x, __y);
         }
+#else
+      // clang optimizes the integer multiplications itself, but float16_t still needs the detour
+      // via float
+      template <__vec_builtin _TV>
+        _GLIBCXX_SIMD_INTRINSIC static constexpr _TV
+        _S_multiplies(_TV __x, _TV __y)
+        {
+          if constexpr (_S_eval_in_float<__value_type_of<_TV>>)
+            if (not __builtin_is_constant_evaluated())
+              return _S_as_float([](auto __a, auto __b) { return __a * __b; }, __x, __y);
+          return _Base::_S_multiplies(__x, __y);
+        }
 #endif
 
       // integer division not optimized (PR90993)
@@ -1070,7 +1667,10 @@ namespace std::__detail
           using _Tp = __value_type_of<_TV>;
           if (not __builtin_is_constant_evaluated() and not __builtin_constant_p(__y))
             {
-              if constexpr (is_integral_v<_Tp> and sizeof(_Tp) <= 4)
+              if constexpr (_S_eval_in_float<_Tp>)
+                return _S_as_float([](auto __a, auto __b) { return _S_fp_div(__a, __b); },
+                                   __x, __y);
+              else if constexpr (is_integral_v<_Tp> and sizeof(_Tp) <= 4)
                 { // use divps - codegen of `x/y` is suboptimal (as of GCC 9.0.1)
                   // Note that using floating-point division is likely to raise the
                   // *Inexact* exception flag and thus appears like an invalid
@@ -1133,11 +1733,460 @@ namespace std::__detail
 
 #else
 
-      using _Base::_S_divides;
+      template <__vec_builtin _TV>
+        _GLIBCXX_SIMD_INTRINSIC static constexpr _TV
+        _S_divides(_TV __x, _TV __y)
+        {
+          if constexpr (_S_eval_in_float<__value_type_of<_TV>>)
+            if (not __builtin_is_constant_evaluated())
+              return _S_as_float([](auto __a, auto __b) { return __a / __b; }, __x, __y);
+          return _Base::_S_divides(__x, __y);
+        }
+
       using _Base::_S_modulus;
 
 #endif
 
+      template <__vec_builtin _TV>
+        requires is_integral_v<__value_type_of<_TV>>
+        _GLIBCXX_SIMD_INTRINSIC static constexpr _TV
+        _S_mulhi(_TV __x, _TV __y)
+        {
+          using _Tp = __value_type_of<_TV>;
+          if (__builtin_is_constant_evaluated())
+            return _Base::_S_mulhi(__x, __y);
+          else if constexpr (sizeof(_Tp) == 2
+                               and (sizeof(_TV) <= 16
+                                      or (sizeof(_TV) == 32 and _Flags._M_have_avx2())
+                                      or (sizeof(_TV) == 64 and _Flags._M_have_avx512bw())))
+            {
+              const auto __ix = __to_x86_intrin(__x);
+              const auto __iy = __to_x86_intrin(__y);
+              if constexpr (sizeof(__ix) == 16)
+                return __vec_bitcast_trunc<_TV>(is_signed_v<_Tp> ? _mm_mulhi_epi16(__ix, __iy)
+                                                                 : _mm_mulhi_epu16(__ix, __iy));
+              else if constexpr (sizeof(__ix) == 32)
+                return __vec_bitcast<_Tp>(is_signed_v<_Tp> ? _mm256_mulhi_epi16(__ix, __iy)
+                                                           : _mm256_mulhi_epu16(__ix, __iy));
+              else
+                return __vec_bitcast<_Tp>(is_signed_v<_Tp> ? _mm512_mulhi_epi16(__ix, __iy)
+                                                           : _mm512_mulhi_epu16(__ix, __iy));
+            }
+          else if constexpr (sizeof(_Tp) == 4 and (is_unsigned_v<_Tp> or _Flags._M_have_sse4_1())
+                               and (sizeof(_TV) <= 16
+                                      or (sizeof(_TV) == 32 and _Flags._M_have_avx2())
+                                      or (sizeof(_TV) == 64 and _Flags._M_have_avx512f())))
+            { // pmul(u)dq multiplies the even 32-bit elements to 64-bit products
+              auto __mul_even = [] [[__gnu__::__always_inline__]] (auto __a, auto __b) {
+                const auto __ia = __to_x86_intrin(__a);
+                const auto __ib = __to_x86_intrin(__b);
+                if constexpr (sizeof(__ia) == 16)
+                  return __vec_bitcast<unsigned long long>(
+                           is_signed_v<_Tp> ? _mm_mul_epi32(__ia, __ib) : _mm_mul_epu32(__ia, __ib));
+                else if constexpr (sizeof(__ia) == 32)
+                  return __vec_bitcast<unsigned long long>(
+                           is_signed_v<_Tp> ? _mm256_mul_epi32(__ia, __ib)
+                                            : _mm256_mul_epu32(__ia, __ib));
+                else
+                  return __vec_bitcast<unsigned long long>(
+                           is_signed_v<_Tp> ? _mm512_mul_epi32(__ia, __ib)
+                                            : _mm512_mul_epu32(__ia, __ib));
+              };
+              const auto __xq = __vec_bitcast<unsigned long long>(__to_x86_intrin(__x));
+              const auto __yq = __vec_bitcast<unsigned long long>(__to_x86_intrin(__y));
+              const auto __even = __mul_even(__xq, __yq) >> 32;
+              const auto __odd = __mul_even(__xq >> 32, __yq >> 32) & 0xffff'ffff'0000'0000u;
+              return __vec_bitcast_trunc<_TV>(__even | __odd);
+            }
+          else
+            return _Base::_S_mulhi(__x, __y);
+        }
+
+      /**
+       * Complex multiplication of interleaved (real, imaginary) pairs: (fm)addsub subtracts in the
+       * real and adds in the imaginary lanes, so no deinterleaving is necessary.
+       */
+      template <__vec_builtin _TV>
+        requires is_floating_point_v<__value_type_of<_TV>>
+        _GLIBCXX_SIMD_INTRINSIC static constexpr _TV
+        _S_complex_multiplies(_TV __x, _TV __y)
+        {
+          using _Tp = __value_type_of<_TV>;
+          if (__builtin_is_constant_evaluated())
+            return _Base::_S_complex_multiplies(__x, __y);
+          else if constexpr ((sizeof(_Tp) == 4 or sizeof(_Tp) == 8) and _Flags._M_have_sse3()
+                               and (sizeof(_TV) <= 32
+                                      or (sizeof(_TV) == 64 and _Flags._M_have_avx512f())))
+            {
+              const _TV __re = _GLIBCXX_SIMD_INT_PACK(__width_of<_TV>, _Is, {
+                                 return __builtin_shufflevector(__x, __x, (_Is & ~1)...);
+                               });
+              const _TV __im = _GLIBCXX_SIMD_INT_PACK(__width_of<_TV>, _Is, {
+                                 return __builtin_shufflevector(__x, __x, (_Is | 1)...);
+                               });
+              const _TV __y_swapped = _GLIBCXX_SIMD_INT_PACK(__width_of<_TV>, _Is, {
+                                        return __builtin_shufflevector(__y, __y, (_Is ^ 1)...);
+                                      });
+              const auto __a = __to_x86_intrin(__re);
+              const auto __b = __to_x86_intrin(__y);
+              const auto __c = __to_x86_intrin(__im * __y_swapped);
+              if constexpr (sizeof(__a) == 64)
+                {
+                  if constexpr (sizeof(_Tp) == 4)
+                    return __vec_bitcast<_Tp>(_mm512_fmaddsub_ps(__a, __b, __c));
+                  else
+                    return __vec_bitcast<_Tp>(_mm512_fmaddsub_pd(__a, __b, __c));
+                }
+              else if constexpr (_Flags._M_have_fma())
+                {
+                  if constexpr (sizeof(__a) == 32 and sizeof(_Tp) == 4)
+                    return __vec_bitcast<_Tp>(_mm256_fmaddsub_ps(__a, __b, __c));
+                  else if constexpr (sizeof(__a) == 32)
+                    return __vec_bitcast<_Tp>(_mm256_fmaddsub_pd(__a, __b, __c));
+                  else if constexpr (sizeof(_Tp) == 4)
+                    return __vec_bitcast_trunc<_TV>(_mm_fmaddsub_ps(__a, __b, __c));
+                  else
+                    return __vec_bitcast_trunc<_TV>(_mm_fmaddsub_pd(__a, __b, __c));
+                }
+              else
+                {
+                  if constexpr (sizeof(__a) == 32 and sizeof(_Tp) == 4)
+                    return __vec_bitcast<_Tp>(_mm256_addsub_ps(__a * __b, __c));
+                  else if constexpr (sizeof(__a) == 32)
+                    return __vec_bitcast<_Tp>(_mm256_addsub_pd(__a * __b, __c));
+                  else if constexpr (sizeof(_Tp) == 4)
+                    return __vec_bitcast_trunc<_TV>(_mm_addsub_ps(__a * __b, __c));
+                  else
+                    return __vec_bitcast_trunc<_TV>(_mm_addsub_pd(__a * __b, __c));
+                }
+            }
+          else
+            return _Base::_S_complex_multiplies(__x, __y);
+        }
+
+      // <bit> functions; the value type of _TV is an unsigned integer type
+
+      /**
+       * Byte-wise lookup via pshufb: every byte of __idx (< 16) selects a byte from the same
+       * 16-byte lane of __table. _UV is a vector of unsigned char and 16, 32, or 64 bytes large.
+       */
+      template <__vec_builtin _UV>
+        _GLIBCXX_SIMD_INTRINSIC static _UV
+        _S_nibble_lookup(_UV __table, _UV __idx)
+        {
+          const auto __it = __to_x86_intrin(__table);
+          const auto __ii = __to_x86_intrin(__idx);
+          if constexpr (sizeof(_UV) == 16)
+            return reinterpret_cast<_UV>(_mm_shuffle_epi8(__it, __ii));
+          else if constexpr (sizeof(_UV) == 32)
+            return reinterpret_cast<_UV>(_mm256_shuffle_epi8(__it, __ii));
+          else
+            return reinterpret_cast<_UV>(_mm512_shuffle_epi8(__it, __ii));
+        }
+
+      /**
+       * Returns a vector of unsigned chars, where byte __i is __gen(__i % 16).
+       */
+      template <__vec_builtin _UV>
+        _GLIBCXX_SIMD_INTRINSIC static constexpr _UV
+        _S_nibble_table(auto __gen)
+        {
+          return _GLIBCXX_SIMD_INT_PACK(sizeof(_UV), _Is, {
+                   return _UV{static_cast<unsigned char>(__gen(_Is % 16))...};
+                 });
+        }
+
+      // pshufb on the full vector width
+      template <__vec_builtin _TV>
+        static constexpr bool _S_have_pshufb
+          = _Flags._M_have_ssse3() and (sizeof(_TV) <= 16
+                                          or (sizeof(_TV) == 32 and _Flags._M_have_avx2())
+                                          or (sizeof(_TV) == 64 and _Flags._M_have_avx512bw()));
+
+      template <__vec_builtin _TV>
+        requires is_integral_v<__value_type_of<_TV>>
+        _GLIBCXX_SIMD_INTRINSIC static constexpr _TV
+        _S_bit_popcount(_TV __x)
+        {
+          using _Tp = __value_type_of<_TV>;
+          constexpr bool __vl = sizeof(_TV) == 64 or _Flags._M_have_avx512vl();
+          if (__builtin_is_constant_evaluated())
+            return _Base::_S_bit_popcount(__x);
+          else if constexpr (sizeof(_Tp) >= 4 and __vl and _Flags._M_have_avx512vpopcntdq())
+            {
+              const auto __ix = __to_x86_intrin(__x);
+              if constexpr (sizeof(__ix) == 16)
+                return __vec_bitcast_trunc<_TV>(sizeof(_Tp) == 4 ? _mm_popcnt_epi32(__ix)
+                                                                 : _mm_popcnt_epi64(__ix));
+              else if constexpr (sizeof(__ix) == 32)
+                return __vec_bitcast<_Tp>(sizeof(_Tp) == 4 ? _mm256_popcnt_epi32(__ix)
+                                                           : _mm256_popcnt_epi64(__ix));
+              else
+                return __vec_bitcast<_Tp>(sizeof(_Tp) == 4 ? _mm512_popcnt_epi32(__ix)
+                                                           : _mm512_popcnt_epi64(__ix));
+            }
+          else if constexpr (sizeof(_Tp) <= 2 and __vl and _Flags._M_have_avx512bitalg())
+            {
+              const auto __ix = __to_x86_intrin(__x);
+              if constexpr (sizeof(__ix) == 16)
+                return __vec_bitcast_trunc<_TV>(sizeof(_Tp) == 1 ? _mm_popcnt_epi8(__ix)
+                                                                 : _mm_popcnt_epi16(__ix));
+              else if constexpr (sizeof(__ix) == 32)
+                return __vec_bitcast<_Tp>(sizeof(_Tp) == 1 ? _mm256_popcnt_epi8(__ix)
+                                                           : _mm256_popcnt_epi16(__ix));
+              else
+                return __vec_bitcast<_Tp>(sizeof(_Tp) == 1 ? _mm512_popcnt_epi8(__ix)
+                                                           : _mm512_popcnt_epi16(__ix));
+            }
+          else if constexpr (_S_have_pshufb<_TV>)
+            { // look up the counts of the low and high nibbles, then add up the bytes
+              const auto __bytes = __vec_bitcast<unsigned char>(__to_x86_intrin(__x));
+              constexpr auto __table = _S_nibble_table<remove_const_t<decltype(__bytes)>>([](int __i) {
+                                         return __builtin_popcount(__i);
+                                       });
+              const auto __counts = _S_nibble_lookup(__table, __bytes & 0x0f)
+                                      + _S_nibble_lookup(__table, (__bytes >> 4) & 0x0f);
+              if constexpr (sizeof(_Tp) == 1)
+                return __vec_bitcast_trunc<_TV>(__counts);
+              else if constexpr (sizeof(_Tp) == 8)
+                { // psadbw sums the 8 bytes of each 64-bit element
+                  const auto __ic = __to_x86_intrin(__counts);
+                  if constexpr (sizeof(__ic) == 16)
+                    return __vec_bitcast_trunc<_TV>(_mm_sad_epu8(__ic, __m128i()));
+                  else if constexpr (sizeof(__ic) == 32)
+                    return __vec_bitcast<_Tp>(_mm256_sad_epu8(__ic, __m256i()));
+                  else
+                    return __vec_bitcast<_Tp>(_mm512_sad_epu8(__ic, __m512i()));
+                }
+              else
+                {
+                  using _Up = __make_unsigned_int_t<_Tp>;
+                  auto __c = __vec_bitcast<_Up>(__counts);
+                  __c += __c >> 8;
+                  if constexpr (sizeof(_Tp) == 4)
+                    __c += __c >> 16;
+                  return __vec_bitcast_trunc<_TV>(__c & _Up(__CHAR_BIT__ * sizeof(_Tp) * 2 - 1));
+                }
+            }
+          else
+            return _Base::_S_bit_popcount(__x);
+        }
+
+      template <__vec_builtin _TV>
+        requires is_integral_v<__value_type_of<_TV>>
+        _GLIBCXX_SIMD_INTRINSIC static constexpr _TV
+        _S_countl_zero(_TV __x)
+        {
+          using _Tp = __value_type_of<_TV>;
+          constexpr bool __vl = sizeof(_TV) == 64 or _Flags._M_have_avx512vl();
+          if (__builtin_is_constant_evaluated())
+            return _Base::_S_countl_zero(__x);
+          else if constexpr (sizeof(_Tp) >= 4 and __vl and _Flags._M_have_avx512cd())
+            {
+              const auto __ix = __to_x86_intrin(__x);
+              if constexpr (sizeof(__ix) == 16)
+                return __vec_bitcast_trunc<_TV>(sizeof(_Tp) == 4 ? _mm_lzcnt_epi32(__ix)
+                                                                 : _mm_lzcnt_epi64(__ix));
+              else if constexpr (sizeof(__ix) == 32)
+                return __vec_bitcast<_Tp>(sizeof(_Tp) == 4 ? _mm256_lzcnt_epi32(__ix)
+                                                           : _mm256_lzcnt_epi64(__ix));
+              else
+                return __vec_bitcast<_Tp>(sizeof(_Tp) == 4 ? _mm512_lzcnt_epi32(__ix)
+                                                           : _mm512_lzcnt_epi64(__ix));
+            }
+          else if constexpr (sizeof(_Tp) == 4)
+            { // read the exponent of the int -> float conversion
+              using _IV = __vec_builtin_type<int, __width_of<_TV>>;
+              const auto __u = __vec_bitcast<unsigned>(__x);
+              // keep the most significant set bit and no two adjacent set bits, such that the
+              // conversion cannot round up to the next power of two
+              const _IV __y = __vec_bitcast<int>(__u & ~(__u >> 1));
+              const _IV __exp = __vec_bitcast<int>(
+                                  __vec_bitcast<unsigned>(__vec_convert<float>(__y)) >> 23);
+              // __y == 0 yields 158 and __y < 0 yields a negative value
+              _IV __r = 158 - __exp;
+              __r = __r < 32 ? __r : _IV() + 32;
+              return __vec_bitcast<_Tp>(__r & ~(__y >> 31));
+            }
+          else if constexpr (sizeof(_Tp) <= 2 and _S_have_pshufb<_TV>)
+            { // the minimum of the table lookups for the high and low nibbles
+              const auto __bytes = __vec_bitcast<unsigned char>(__to_x86_intrin(__x));
+              constexpr auto __hi_table = _S_nibble_table<remove_const_t<decltype(__bytes)>>([](int __i) {
+                                            return __i == 0 ? 8 : 4 - std::bit_width(unsigned(__i));
+                                          });
+              constexpr auto __lo_table = _S_nibble_table<remove_const_t<decltype(__bytes)>>([](int __i) {
+                                            return 8 - std::bit_width(unsigned(__i));
+                                          });
+              const auto __hi = _S_nibble_lookup(__hi_table, (__bytes >> 4) & 0x0f);
+              const auto __lo = _S_nibble_lookup(__lo_table, __bytes & 0x0f);
+              const auto __counts = __hi < __lo ? __hi : __lo;
+              if constexpr (sizeof(_Tp) == 1)
+                return __vec_bitcast_trunc<_TV>(__counts);
+              else
+                {
+                  const auto __c = __vec_bitcast<unsigned short>(__counts);
+                  const auto __c_hi = __c >> 8;
+                  return __vec_bitcast_trunc<_TV>(__c_hi + ((__c & 0xff) & (__c_hi == 8)));
+                }
+            }
+          else
+            return _Base::_S_countl_zero(__x);
+        }
+
+      template <__vec_builtin _TV>
+        requires is_integral_v<__value_type_of<_TV>>
+        _GLIBCXX_SIMD_INTRINSIC static constexpr _TV
+        _S_countr_zero(_TV __x)
+        {
+          using _Tp = __value_type_of<_TV>;
+          if (not __builtin_is_constant_evaluated() and sizeof(_Tp) >= 4
+                and (sizeof(_TV) == 64 or _Flags._M_have_avx512vl()) and _Flags._M_have_avx512cd())
+            { // vplzcnt is cheaper than the popcount emulation
+              using _Up = __make_unsigned_int_t<_Tp>;
+              const auto __v = __vec_bitcast<_Up>(__x);
+              return __vec_bitcast<_Tp>(
+                       _Up(__CHAR_BIT__ * sizeof(_Tp))
+                         - __vec_bitcast<_Up>(_S_countl_zero(__vec_bitcast<_Tp>(~__v & (__v - 1)))));
+            }
+          else
+            return _Base::_S_countr_zero(__x);
+        }
+
+      template <__vec_builtin _TV>
+        requires is_integral_v<__value_type_of<_TV>>
+        _GLIBCXX_SIMD_INTRINSIC static constexpr _TV
+        _S_byteswap(_TV __x)
+        {
+          using _Tp = __value_type_of<_TV>;
+          if constexpr (sizeof(_Tp) == 1 or _Flags._M_have_ssse3())
+            return _Base::_S_byteswap(__x); // pshufb
+          else if (__builtin_is_constant_evaluated())
+            return _Base::_S_byteswap(__x);
+          else
+            { // swap the bytes of each 16-bit pair, then the 16-bit pairs, then the 32-bit pairs
+              const auto __v16 = __vec_bitcast<unsigned short>(__x);
+              const auto __r16 = (__v16 << 8) | (__v16 >> 8);
+              if constexpr (sizeof(_Tp) == 2)
+                return __vec_bitcast<_Tp>(__r16);
+              else
+                {
+                  const auto __v32 = __vec_bitcast<unsigned>(__r16);
+                  const auto __r32 = (__v32 << 16) | (__v32 >> 16);
+                  if constexpr (sizeof(_Tp) == 4)
+                    return __vec_bitcast<_Tp>(__r32);
+                  else
+                    {
+                      const auto __v64 = __vec_bitcast<unsigned long long>(__r32);
+                      return __vec_bitcast<_Tp>((__v64 << 32) | (__v64 >> 32));
+                    }
+                }
+            }
+        }
+
+      template <__vec_builtin _TV>
+        requires is_unsigned_v<__value_type_of<_TV>>
+        _GLIBCXX_SIMD_INTRINSIC static constexpr _TV
+        _S_rotl(_TV __x, _TV __y)
+        {
+          using _Tp = __value_type_of<_TV>;
+          constexpr bool __vl = sizeof(_TV) == 64 or _Flags._M_have_avx512vl();
+          if (__builtin_is_constant_evaluated())
+            return _Base::_S_rotl(__x, __y);
+          else if constexpr (sizeof(_Tp) >= 4 and __vl and _Flags._M_have_avx512f())
+            {
+              const auto __ix = __to_x86_intrin(__x);
+              const auto __iy = __to_x86_intrin(__y);
+              if constexpr (sizeof(__ix) == 16)
+                return __vec_bitcast_trunc<_TV>(sizeof(_Tp) == 4 ? _mm_rolv_epi32(__ix, __iy)
+                                                                 : _mm_rolv_epi64(__ix, __iy));
+              else if constexpr (sizeof(__ix) == 32)
+                return __vec_bitcast<_Tp>(sizeof(_Tp) == 4 ? _mm256_rolv_epi32(__ix, __iy)
+                                                           : _mm256_rolv_epi64(__ix, __iy));
+              else
+                return __vec_bitcast<_Tp>(sizeof(_Tp) == 4 ? _mm512_rolv_epi32(__ix, __iy)
+                                                           : _mm512_rolv_epi64(__ix, __iy));
+            }
+          else if constexpr (sizeof(_Tp) == 2 and __vl and _Flags._M_have_avx512vbmi2())
+            { // a funnel shift of __x with itself is a rotation
+              const auto __ix = __to_x86_intrin(__x);
+              const auto __iy = __to_x86_intrin(__y);
+              if constexpr (sizeof(__ix) == 16)
+                return __vec_bitcast_trunc<_TV>(_mm_shldv_epi16(__ix, __ix, __iy));
+              else if constexpr (sizeof(__ix) == 32)
+                return __vec_bitcast<_Tp>(_mm256_shldv_epi16(__ix, __ix, __iy));
+              else
+                return __vec_bitcast<_Tp>(_mm512_shldv_epi16(__ix, __ix, __iy));
+            }
+          else
+            return _Base::_S_rotl(__x, __y);
+        }
+
+      template <__vec_builtin _TV>
+        requires is_unsigned_v<__value_type_of<_TV>>
+        _GLIBCXX_SIMD_INTRINSIC static constexpr _TV
+        _S_rotl(_TV __x, int __y)
+        {
+          using _Tp = __value_type_of<_TV>;
+          if (not __builtin_is_constant_evaluated() and (sizeof(_TV) == 64 or _Flags._M_have_avx512vl())
+                and ((sizeof(_Tp) >= 4 and _Flags._M_have_avx512f())
+                       or (sizeof(_Tp) == 2 and _Flags._M_have_avx512vbmi2())))
+            return _S_rotl(__x, _TV() + _Tp(__y));
+          else
+            return _Base::_S_rotl(__x, __y);
+        }
+
+      template <__vec_builtin _TV>
+        requires is_unsigned_v<__value_type_of<_TV>>
+        _GLIBCXX_SIMD_INTRINSIC static constexpr _TV
+        _S_rotr(_TV __x, _TV __y)
+        {
+          using _Tp = __value_type_of<_TV>;
+          constexpr bool __vl = sizeof(_TV) == 64 or _Flags._M_have_avx512vl();
+          if (__builtin_is_constant_evaluated())
+            return _Base::_S_rotr(__x, __y);
+          else if constexpr (sizeof(_Tp) >= 4 and __vl and _Flags._M_have_avx512f())
+            {
+              const auto __ix = __to_x86_intrin(__x);
+              const auto __iy = __to_x86_intrin(__y);
+              if constexpr (sizeof(__ix) == 16)
+                return __vec_bitcast_trunc<_TV>(sizeof(_Tp) == 4 ? _mm_rorv_epi32(__ix, __iy)
+                                                                 : _mm_rorv_epi64(__ix, __iy));
+              else if constexpr (sizeof(__ix) == 32)
+                return __vec_bitcast<_Tp>(sizeof(_Tp) == 4 ? _mm256_rorv_epi32(__ix, __iy)
+                                                           : _mm256_rorv_epi64(__ix, __iy));
+              else
+                return __vec_bitcast<_Tp>(sizeof(_Tp) == 4 ? _mm512_rorv_epi32(__ix, __iy)
+                                                           : _mm512_rorv_epi64(__ix, __iy));
+            }
+          else if constexpr (sizeof(_Tp) == 2 and __vl and _Flags._M_have_avx512vbmi2())
+            {
+              const auto __ix = __to_x86_intrin(__x);
+              const auto __iy = __to_x86_intrin(__y);
+              if constexpr (sizeof(__ix) == 16)
+                return __vec_bitcast_trunc<_TV>(_mm_shrdv_epi16(__ix, __ix, __iy));
+              else if constexpr (sizeof(__ix) == 32)
+                return __vec_bitcast<_Tp>(_mm256_shrdv_epi16(__ix, __ix, __iy));
+              else
+                return __vec_bitcast<_Tp>(_mm512_shrdv_epi16(__ix, __ix, __iy));
+            }
+          else
+            return _Base::_S_rotr(__x, __y);
+        }
+
+      template <__vec_builtin _TV>
+        requires is_unsigned_v<__value_type_of<_TV>>
+        _GLIBCXX_SIMD_INTRINSIC static constexpr _TV
+        _S_rotr(_TV __x, int __y)
+        {
+          using _Tp = __value_type_of<_TV>;
+          if (not __builtin_is_constant_evaluated() and (sizeof(_TV) == 64 or _Flags._M_have_avx512vl())
+                and ((sizeof(_Tp) >= 4 and _Flags._M_have_avx512f())
+                       or (sizeof(_Tp) == 2 and _Flags._M_have_avx512vbmi2())))
+            return _S_rotr(__x, _TV() + _Tp(__y));
+          else
+            return _Base::_S_rotr(__x, __y);
+        }
+
       template <std::unsigned_integral _Tp>
         _GLIBCXX_SIMD_INTRINSIC static constexpr _Tp
         _S_bit_and(_Tp __x, _Tp __y)
@@ -1972,6 +3021,28 @@ namespace std::__detail
         }
 #endif // _GLIBCXX_SIMD_NO_SHIFT_OPT / __clang__
 
+      /**
+       * Compare float16_t values with vcmpps. The result is not masked.
+       */
+      template <int _Cmp, __vec_builtin _TV>
+        _GLIBCXX_SIMD_INTRINSIC static _MaskInteger
+        _S_bitmask_cmp_as_float(_TV __x, _TV __y)
+        {
+          constexpr int _Np = __width_of<_TV>;
+          if constexpr (_Np > 16)
+            return _S_bitmask_cmp_as_float<_Cmp>(__vec_extract_part<0, 2>(__x),
+                                                 __vec_extract_part<0, 2>(__y))
+                     | (_MaskInteger(_S_bitmask_cmp_as_float<_Cmp>(__vec_extract_part<1, 2>(__x),
+                                                                   __vec_extract_part<1, 2>(__y)))
+                          << (_Np / 2));
+          else
+            {
+              using _FV = __vec_builtin_type<float, _Np>;
+              return _mm512_cmp_ps_mask(__vec_zero_pad_to<64>(__vec_convert<_FV>(__x)),
+                                        __vec_zero_pad_to<64>(__vec_convert<_FV>(__y)), _Cmp);
+            }
+        }
+
       template <__vec_builtin _TV>
         _GLIBCXX_SIMD_INTRINSIC static constexpr _MaskMember<_TV>
         _S_equal_to(_TV __x, _TV __y)
@@ -1996,7 +3067,9 @@ namespace std::__detail
               [[maybe_unused]] const auto __yi = __to_x86_intrin(__y);
               if constexpr (is_floating_point_v<_Tp>)
                 {
-                  if constexpr (__vec_builtin_sizeof<_TV, 8, 64>)
+                  if constexpr (_S_eval_in_float<_Tp>)
+                    return __k1 & _S_bitmask_cmp_as_float<_CMP_EQ_OQ>(__x, __y);
+                  else if constexpr (__vec_builtin_sizeof<_TV, 8, 64>)
                     return _mm512_mask_cmp_pd_mask(__k1, __xi, __yi, _CMP_EQ_OQ);
                   else if constexpr (__vec_builtin_sizeof<_TV, 4, 64>)
                     return _mm512_mask_cmp_ps_mask(__k1, __xi, __yi, _CMP_EQ_OQ);
@@ -2072,7 +3145,9 @@ namespace std::__detail
               [[maybe_unused]] const auto __yi = __to_x86_intrin(__y);
               if constexpr (is_floating_point_v<_Tp>)
                 {
-                  if constexpr (__vec_builtin_sizeof<_TV, 8, 64>)
+                  if constexpr (_S_eval_in_float<_Tp>)
+                    return __k1 & _S_bitmask_cmp_as_float<_CMP_NEQ_UQ>(__x, __y);
+                  else if constexpr (__vec_builtin_sizeof<_TV, 8, 64>)
                     return _mm512_mask_cmp_pd_mask(__k1, __xi, __yi, _CMP_NEQ_UQ);
                   else if constexpr (__vec_builtin_sizeof<_TV, 4, 64>)
                     return _mm512_mask_cmp_ps_mask(__k1, __xi, __yi, _CMP_NEQ_UQ);
@@ -2149,7 +3224,9 @@ namespace std::__detail
               [[maybe_unused]] const auto __yi = __to_x86_intrin(__y);
               if constexpr (is_floating_point_v<_Tp>)
                 {
-                  if constexpr (__vec_builtin_sizeof<_TV, 8, 64>)
+                  if constexpr (_S_eval_in_float<_Tp>)
+                    return __k1 & _S_bitmask_cmp_as_float<_CMP_LT_OS>(__x, __y);
+                  else if constexpr (__vec_builtin_sizeof<_TV, 8, 64>)
                     return _mm512_mask_cmp_pd_mask(__k1, __xi, __yi, _CMP_LT_OS);
                   else if constexpr (__vec_builtin_sizeof<_TV, 4, 64>)
                     return _mm512_mask_cmp_ps_mask(__k1, __xi, __yi, _CMP_LT_OS);
@@ -2255,7 +3332,9 @@ namespace std::__detail
               [[maybe_unused]] const auto __yi = __to_x86_intrin(__y);
               if constexpr (is_floating_point_v<_Tp>)
                 {
-                  if constexpr (__vec_builtin_sizeof<_TV, 8, 64>)
+                  if constexpr (_S_eval_in_float<_Tp>)
+                    return __k1 & _S_bitmask_cmp_as_float<_CMP_LE_OS>(__x, __y);
+                  else if constexpr (__vec_builtin_sizeof<_TV, 8, 64>)
                     return _mm512_mask_cmp_pd_mask(__k1, __xi, __yi, _CMP_LE_OS);
                   else if constexpr (__vec_builtin_sizeof<_TV, 4, 64>)
                     return _mm512_mask_cmp_ps_mask(__k1, __xi, __yi, _CMP_LE_OS);
@@ -2353,12 +3432,22 @@ namespace std::__detail
         _GLIBCXX_SIMD_INTRINSIC static constexpr _TV
         _S_sqrt(_TV __x)
         {
-          if constexpr (__vec_builtin_sizeof<_TV, 2, 64> and _Flags._M_have_avx512fp16())
-            return __builtin_ia32_sqrtph512_mask_round(__x, _TV(), -1, _X86Round::_CurDirection);
+          if constexpr (_S_eval_in_float<__value_type_of<_TV>>)
+            {
+              if (not __builtin_is_constant_evaluated())
+                return _S_as_float([](auto __a) { return _S_sqrt(__a); }, __x);
+              return _Base::_S_sqrt(__x);
+            }
+          // the SSE intrinsics need a full XMM register; zero-padding is harmless for all of them
+          else if constexpr (sizeof(_TV) < 16)
+            return __vec_lo<sizeof(_TV)>(_S_sqrt(__vec_zero_pad_to_16(__x)));
+          else if constexpr (__vec_builtin_sizeof<_TV, 2, 64> and _Flags._M_have_avx512fp16())
+            return __builtin_ia32_sqrtph512_mask_round(__x, _TV(), -1,
+                                                       int(_X86Round::_CurDirection));
           else if constexpr (__vec_builtin_sizeof<_TV, 4, 64>)
-            return __builtin_ia32_sqrtps512_mask(__x, _TV(), -1, _X86Round::_CurDirection);
+            return __builtin_ia32_sqrtps512_mask(__x, _TV(), -1, int(_X86Round::_CurDirection));
           else if constexpr (__vec_builtin_sizeof<_TV, 8, 64>)
-            return __builtin_ia32_sqrtpd512_mask(__x, _TV(), -1, _X86Round::_CurDirection);
+            return __builtin_ia32_sqrtpd512_mask(__x, _TV(), -1, int(_X86Round::_CurDirection));
           else if constexpr (__vec_builtin_sizeof<_TV, 2, 32> and _Flags._M_have_avx512fp16())
             return __builtin_ia32_sqrtph256_mask(__x, _TV(), -1);
           else if constexpr (__vec_builtin_sizeof<_TV, 4, 32>)
@@ -2370,7 +3459,7 @@ namespace std::__detail
           else if constexpr (__vec_builtin_sizeof<_TV, 4>)
             return __builtin_ia32_sqrtps(__x);
           else if constexpr (__vec_builtin_sizeof<_TV, 8>)
-            return __builtin_ia32_sqrtps(__x);
+            return __builtin_ia32_sqrtpd(__x);
           else
             static_assert(false);
         }
@@ -2384,7 +3473,7 @@ namespace std::__detail
           using _ExpAbi = typename _Abi::template _Rebind<int>;
           using _Tp = __value_type_of<_TV>;
           constexpr int _Np = _S_size;
-          if constexpr (sizeof(__x) == 64 or _Flags._M_have_avx512vl())
+          if constexpr (sizeof(__x) == 64 or (_Flags._M_have_avx512vl() and sizeof(__x) >= 16))
             {
               const auto __xi = __to_x86_intrin(__x);
               constexpr _SimdConverter<int, _ExpAbi, _Tp, _Abi> __cvt;
@@ -2416,14 +3505,197 @@ namespace std::__detail
             return _Base::_S_ldexp(__x, __exp);
         }
 
+      template <__vec_builtin _TV>
+        _GLIBCXX_SIMD_INTRINSIC static constexpr _TV
+        _S_ldexp_fp(_TV __x, _TV __n)
+        {
+          if (not __builtin_is_constant_evaluated())
+            {
+              // scalef handles overflow, underflow, and subnormals
+              if constexpr (__vec_builtin_sizeof<_TV, 8, 64>)
+                return _mm512_scalef_pd(__x, __n);
+              else if constexpr (__vec_builtin_sizeof<_TV, 4, 64>)
+                return _mm512_scalef_ps(__x, __n);
+              else if constexpr (__vec_builtin_sizeof<_TV, 8, 32> and _Flags._M_have_avx512vl())
+                return _mm256_scalef_pd(__x, __n);
+              else if constexpr (__vec_builtin_sizeof<_TV, 4, 32> and _Flags._M_have_avx512vl())
+                return _mm256_scalef_ps(__x, __n);
+              else if constexpr (__vec_builtin_sizeof<_TV, 8, 16> and _Flags._M_have_avx512vl())
+                return _mm_scalef_pd(__x, __n);
+              else if constexpr (__vec_builtin_sizeof<_TV, 4, 16> and _Flags._M_have_avx512vl())
+                return _mm_scalef_ps(__x, __n);
+            }
+          return _Base::_S_ldexp_fp(__x, __n);
+        }
+
+      template <__vec_builtin _TV>
+        _GLIBCXX_SIMD_INTRINSIC static constexpr _TV
+        _S_log_reduce(_TV __x, _TV& __k)
+        {
+          using _Tp = __value_type_of<_TV>;
+          if (not __builtin_is_constant_evaluated())
+            {
+              // getexp and getmant handle subnormals, getmant normalizes to [1, 2)
+              _TV __m = {};
+              if constexpr (__vec_builtin_sizeof<_TV, 8, 64>)
+                {
+                  __m = _mm512_getmant_pd(__x, _MM_MANT_NORM_1_2, _MM_MANT_SIGN_src);
+                  __k = _mm512_getexp_pd(__x);
+                }
+              else if constexpr (__vec_builtin_sizeof<_TV, 4, 64>)
+                {
+                  __m = _mm512_getmant_ps(__x, _MM_MANT_NORM_1_2, _MM_MANT_SIGN_src);
+                  __k = _mm512_getexp_ps(__x);
+                }
+              else if constexpr (__vec_builtin_sizeof<_TV, 8, 32> and _Flags._M_have_avx512vl())
+                {
+                  __m = _mm256_getmant_pd(__x, _MM_MANT_NORM_1_2, _MM_MANT_SIGN_src);
+                  __k = _mm256_getexp_pd(__x);
+                }
+              else if constexpr (__vec_builtin_sizeof<_TV, 4, 32> and _Flags._M_have_avx512vl())
+                {
+                  __m = _mm256_getmant_ps(__x, _MM_MANT_NORM_1_2, _MM_MANT_SIGN_src);
+                  __k = _mm256_getexp_ps(__x);
+                }
+              else if constexpr (__vec_builtin_sizeof<_TV, 8, 16> and _Flags._M_have_avx512vl())
+                {
+                  __m = _mm_getmant_pd(__x, _MM_MANT_NORM_1_2, _MM_MANT_SIGN_src);
+                  __k = _mm_getexp_pd(__x);
+                }
+              else if constexpr (__vec_builtin_sizeof<_TV, 4, 16> and _Flags._M_have_avx512vl())
+                {
+                  __m = _mm_getmant_ps(__x, _MM_MANT_NORM_1_2, _MM_MANT_SIGN_src);
+                  __k = _mm_getexp_ps(__x);
+                }
+              else
+                return _Base::_S_log_reduce(__x, __k);
+              const auto __large = __m > _Tp(0x1.6a09e667f3bcdp0);
+              __k = __large ? __k + _Tp(1) : __k;
+              return __large ? __m * _Tp(.5) : __m;
+            }
+          return _Base::_S_log_reduce(__x, __k);
+        }
+
       template <__vec_builtin _TV>
         requires std::floating_point<__value_type_of<_TV>>
         _GLIBCXX_SIMD_INTRINSIC static constexpr _TV
-        _S_trunc(_TV __x)
+        _S_logb(_TV __x)
         {
           if (not __builtin_is_constant_evaluated())
             {
+              // getexp implements logb, including subnormals, ±0, ±∞, and NaN
               if constexpr (__vec_builtin_sizeof<_TV, 8, 64>)
+                return _mm512_getexp_pd(__x);
+              else if constexpr (__vec_builtin_sizeof<_TV, 4, 64>)
+                return _mm512_getexp_ps(__x);
+              else if constexpr (__vec_builtin_sizeof<_TV, 8, 32> and _Flags._M_have_avx512vl())
+                return _mm256_getexp_pd(__x);
+              else if constexpr (__vec_builtin_sizeof<_TV, 4, 32> and _Flags._M_have_avx512vl())
+                return _mm256_getexp_ps(__x);
+              else if constexpr (__vec_builtin_sizeof<_TV, 8, 16> and _Flags._M_have_avx512vl())
+                return _mm_getexp_pd(__x);
+              else if constexpr (__vec_builtin_sizeof<_TV, 4, 16> and _Flags._M_have_avx512vl())
+                return _mm_getexp_ps(__x);
+            }
+          return _Base::_S_logb(__x);
+        }
+
+      template <__vec_builtin _TV>
+        requires std::floating_point<__value_type_of<_TV>>
+        _GLIBCXX_SIMD_INTRINSIC static constexpr
+        typename _Abi::template _Rebind<__make_dependent_t<int, _TV>>::template _SimdMember<int>
+        _S_ilogb(_TV __x)
+        {
+          using _Tp = __value_type_of<_TV>;
+          using _RAbi = typename _Abi::template _Rebind<int>;
+          // For float the generic implementation needs no conversion to int. For double, getexp
+          // followed by the conversion to 4-byte ints is shorter than the integer exponent
+          // extraction followed by narrowing 8-byte lanes.
+          if constexpr (sizeof(_Tp) == sizeof(double) and sizeof(_TV) >= 16
+                          and (sizeof(_TV) == 64 or _Flags._M_have_avx512vl()))
+            if (not __builtin_is_constant_evaluated())
+              {
+                const _TV __e = _S_logb(__x);
+                // FP_ILOGB0, FP_ILOGBNAN, and INT_MAX are all representable as double
+                _TV __r = __e == -__infinity_v<_Tp> ? _TV() + FP_ILOGB0 : __e;
+#if !__FINITE_MATH_ONLY__
+                __r = __e == __infinity_v<_Tp> ? _TV() + __INT_MAX__
+                                               : __e == __e ? __r : _TV() + FP_ILOGBNAN;
+#endif
+                constexpr _SimdConverter<_Tp, _Abi, int, _RAbi> __cvt;
+                return __cvt(__r);
+              }
+          return _Base::_S_ilogb(__x);
+        }
+
+      template <__vec_builtin _TV>
+        requires std::floating_point<__value_type_of<_TV>>
+        _GLIBCXX_SIMD_INTRINSIC static constexpr _TV
+        _S_frexp(_TV __x, typename _Abi::template _Rebind<
+                            __make_dependent_t<int, _TV>>::template _SimdMember<int>& __exp)
+        {
+          using _Tp = __value_type_of<_TV>;
+          using _RAbi = typename _Abi::template _Rebind<int>;
+          if constexpr (sizeof(_Tp) >= 4 and sizeof(_TV) >= 16
+                          and (sizeof(_TV) == 64 or _Flags._M_have_avx512vl()))
+            if (not __builtin_is_constant_evaluated())
+              {
+                // getmant normalizes to [0.5, 1) and keeps the sign
+                _TV __m, __e;
+                if constexpr (__vec_builtin_sizeof<_TV, 8, 64>)
+                  {
+                    __m = _mm512_getmant_pd(__x, _MM_MANT_NORM_p5_1, _MM_MANT_SIGN_src);
+                    __e = _mm512_getexp_pd(__x);
+                  }
+                else if constexpr (__vec_builtin_sizeof<_TV, 4, 64>)
+                  {
+                    __m = _mm512_getmant_ps(__x, _MM_MANT_NORM_p5_1, _MM_MANT_SIGN_src);
+                    __e = _mm512_getexp_ps(__x);
+                  }
+                else if constexpr (__vec_builtin_sizeof<_TV, 8, 32>)
+                  {
+                    __m = _mm256_getmant_pd(__x, _MM_MANT_NORM_p5_1, _MM_MANT_SIGN_src);
+                    __e = _mm256_getexp_pd(__x);
+                  }
+                else if constexpr (__vec_builtin_sizeof<_TV, 4, 32>)
+                  {
+                    __m = _mm256_getmant_ps(__x, _MM_MANT_NORM_p5_1, _MM_MANT_SIGN_src);
+                    __e = _mm256_getexp_ps(__x);
+                  }
+                else if constexpr (__vec_builtin_sizeof<_TV, 8, 16>)
+                  {
+                    __m = _mm_getmant_pd(__x, _MM_MANT_NORM_p5_1, _MM_MANT_SIGN_src);
+                    __e = _mm_getexp_pd(__x);
+                  }
+                else
+                  {
+                    __m = _mm_getmant_ps(__x, _MM_MANT_NORM_p5_1, _MM_MANT_SIGN_src);
+                    __e = _mm_getexp_ps(__x);
+                  }
+                // ±0, ±∞, and NaN are returned unchanged with an exponent of 0
+#if __FINITE_MATH_ONLY__
+                const auto __regular = __x != _Tp();
+#else
+                const auto __regular
+                  = (__x != _Tp()) & (_Base::_S_fabs(__e) < __infinity_v<_Tp>);
+#endif
+                constexpr _SimdConverter<_Tp, _Abi, int, _RAbi> __cvt;
+                __exp = __cvt(__regular ? __e + _Tp(1) : _TV());
+                return __regular ? __m : __x;
+              }
+          return _Base::_S_frexp(__x, __exp);
+        }
+
+      template <__vec_builtin _TV>
+        requires std::floating_point<__value_type_of<_TV>>
+        _GLIBCXX_SIMD_INTRINSIC static constexpr _TV
+        _S_trunc(_TV __x)
+        {
+          if (not __builtin_is_constant_evaluated())
+            {
+              if constexpr (sizeof(_TV) < 16)
+                return __vec_lo<sizeof(_TV)>(_S_trunc(__vec_zero_pad_to_16(__x)));
+              else if constexpr (__vec_builtin_sizeof<_TV, 8, 64>)
                 return _mm512_roundscale_pd(__x, 0x0b);
               else if constexpr (__vec_builtin_sizeof<_TV, 4, 64>)
                 return _mm512_roundscale_ps(__x, 0x0b);
@@ -2463,7 +3735,9 @@ namespace std::__detail
           // from zero as required by std::round. Therefore this function is more
           // complicated.
           _TV __truncated;
-          if constexpr (__vec_builtin_sizeof<_TV, 8, 64>)
+          if constexpr (sizeof(_TV) < 16)
+            return __vec_lo<sizeof(_TV)>(_S_round(__vec_zero_pad_to_16(__x)));
+          else if constexpr (__vec_builtin_sizeof<_TV, 8, 64>)
             __truncated = _mm512_roundscale_pd(__x, 0x0b);
           else if constexpr (__vec_builtin_sizeof<_TV, 4, 64>)
             __truncated = _mm512_roundscale_ps(__x, 0x0b);
@@ -2504,7 +3778,9 @@ namespace std::__detail
         _GLIBCXX_SIMD_INTRINSIC static constexpr _TV
         _S_nearbyint(_TV __x)
         {
-          if constexpr (__vec_builtin_sizeof<_TV, 8, 64>)
+          if constexpr (sizeof(_TV) < 16)
+            return __vec_lo<sizeof(_TV)>(_S_nearbyint(__vec_zero_pad_to_16(__x)));
+          else if constexpr (__vec_builtin_sizeof<_TV, 8, 64>)
             return _mm512_roundscale_pd(__x, 0x0c);
           else if constexpr (__vec_builtin_sizeof<_TV, 4, 64>)
             return _mm512_roundscale_ps(__x, 0x0c);
@@ -2531,7 +3807,9 @@ namespace std::__detail
         _GLIBCXX_SIMD_INTRINSIC static constexpr _TV
         _S_rint(_TV __x)
         {
-          if constexpr (__vec_builtin_sizeof<_TV, 8, 64>)
+          if constexpr (sizeof(_TV) < 16)
+            return __vec_lo<sizeof(_TV)>(_S_rint(__vec_zero_pad_to_16(__x)));
+          else if constexpr (__vec_builtin_sizeof<_TV, 8, 64>)
             return _mm512_roundscale_pd(__x, 0x04);
           else if constexpr (__vec_builtin_sizeof<_TV, 4, 64>)
             return _mm512_roundscale_ps(__x, 0x04);
@@ -2560,7 +3838,9 @@ namespace std::__detail
         {
           if (not __builtin_is_constant_evaluated())
             {
-              if constexpr (__vec_builtin_sizeof<_TV, 8, 64>)
+              if constexpr (sizeof(_TV) < 16)
+                return __vec_lo<sizeof(_TV)>(_S_floor(__vec_zero_pad_to_16(__x)));
+              else if constexpr (__vec_builtin_sizeof<_TV, 8, 64>)
                 return _mm512_roundscale_pd(__x, 0x09);
               else if constexpr (__vec_builtin_sizeof<_TV, 4, 64>)
                 return _mm512_roundscale_ps(__x, 0x09);
@@ -2587,7 +3867,9 @@ namespace std::__detail
         _GLIBCXX_SIMD_INTRINSIC static constexpr _TV
         _S_ceil(_TV __x)
         {
-          if constexpr (__vec_builtin_sizeof<_TV, 8, 64>)
+          if constexpr (sizeof(_TV) < 16)
+            return __vec_lo<sizeof(_TV)>(_S_ceil(__vec_zero_pad_to_16(__x)));
+          else if constexpr (__vec_builtin_sizeof<_TV, 8, 64>)
             return _mm512_roundscale_pd(__x, 0x0a);
           else if constexpr (__vec_builtin_sizeof<_TV, 4, 64>)
             return _mm512_roundscale_ps(__x, 0x0a);
@@ -2903,7 +4185,9 @@ namespace std::__detail
           if constexpr (_S_use_bitmasks)
             {
               constexpr auto __k1 = _Abi::template _S_implicit_mask<_Tp>;
-              if constexpr (__vec_builtin_sizeof<_TV, 8, 64>)
+              if constexpr (_S_eval_in_float<_Tp>)
+                return __k1 & _S_bitmask_cmp_as_float<_CMP_UNORD_Q>(__x, __y);
+              else if constexpr (__vec_builtin_sizeof<_TV, 8, 64>)
                 return _mm512_mask_cmp_pd_mask(__k1, __xi, __yi, _CMP_UNORD_Q);
               else if constexpr (__vec_builtin_sizeof<_TV, 4, 64>)
                 return _mm512_mask_cmp_ps_mask(__k1, __xi, __yi, _CMP_UNORD_Q);
@@ -2934,6 +4218,8 @@ namespace std::__detail
             return _mm_cmpunord_ps(__xi, __yi);
           else if constexpr (sizeof(__xi) == 16 and sizeof(_Tp) == 8)
             return _mm_cmpunord_pd(__xi, __yi);
+          else if constexpr (sizeof(_Tp) == 2)
+            return _Base::_S_isunordered(__x, __y);
           else
             static_assert(false);
 #endif
@@ -3907,6 +5193,29 @@ namespace std::__detail
     : _SimdConverter<_From, _AbiArray<_VecAbi<_Width>, _Np>, _To, _VecAbi<_Width * _Np>>
     {};
 
+  template <__vectorizable_canon _From, __vectorizable_canon _To, int _Width, int _Np>
+    struct _SimdConverter<_From, _Avx512Abi<_Width * _Np>, _To, _AbiArray<_Avx512Abi<_Width>, _Np>>
+    : _SimdConverter<_From, _VecAbi<_Width * _Np>, _To, _AbiArray<_VecAbi<_Width>, _Np>>
+    {};
+
+  template <__vectorizable_canon _From, __vectorizable_canon _To, int _Width, int _Np>
+    struct _SimdConverter<_From, _Avx512Abi<_Width * _Np>, _To, _AbiArray<_VecAbi<_Width>, _Np>>
+    : _SimdConverter<_From, _VecAbi<_Width * _Np>, _To, _AbiArray<_VecAbi<_Width>, _Np>>
+    {};
+
+  template <__vectorizable_canon _From, __vectorizable_canon _To, int _Width, int _Np>
+    struct _SimdConverter<_From, _VecAbi<_Width * _Np>, _To, _AbiArray<_Avx512Abi<_Width>, _Np>>
+    : _SimdConverter<_From, _VecAbi<_Width * _Np>, _To, _AbiArray<_VecAbi<_Width>, _Np>>
+    {};
+
+  template <__vectorizable_canon _From, __vectorizable_canon _To, int _W0, int _N0, int _W1,
+            int _N1>
+    requires (_W0 * _N0 == _W1 * _N1) and (_W0 != _W1)
+    struct _SimdConverter<_From, _AbiArray<_Avx512Abi<_W0>, _N0>,
+                          _To, _AbiArray<_Avx512Abi<_W1>, _N1>>
+    : _SimdConverter<_From, _AbiArray<_VecAbi<_W0>, _N0>, _To, _AbiArray<_VecAbi<_W1>, _N1>>
+    {};
+
   template <__vectorizable_canon _From, __vectorizable_canon _To, int _Np, int _Mp>
     struct _SimdConverter<_From, _AbiCombine<_Np, _Avx512Abi<_Mp>>, _To, _Avx512Abi<_Np>>
     : _SimdConverter<_From, _AbiCombine<_Np, _VecAbi<_Mp>>, _To, _VecAbi<_Np>>
@@ -12,6 +12,7 @@ template <typename V>
   {
     using T = typename V::value_type;
     using M = typename V::mask_type;
+    using FV = std::rebind_simd_t<float, V>;
 
     static constexpr T min = std::numeric_limits<T>::lowest();
     static constexpr T norm_min = std::numeric_limits<T>::min();
@@ -186,6 +187,50 @@ template <typename V>
       }
     };
 
+    // float16_t converts via float (F16C or element-wise) unless AVX512-FP16 is available
+    ADD_TEST(half_float, std::is_floating_point_v<T> and sizeof(T) == 2) {
+      std::tuple{FV([](int i) { return 1.f + float(i) * 0x1p-12f; }),
+                 FV([](int i) { return float(i + 2) * 0x1p-25f; })},
+      [](auto& t, FV x, FV y) {
+        using L = std::numeric_limits<T>;
+        using FL = std::numeric_limits<float>;
+        // round to nearest, ties to even
+        t.verify_equal(V(FV(1.f + 0x1p-11f)), T(1));
+        t.verify_equal(V(FV(1.f + 0x3p-11f)), T(1 + 0x1p-9));
+        t.verify_equal(V(FV(1.f + 0x1p-11f + 0x1p-20f)), T(1 + 0x1p-10));
+        t.verify_equal(V(x), V([&](int i) { return T(x[i]); }));
+        // subnormals
+        t.verify_equal(V(y), V([&](int i) { return T(y[i]); }));
+        t.verify_equal(V(FV(0x1p-24f)), L::denorm_min());
+        t.verify_equal(V(FV(0x3p-25f)), T(0x1p-23));
+        t.verify_equal(FV(V(L::denorm_min())), 0x1p-24f);
+        t.verify_equal(FV(V(y)), FV([&](int i) { return float(T(y[i])); }));
+        // largest finite value and infinities
+        t.verify_equal(V(FV(65504.f)), L::max());
+        t.verify_equal(V(FV(65519.f)), L::max());
+        t.verify_equal(V(FV(-FL::infinity())), -L::infinity());
+        t.verify_equal(FV(V(L::infinity())), FL::infinity());
+        t.verify_equal(FV(V(-L::infinity())), -FL::infinity());
+        // underflow, overflow, and NaN are not constant
+        if not consteval
+          {
+            t.verify_equal(V(FV(0x1p-25f)), T());
+            t.verify_equal(V(FV(65520.f)), L::infinity());
+            t.verify(isnan(V(FV(FL::quiet_NaN()))));
+            // payload bits that narrowing drops must not turn the NaN into ∞
+            t.verify(isnan(V(FV(std::bit_cast<float>(0x7f80'0001u)))));
+            t.verify(isnan(FV(V(L::quiet_NaN()))));
+          }
+        // arithmetic evaluated in float is rounded once
+        const V a(x);
+        const V b(y);
+        t.verify_equal(a * b, V([&](int i) { return T(float(a[i]) * float(b[i])); }));
+        t.verify_equal(b / a, V([&](int i) { return T(float(b[i]) / float(a[i])); }));
+        t.verify_equal(a + b, V([&](int i) { return T(float(a[i]) + float(b[i])); }));
+        t.verify_equal(a - b, V([&](int i) { return T(float(a[i]) - float(b[i])); }));
+      }
+    };
+
     static constexpr V from0 = test_iota<V, 0, 63>;
     static constexpr V from1 = test_iota<V, 1, 64>;
     static constexpr V from2 = test_iota<V, 2, 65>;
@@ -204,4 +249,35 @@ template <typename V>
         t.verify_equal(x, from0);
       }
     };
+
+    ADD_TEST(invariant_divisor, std::is_integral_v<T>) {
+      std::tuple{from0, vec<V, max, T(max - 1), T(min + 1), T(max / 3)>,
+                 vec<V, min, T(min / 3), T(min + 1), T(5)>},
+      [](auto& t, V x, V y, V z) {
+        for (T d : {T(1), T(2), T(3), T(7), T(10), T(64), T(max / 3), max, T(-1), T(-7),
+                    std::is_signed_v<T> ? min : T(max - 1)})
+          {
+            const std::simd_divisor<T> dd(d);
+            t.verify_equal(dd.divisor(), d);
+            t.verify_equal(x / dd, x / V(d))(d);
+            t.verify_equal(x % dd, x % V(d))(d);
+            t.verify_equal(y / dd, y / V(d))(d);
+            t.verify_equal(y % dd, y % V(d))(d);
+            t.verify_equal(T(max / dd), T(max / d))(d);
+            t.verify_equal(T(max % dd), T(max % d))(d);
+            if (d != T(-1))
+              {
+                // min / -1 overflows
+                t.verify_equal(z / dd, z / V(d))(d);
+                t.verify_equal(z % dd, z % V(d))(d);
+              }
+            V w = y;
+            t.verify_equal(w /= dd, y / V(d))(d);
+            t.verify_equal(w, y / V(d))(d);
+            w = y;
+            t.verify_equal(w %= dd, y % V(d))(d);
+            t.verify_equal(w, y % V(d))(d);
+          }
+      }
+    };
   };
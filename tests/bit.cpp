@@ -0,0 +1,92 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright © 2025      GSI Helmholtzzentrum fuer Schwerionenforschung GmbH
+ *                       Matthias Kretz <m.kretz@gsi.de>
+ */
+
+#include "unittest_pch.h"
+
+template <typename V>
+  struct Tests
+  {
+    using T = typename V::value_type;
+    using R = std::rebind_simd_t<std::make_signed_t<T>, V>;
+
+    using U = std::make_unsigned_t<T>;
+
+    static constexpr int digits = std::numeric_limits<U>::digits;
+
+    static constexpr V bit_patterns = V([](int i) -> T {
+                                        constexpr U values[] = {
+                                          U(), U(1), U(2), U(3), U(0x5a), U(0x80), U(~U()),
+                                          U(U(1) << (digits - 1)), U(U(~U()) >> 1),
+                                          U(U(~U()) << 3), U(U(0x0f) << (digits - 8)),
+                                          U(U(~U()) / 7)};
+                                        return T(values[i % std::size(values)]);
+                                      });
+
+    static constexpr V mixed = V([](int i) -> T {
+                                 return T(U(U(0x9e3779b97f4a7c15ull) * U(i + 1)));
+                               });
+
+    template <typename F>
+      static constexpr R
+      ref(F fun, const V& x)
+      { return R([&](int i) { return std::make_signed_t<T>(fun(x[i])); }); }
+
+    ADD_TEST(counting, std::is_unsigned_v<T>) {
+      std::tuple{bit_patterns, mixed},
+      [](auto& t, const V x, const V y) {
+        for (const V v : {x, y})
+          {
+            t.verify_equal(std::popcount(v), ref([](T a) { return std::popcount(a); }, v))(v);
+            t.verify_equal(std::countl_zero(v), ref([](T a) { return std::countl_zero(a); }, v))(v);
+            t.verify_equal(std::countl_one(v), ref([](T a) { return std::countl_one(a); }, v))(v);
+            t.verify_equal(std::countr_zero(v), ref([](T a) { return std::countr_zero(a); }, v))(v);
+            t.verify_equal(std::countr_one(v), ref([](T a) { return std::countr_one(a); }, v))(v);
+            t.verify_equal(std::bit_width(v), ref([](T a) { return std::bit_width(a); }, v))(v);
+          }
+      }
+    };
+
+    ADD_TEST(powers_of_two, std::is_unsigned_v<T>) {
+      std::tuple{bit_patterns, mixed},
+      [](auto& t, const V x, const V y) {
+        for (const V v : {x, y})
+          {
+            t.verify_equal(std::bit_floor(v), V([&](int i) { return std::bit_floor(v[i]); }))(v);
+            t.verify_equal(std::has_single_bit(v),
+                           typename V::mask_type([&](int i) { return std::has_single_bit(v[i]); }))
+              (v);
+            const V w = v & T(~T() >> 1); // bit_ceil must be representable
+            t.verify_equal(std::bit_ceil(w), V([&](int i) { return std::bit_ceil(w[i]); }))(w);
+          }
+      }
+    };
+
+    ADD_TEST(byteswap, std::is_integral_v<T>) {
+      std::tuple{bit_patterns, mixed},
+      [](auto& t, const V x, const V y) {
+        for (const V v : {x, y})
+          {
+            t.verify_equal(std::byteswap(v), V([&](int i) { return std::byteswap(v[i]); }))(v);
+            t.verify_equal(std::byteswap(std::byteswap(v)), v);
+          }
+      }
+    };
+
+    ADD_TEST(rotate, std::is_unsigned_v<T>) {
+      std::tuple{mixed},
+      [](auto& t, const V x) {
+        for (int s : {0, 1, 3, digits / 2, digits - 1, digits, digits + 5, -1, -digits - 3})
+          {
+            t.verify_equal(std::rotl(x, s), V([&](int i) { return std::rotl(x[i], s); }))(x, s);
+            t.verify_equal(std::rotr(x, s), V([&](int i) { return std::rotr(x[i], s); }))(x, s);
+          }
+        const R s([](int i) { return std::make_signed_t<T>(i % (2 * digits + 3) - digits); });
+        t.verify_equal(std::rotl(x, s), V([&](int i) { return std::rotl(x[i], int(s[i])); }))(x, s);
+        t.verify_equal(std::rotr(x, s), V([&](int i) { return std::rotr(x[i], int(s[i])); }))(x, s);
+      }
+    };
+  };
+
+#include "unittest.h"
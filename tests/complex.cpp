@@ -0,0 +1,89 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright © 2025      GSI Helmholtzzentrum fuer Schwerionenforschung GmbH
+ *                       Matthias Kretz <m.kretz@gsi.de>
+ */
+
+#include "unittest_pch.h"
+
+template <typename V>
+  struct Tests
+  {
+    using T = typename V::value_type;
+
+    static constexpr bool is_complex_type = std::is_same_v<T, float> or std::is_same_v<T, double>;
+
+    using C = std::complex<T>;
+
+    // V determines the width of the complex simd
+    using CV = std::simd<std::conditional_t<is_complex_type, C, std::complex<float>>, V::size()>;
+
+    static constexpr V reals = V([](int i) { return T(i % 11 - 5) * T(0.75); });
+
+    static constexpr V imags = V([](int i) { return T(i % 7 - 2) * T(1.25) + T(0.5); });
+
+    ADD_TEST(construct, is_complex_type) {
+      std::tuple{reals, imags},
+      [](auto& t, V re, V im) {
+        const CV x(re, im);
+        const CV y([&](int i) { return C(re[i], im[i]); });
+        const CV z = C(1, 2);
+        for (int i = 0; i < V::size(); ++i)
+          {
+            t.verify_equal(x[i], C(re[i], im[i]))(i);
+            t.verify_equal(y[i], C(re[i], im[i]))(i);
+            t.verify_equal(z[i], C(1, 2))(i);
+          }
+        t.verify_equal(x.real(), re);
+        t.verify_equal(x.imag(), im);
+        t.verify_equal(real(y), re);
+        t.verify_equal(imag(y), im);
+        t.verify(all_of(x == y));
+        t.verify(none_of(x != y));
+      }
+    };
+
+    ADD_TEST(arithmetic, is_complex_type) {
+      std::tuple{reals, imags},
+      [](auto& t, V re, V im) {
+        const CV x(re, im);
+        const CV y(im + T(1), re - T(0.5));
+        const CV prod([&](int i) { return x[i] * y[i]; });
+        const CV quot([&](int i) { return x[i] / y[i]; });
+        t.verify(all_of(x + y == CV([&](int i) { return x[i] + y[i]; })));
+        t.verify(all_of(x - y == CV([&](int i) { return x[i] - y[i]; })));
+        t.verify(all_of(-x == CV([&](int i) { return -x[i]; })));
+        t.verify(all_of(conj(x) == CV([&](int i) { return std::conj(x[i]); })));
+        t.verify_equal_to_ulp((x * y).real(), prod.real(), 2);
+        t.verify_equal_to_ulp((x * y).imag(), prod.imag(), 2);
+        t.verify_equal_to_ulp((x / y).real(), quot.real(), 4);
+        t.verify_equal_to_ulp((x / y).imag(), quot.imag(), 4);
+        t.verify_equal_to_ulp(norm(x), V([&](int i) { return std::norm(x[i]); }), 1);
+        if not consteval
+        {
+          t.verify_equal_to_ulp(abs(x), V([&](int i) { return std::abs(x[i]); }), 2);
+        }
+        CV z = x;
+        t.verify(all_of((z *= y) == x * y));
+        t.verify(all_of((z /= y) == x * y / y));
+      }
+    };
+
+    ADD_TEST(loadstore, is_complex_type) {
+      std::tuple{reals, imags},
+      [](auto& t, V re, V im) {
+        std::array<C, V::size() + 1> mem = {};
+        for (int i = 0; i < V::size(); ++i)
+          mem[i + 1] = C(re[i], im[i]);
+        const CV x = std::simd_unchecked_load<CV>(mem.begin() + 1, V::size());
+        t.verify(all_of(x == CV(re, im)));
+        std::array<C, V::size()> out = {};
+        std::simd_unchecked_store(x, out);
+        for (int i = 0; i < V::size(); ++i)
+          t.verify_equal(out[i], mem[i + 1])(i);
+        const CV y = std::simd_partial_load<CV>(mem.begin() + 1, V::size() - 1);
+        t.verify_equal(y[V::size() - 1], C())(y);
+      }
+    };
+  };
+
+#include "unittest.h"
@@ -0,0 +1,577 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright © 2025      GSI Helmholtzzentrum fuer Schwerionenforschung GmbH
+ *                       Matthias Kretz <m.kretz@gsi.de>
+ */
+
+// no-fast-math
+
+#include "unittest.h"
+
+template <typename V>
+  struct Tests
+  {
+    using T = typename V::value_type;
+    using L = std::numeric_limits<T>;
+
+    static constexpr bool is_math_type = std::is_floating_point_v<T> and sizeof(T) >= sizeof(float);
+
+    // reference implementation: apply the scalar function to each element
+    template <typename F>
+      static constexpr V
+      ref(F fun, const V& x)
+      { return V([&](int i) { return fun(x[i]); }); }
+
+    template <typename F>
+      static constexpr V
+      ref(F fun, const V& x, const V& y)
+      { return V([&](int i) { return fun(x[i], y[i]); }); }
+
+    // small and medium arguments, negative and positive, crossing several quadrants
+    static constexpr V medium = V([](int i) { return T(i % 41 - 20) * T(0.37) + T(0.01); });
+
+    // arguments close to multiples of π/2 (maximum cancellation in the range reduction)
+    static constexpr V near_pio2
+      = V([](int i) { return T(i % 13 - 6) * T(1.57079632679489661923) + T(i % 3 - 1) * L::epsilon(); });
+
+    // arguments beyond the range of the Cody-Waite reduction
+    static constexpr V large = V([](int i) { return T(i % 7 + 1) * T(1e7) + T(i % 11); });
+
+    // positive arguments spanning a few binades
+    static constexpr V positive = V([](int i) { return T(i % 17 + 1) * T(0.23); });
+
+    // arguments in [-1, 1], dense towards ±1
+    static constexpr V unit = V([](int i) {
+                                const T x = T(i % 23) * T(1. / 22);
+                                return (i & 1 ? -x : x) * (T(2) - x);
+                              });
+
+    static constexpr V special = V([](int i) {
+                                   constexpr T values[] = {T(), -T(), L::infinity(), -L::infinity(),
+                                                           L::quiet_NaN(), L::denorm_min(),
+                                                           L::min(), -L::min(), T(1e-20)};
+                                   return values[i % std::size(values)];
+                                 });
+
+    // subnormal arguments of both signs
+    static constexpr V subnormal = V([](int i) {
+                                     return L::denorm_min() * T(i % 37 * 1000 + 1) * T(i & 1 ? -1 : 1);
+                                   });
+
+    ADD_TEST(Sin, is_math_type) {
+      std::tuple{medium, near_pio2, large},
+      [](auto& t, V x, V y, V z) {
+        t.verify_equal_to_ulp(sin(x), ref([](T v) { return std::sin(v); }, x), 1.5f);
+        t.verify_equal_to_ulp(sin(y), ref([](T v) { return std::sin(v); }, y), 1.5f);
+        t.verify_equal_to_ulp(sin(z), ref([](T v) { return std::sin(v); }, z), 1.5f);
+        t.verify_equal_to_ulp(sin(-x), -sin(x), 0.f);
+      }
+    };
+
+    ADD_TEST(Cos, is_math_type) {
+      std::tuple{medium, near_pio2, large},
+      [](auto& t, V x, V y, V z) {
+        t.verify_equal_to_ulp(cos(x), ref([](T v) { return std::cos(v); }, x), 1.5f);
+        t.verify_equal_to_ulp(cos(y), ref([](T v) { return std::cos(v); }, y), 1.5f);
+        t.verify_equal_to_ulp(cos(z), ref([](T v) { return std::cos(v); }, z), 1.5f);
+        t.verify_equal_to_ulp(cos(-x), cos(x), 0.f);
+      }
+    };
+
+    ADD_TEST(Tan, is_math_type) {
+      std::tuple{medium, near_pio2, large},
+      [](auto& t, V x, V y, V z) {
+        t.verify_equal_to_ulp(tan(x), ref([](T v) { return std::tan(v); }, x), 2.5f);
+        t.verify_equal_to_ulp(tan(y), ref([](T v) { return std::tan(v); }, y), 2.5f);
+        t.verify_equal_to_ulp(tan(z), ref([](T v) { return std::tan(v); }, z), 2.5f);
+      }
+    };
+
+    ADD_TEST(Sincos, is_math_type) {
+      std::tuple{medium, near_pio2, large},
+      [](auto& t, V x, V y, V z) {
+        for (const V& v : {x, y, z})
+          {
+            const auto [s, c] = sincos(v);
+            t.verify_equal(s, sin(v));
+            t.verify_equal(c, cos(v));
+          }
+      }
+    };
+
+    ADD_TEST(TrigSpecialValues, is_math_type) {
+      std::tuple{special},
+      [](auto& t, V x) {
+        // sin, cos, and tan of ±∞ and NaN are not constant
+        if not consteval
+          {
+            t.verify_equal_to_ulp(sin(x), ref([](T v) { return std::sin(v); }, x), 0.f);
+            t.verify_equal_to_ulp(cos(x), ref([](T v) { return std::cos(v); }, x), 0.f);
+            t.verify_equal_to_ulp(tan(x), ref([](T v) { return std::tan(v); }, x), 0.f);
+            t.verify_equal(signbit(sin(x)), signbit(ref([](T v) { return std::sin(v); }, x)));
+            t.verify_equal(signbit(tan(x)), signbit(ref([](T v) { return std::tan(v); }, x)));
+          }
+      }
+    };
+
+    ADD_TEST(Atan, is_math_type) {
+      std::tuple{medium, large, special},
+      [](auto& t, V x, V y, V s) {
+        auto atan_ref = [](T v) { return std::atan(v); };
+        t.verify_equal_to_ulp(atan(x), ref(atan_ref, x), 1.5f);
+        t.verify_equal_to_ulp(atan(T(.1) * x), ref(atan_ref, T(.1) * x), 1.5f);
+        t.verify_equal_to_ulp(atan(y), ref(atan_ref, y), 1.5f);
+        t.verify_equal_to_ulp(atan(-x), -atan(x), 0.f);
+        // atan(±∞) and atan(NaN) are not constant
+        if not consteval
+          {
+            t.verify_equal_to_ulp(atan(s), ref(atan_ref, s), 0.f);
+            t.verify_equal(signbit(atan(s)), signbit(ref(atan_ref, s)));
+          }
+      }
+    };
+
+    ADD_TEST(Atan2, is_math_type) {
+      std::tuple{medium, large, special},
+      [](auto& t, V x, V y, V s) {
+        auto atan2_ref = [](T a, T b) { return std::atan2(a, b); };
+        const V x2 = V([](int i) { return T(i % 19 - 9) * T(0.41); });
+        t.verify_equal_to_ulp(atan2(x, x2), ref(atan2_ref, x, x2), 2.f);
+        t.verify_equal_to_ulp(atan2(x2, x), ref(atan2_ref, x2, x), 2.f);
+        t.verify_equal_to_ulp(atan2(y, x), ref(atan2_ref, y, x), 2.f);
+        t.verify_equal_to_ulp(atan2(x, y), ref(atan2_ref, x, y), 2.f);
+        // all quadrants and axes of the special values; ±∞ and NaN are not constant
+        if not consteval
+          {
+            for (T v : {T(), -T(), T(1), T(-1), L::infinity(), -L::infinity(), L::quiet_NaN()})
+              {
+                t.verify_equal_to_ulp(atan2(s, V(v)), ref(atan2_ref, s, V(v)), 1.f);
+                t.verify_equal_to_ulp(atan2(V(v), s), ref(atan2_ref, V(v), s), 1.f);
+                t.verify_equal(signbit(atan2(s, V(v))), signbit(ref(atan2_ref, s, V(v))));
+                t.verify_equal(signbit(atan2(V(v), s)), signbit(ref(atan2_ref, V(v), s)));
+              }
+          }
+      }
+    };
+
+    ADD_TEST(Asin, is_math_type) {
+      std::tuple{unit, medium, special},
+      [](auto& t, V u, V x, V s) {
+        auto asin_ref = [](T v) { return std::asin(v); };
+        t.verify_equal_to_ulp(asin(u), ref(asin_ref, u), 1.5f);
+        t.verify_equal_to_ulp(asin(T(.5) * u), ref(asin_ref, T(.5) * u), 1.5f);
+        t.verify_equal_to_ulp(asin(-u), -asin(u), 0.f);
+        t.verify(signbit(asin(V(-T()))));
+        // |x| > 1 and ±∞ raise FE_INVALID, NaN is not constant either
+        if not consteval
+          {
+            t.verify_equal_to_ulp(asin(x), ref(asin_ref, x), 1.5f);
+            t.verify_equal_to_ulp(asin(s), ref(asin_ref, s), 0.f);
+          }
+      }
+    };
+
+    ADD_TEST(Acos, is_math_type) {
+      std::tuple{unit, medium, special},
+      [](auto& t, V u, V x, V s) {
+        auto acos_ref = [](T v) { return std::acos(v); };
+        t.verify_equal_to_ulp(acos(u), ref(acos_ref, u), 1.5f);
+        t.verify_equal_to_ulp(acos(T(.5) * u), ref(acos_ref, T(.5) * u), 1.5f);
+        t.verify_equal_to_ulp(acos(V(T(1))), V(), 0.f);
+        t.verify_equal_to_ulp(acos(V(T(-1))), ref(acos_ref, V(T(-1))), 0.f);
+        // |x| > 1 and ±∞ raise FE_INVALID, NaN is not constant either
+        if not consteval
+          {
+            t.verify_equal_to_ulp(acos(x), ref(acos_ref, x), 1.5f);
+            t.verify_equal_to_ulp(acos(s), ref(acos_ref, s), 0.f);
+          }
+      }
+    };
+
+    ADD_TEST(Sinh, is_math_type) {
+      std::tuple{medium, large, special},
+      [](auto& t, V x, V y, V s) {
+        auto sinh_ref = [](T v) { return std::sinh(v); };
+        t.verify_equal_to_ulp(sinh(x), ref(sinh_ref, x), 2.f);
+        t.verify_equal_to_ulp(sinh(T(.1) * x), ref(sinh_ref, T(.1) * x), 2.f);
+        t.verify_equal_to_ulp(sinh(T(10) * x), ref(sinh_ref, T(10) * x), 2.f);
+        t.verify_equal_to_ulp(sinh(-x), -sinh(x), 0.f);
+        // overflow, ±∞, and NaN are not constant
+        if not consteval
+          {
+            t.verify_equal_to_ulp(sinh(y), ref(sinh_ref, y), 0.f);
+            t.verify_equal_to_ulp(sinh(s), ref(sinh_ref, s), 0.f);
+            t.verify_equal(signbit(sinh(s)), signbit(ref(sinh_ref, s)));
+          }
+      }
+    };
+
+    ADD_TEST(Cosh, is_math_type) {
+      std::tuple{medium, large, special},
+      [](auto& t, V x, V y, V s) {
+        auto cosh_ref = [](T v) { return std::cosh(v); };
+        t.verify_equal_to_ulp(cosh(x), ref(cosh_ref, x), 2.f);
+        t.verify_equal_to_ulp(cosh(T(.1) * x), ref(cosh_ref, T(.1) * x), 2.f);
+        t.verify_equal_to_ulp(cosh(T(10) * x), ref(cosh_ref, T(10) * x), 2.f);
+        t.verify_equal_to_ulp(cosh(-x), cosh(x), 0.f);
+        // overflow, ±∞, and NaN are not constant
+        if not consteval
+          {
+            t.verify_equal_to_ulp(cosh(y), ref(cosh_ref, y), 0.f);
+            t.verify_equal_to_ulp(cosh(s), ref(cosh_ref, s), 0.f);
+          }
+      }
+    };
+
+    ADD_TEST(Tanh, is_math_type) {
+      std::tuple{medium, large, special},
+      [](auto& t, V x, V y, V s) {
+        auto tanh_ref = [](T v) { return std::tanh(v); };
+        t.verify_equal_to_ulp(tanh(x), ref(tanh_ref, x), 3.f);
+        t.verify_equal_to_ulp(tanh(T(.1) * x), ref(tanh_ref, T(.1) * x), 3.f);
+        t.verify_equal_to_ulp(tanh(y), ref(tanh_ref, y), 0.f);
+        t.verify_equal_to_ulp(tanh(-x), -tanh(x), 0.f);
+        // ±∞ and NaN are not constant
+        if not consteval
+          {
+            t.verify_equal_to_ulp(tanh(s), ref(tanh_ref, s), 0.f);
+            t.verify_equal(signbit(tanh(s)), signbit(ref(tanh_ref, s)));
+          }
+      }
+    };
+
+    ADD_TEST(Erf, is_math_type) {
+      std::tuple{medium, special},
+      [](auto& t, V x, V s) {
+        auto erf_ref = [](T v) { return std::erf(v); };
+        t.verify_equal_to_ulp(erf(x), ref(erf_ref, x), 1.f);
+        t.verify_equal_to_ulp(erf(T(.2) * x), ref(erf_ref, T(.2) * x), 1.f);
+        t.verify_equal_to_ulp(erf(-x), -erf(x), 0.f);
+        // underflow, ±∞, and NaN are not constant
+        if not consteval
+          {
+            t.verify_equal_to_ulp(erf(s), ref(erf_ref, s), 0.f);
+            t.verify_equal(signbit(erf(s)), signbit(ref(erf_ref, s)));
+          }
+      }
+    };
+
+    ADD_TEST(Erfc, is_math_type) {
+      std::tuple{medium, positive, special},
+      [](auto& t, V x, V w, V s) {
+        auto erfc_ref = [](T v) { return std::erfc(v); };
+        t.verify_equal_to_ulp(erfc(x), ref(erfc_ref, x), 3.f);
+        t.verify_equal_to_ulp(erfc(T(.2) * x), ref(erfc_ref, T(.2) * x), 3.f);
+        // the tail down to the underflow threshold
+        t.verify_equal_to_ulp(erfc(T(2.2) * w), ref(erfc_ref, T(2.2) * w), 3.f);
+        // ±∞ and NaN are not constant
+        if not consteval
+          {
+            t.verify_equal_to_ulp(erfc(s), ref(erfc_ref, s), 0.f);
+          }
+      }
+    };
+
+    ADD_TEST(Sigmoid, is_math_type) {
+      std::tuple{medium, large, special},
+      [](auto& t, V x, V y, V s) {
+        auto sigmoid_ref = [](T v) { return T(1 / (1 + std::exp(-(long double)(v)))); };
+        t.verify_equal_to_ulp(std::simd_sigmoid(x), ref(sigmoid_ref, x), 3.f);
+        t.verify_equal_to_ulp(std::simd_sigmoid(T(10) * x), ref(sigmoid_ref, T(10) * x), 3.f);
+        // relative error bound of the fast variant
+        const T eps = sizeof(T) == sizeof(float) ? T(0x1p-20) : T(0x1p-48);
+        const V r = ref(sigmoid_ref, x);
+        t.verify(fabs(std::simd_sigmoid_fast(x) - r) <= eps * r);
+        // exp overflows or underflows for large |x| and is not constant then, neither for ±∞ and NaN
+        if not consteval
+          {
+            t.verify_equal_to_ulp(std::simd_sigmoid(y), ref(sigmoid_ref, y), 0.f);
+            t.verify_equal_to_ulp(std::simd_sigmoid(s), ref(sigmoid_ref, s), 0.f);
+            t.verify_equal_to_ulp(std::simd_sigmoid_fast(y), ref(sigmoid_ref, y), 0.f);
+            t.verify_equal_to_ulp(std::simd_sigmoid_fast(s), ref(sigmoid_ref, s), 0.f);
+          }
+      }
+    };
+
+    ADD_TEST(Gelu, is_math_type) {
+      std::tuple{medium, large, special},
+      [](auto& t, V x, V y, V s) {
+        auto gelu_ref = [](T v) {
+          if (std::isinf(v))
+            return v < 0 ? -T() : v;
+          return T((long double)(v) * std::erfc(-(long double)(v) / std::sqrt(2.L)) / 2);
+        };
+        t.verify_equal_to_ulp(std::simd_gelu(x), ref(gelu_ref, x), 5.f);
+        t.verify_equal_to_ulp(std::simd_gelu(T(.1) * x), ref(gelu_ref, T(.1) * x), 5.f);
+        // the tanh approximation
+        t.verify(fabs(std::simd_gelu_fast(x) - ref(gelu_ref, x)) <= T(5e-4));
+        // underflow of the Gaussian tail, ±∞, and NaN are not constant
+        if not consteval
+          {
+            t.verify_equal_to_ulp(std::simd_gelu(y), ref(gelu_ref, y), 0.f);
+            t.verify_equal_to_ulp(std::simd_gelu(-y), -V(), 0.f);
+            t.verify_equal_to_ulp(std::simd_gelu(s), ref(gelu_ref, s), 0.f);
+            t.verify_equal_to_ulp(std::simd_gelu_fast(y), y, 0.f);
+            t.verify_equal_to_ulp(std::simd_gelu_fast(-y), -V(), 0.f);
+          }
+      }
+    };
+
+    ADD_TEST(Lgamma, is_math_type) {
+      std::tuple{medium, positive, special},
+      [](auto& t, V x, V w, V s) {
+        // lgamma writes signgam and is therefore never constant
+        if not consteval
+          {
+            auto lgamma_ref = [](T v) { return T(std::lgamma((long double)(v))); };
+            t.verify_equal_to_ulp(lgamma(w), ref(lgamma_ref, w), 2.f);
+            t.verify_equal_to_ulp(lgamma(T(10) * w), ref(lgamma_ref, T(10) * w), 2.f);
+            t.verify_equal_to_ulp(lgamma(T(.1) * x), ref(lgamma_ref, T(.1) * x), 2.f);
+            // the reflection loses accuracy close to the zeros of lgamma for x < 0
+            t.verify_equal_to_ulp(lgamma(x), ref(lgamma_ref, x), 10.f);
+            t.verify_equal_to_ulp(lgamma(s), ref(lgamma_ref, s), 0.f);
+            t.verify_equal_to_ulp(lgamma(V(T(1))), V(), 0.f);
+            t.verify_equal_to_ulp(lgamma(V(T(2))), V(), 0.f);
+          }
+      }
+    };
+
+    ADD_TEST(Tgamma, is_math_type) {
+      std::tuple{medium, positive, special},
+      [](auto& t, V x, V w, V s) {
+        auto tgamma_ref = [](T v) { return T(std::tgamma((long double)(v))); };
+        t.verify_equal_to_ulp(tgamma(w), ref(tgamma_ref, w), 8.f);
+        // Γ(31.3) is still finite for float
+        t.verify_equal_to_ulp(tgamma(T(8) * w), ref(tgamma_ref, T(8) * w), 8.f);
+        t.verify_equal_to_ulp(tgamma(x), ref(tgamma_ref, x), 8.f);
+        t.verify_equal_to_ulp(tgamma(T(.1) * x), ref(tgamma_ref, T(.1) * x), 8.f);
+        // poles, overflow, ±∞, and NaN raise FE_DIVBYZERO, FE_INVALID, or FE_OVERFLOW or are
+        // otherwise not constant
+        if not consteval
+          {
+            t.verify_equal_to_ulp(tgamma(s), ref(tgamma_ref, s), 0.f);
+            t.verify_equal(signbit(tgamma(s)), signbit(ref(tgamma_ref, s)));
+            t.verify(isnan(tgamma(V(T(-3)))));
+            t.verify_equal(tgamma(V(T(200))), V(L::infinity()));
+          }
+      }
+    };
+
+    // The special math functions are not constexpr.
+    ADD_TEST(Expint, is_math_type) {
+      std::tuple{medium, positive, special},
+      [](auto& t, V x, V w, V s) {
+        if not consteval
+          {
+            // libstdc++ returns NaN for expint(+∞). simd<T, 1> calls the scalar function, which
+            // is less accurate than the long double reference.
+            auto expint_ref = [](T v) {
+              if constexpr (V::size() == 1)
+                return T(std::expint(v));
+              else
+                return v == L::infinity() ? v : T(std::expint((long double)(v)));
+            };
+            t.verify_equal_to_ulp(expint(x), ref(expint_ref, x), 5.f);
+            t.verify_equal_to_ulp(expint(T(.1) * x), ref(expint_ref, T(.1) * x), 5.f);
+            t.verify_equal_to_ulp(expint(T(10) * w), ref(expint_ref, T(10) * w), 5.f);
+            t.verify_equal_to_ulp(expint(s), ref(expint_ref, s), 5.f);
+          }
+      }
+    };
+
+    ADD_TEST(CompEllint, is_math_type) {
+      std::tuple{unit, special},
+      [](auto& t, V k, V s) {
+        if not consteval
+          {
+            // libstdc++ throws std::domain_error for |k| > 1. simd<T, 1> calls the scalar
+            // functions, which are less accurate than the long double reference.
+            using R = std::conditional_t<V::size() == 1, T, long double>;
+            auto ellint1_ref = [](T v) {
+              return std::fabs(v) > T(1) ? L::quiet_NaN() : T(std::comp_ellint_1(R(v)));
+            };
+            auto ellint2_ref = [](T v) {
+              return std::fabs(v) > T(1) ? L::quiet_NaN() : T(std::comp_ellint_2(R(v)));
+            };
+            t.verify_equal_to_ulp(comp_ellint_1(k), ref(ellint1_ref, k), 1.5f);
+            t.verify_equal_to_ulp(comp_ellint_1(s), ref(ellint1_ref, s), 0.f);
+            // the long double reference of comp_ellint_2 degrades towards |k| = 1
+            t.verify_equal_to_ulp(comp_ellint_2(T(.9) * k), ref(ellint2_ref, T(.9) * k), 1.5f);
+            t.verify_equal_to_ulp(comp_ellint_2(s), ref(ellint2_ref, s), 0.f);
+            t.verify_equal_to_ulp(comp_ellint_2(V(T(1))), V(T(1)), 0.f);
+          }
+      }
+    };
+
+    ADD_TEST(Logb, is_math_type) {
+      std::tuple{medium, large, special, subnormal},
+      [](auto& t, V x, V y, V s, V d) {
+        using I = std::rebind_simd_t<int, V>;
+        auto check = [&](const V& v) {
+          t.verify_equal_to_ulp(logb(v), ref([](T a) { return std::logb(a); }, v), 0.f);
+          t.verify_equal(ilogb(v), I([&](int i) { return std::ilogb(v[i]); }));
+        };
+        check(x);
+        check(y);
+        check(d);
+        // ±0, ±∞, and NaN raise floating-point exceptions and are therefore not constant
+        if not consteval
+          {
+            check(s);
+          }
+      }
+    };
+
+    // frexp is not constexpr
+    ADD_TEST(Frexp, is_math_type) {
+      std::tuple{medium, large, special, subnormal},
+      [](auto& t, V x, V y, V s, V d) {
+        if not consteval
+          {
+            using I = std::rebind_simd_t<int, V>;
+            for (const V& v : {x, y, s, d})
+              {
+                I e;
+                const V m = frexp(v, &e);
+                int e_ref[V::size()];
+                t.verify_equal_to_ulp(m, V([&](int i) { return std::frexp(v[i], &e_ref[i]); }),
+                                      0.f);
+                t.verify_equal(e, I([&](int i) { return e_ref[i]; }));
+                // ldexp(frexp(x)) == x, in the subnormal range too
+                t.verify_equal_to_ulp(ldexp(m, e), v, 0.f);
+              }
+          }
+      }
+    };
+
+    ADD_TEST(Ldexp, is_math_type) {
+      std::tuple{medium, special, subnormal},
+      [](auto& t, V x, V s, V d) {
+        using I = std::rebind_simd_t<int, V>;
+        using Lg = std::rebind_simd_t<long, V>;
+        auto check = [&](const V& v, const I& e) {
+          const V r = V([&](int i) { return std::ldexp(v[i], e[i]); });
+          t.verify_equal_to_ulp(ldexp(v, e), r, 0.f);
+          t.verify_equal_to_ulp(scalbn(v, e), r, 0.f);
+          t.verify_equal_to_ulp(scalbln(v, Lg([&](int i) { return long(e[i]); })), r, 0.f);
+        };
+        check(x, I([](int i) { return (i % 23 - 11) * 5; }));
+        check(d, I([](int i) { return i % 11; }));
+        // results that overflow or underflow are not constant
+        if not consteval
+          {
+            const I n = I([](int i) { return (i % 23 - 11) * 29; });
+            constexpr int range = L::max_exponent - L::min_exponent + L::digits;
+            for (const V& v : {x, s, d})
+              for (const I& e : {n, I(range), I(-range), I(std::numeric_limits<int>::max()),
+                                 I(std::numeric_limits<int>::min())})
+                check(v, e);
+            // scalbln beyond the int range
+            for (long e : {std::numeric_limits<long>::max(), std::numeric_limits<long>::min()})
+              t.verify_equal_to_ulp(scalbln(x, Lg(e)),
+                                    V([&](int i) { return std::scalbln(x[i], e); }), 0.f);
+          }
+      }
+    };
+
+    ADD_TEST(Modf, is_math_type) {
+      std::tuple{medium, large, special, subnormal},
+      [](auto& t, V x, V y, V s, V d) {
+        for (const V& v : {x, y, s, d})
+          {
+            V ip;
+            const V f = modf(v, &ip);
+            // std::modf(float, float*) is not constexpr
+            const V ip_ref = ref([](T w) { return std::trunc(w); }, v);
+            const V f_ref = ref([](T w) {
+                                  return std::copysign(std::isinf(w) ? T() : w - std::trunc(w), w);
+                                }, v);
+            t.verify_equal_to_ulp(f, f_ref, 0.f);
+            t.verify_equal_to_ulp(ip, ip_ref, 0.f);
+            t.verify_equal(signbit(f), signbit(f_ref));
+            t.verify_equal(signbit(ip), signbit(v));
+          }
+      }
+    };
+
+    ADD_TEST(Pow, is_math_type) {
+      std::tuple{positive, medium, special},
+      [](auto& t, V x, V y, V s) {
+        auto pow_ref = [](T a, T b) { return std::pow(a, b); };
+        t.verify_equal_to_ulp(pow(x, y), ref(pow_ref, x, y), 1.5f);
+        // large exponents, but without overflow
+        const T k = T(L::max_exponent / 25);
+        t.verify_equal_to_ulp(pow(x, k * y), ref(pow_ref, x, k * y), 1.5f);
+        // negative bases with integral exponents
+        const V n = V([](int i) { return T(i % 9 - 4); });
+        t.verify_equal_to_ulp(pow(-x, n), ref(pow_ref, -x, n), 1.5f);
+        t.verify_equal_to_ulp(pow(y, n), ref(pow_ref, y, n), 1.5f);
+        // poles, negative bases with non-integral exponents, ±∞, and NaN raise FE_DIVBYZERO or
+        // FE_INVALID or are otherwise not constant
+        if not consteval
+          {
+            for (T e : {T(0), T(1), T(2), T(-3), T(.5), L::infinity(), -L::infinity()})
+              {
+                t.verify_equal_to_ulp(pow(s, V(e)), ref(pow_ref, s, V(e)), 1.5f);
+                t.verify_equal_to_ulp(pow(V(e), s), ref(pow_ref, V(e), s), 1.5f);
+              }
+            t.verify_equal(signbit(pow(s, V(T(-3)))), signbit(ref(pow_ref, s, V(T(-3)))));
+            t.verify_equal_to_ulp(pow(-x, V(T(.5))), ref(pow_ref, -x, V(T(.5))), 0.f);
+            t.verify_equal_to_ulp(pow(V(T(-1)), s), ref(pow_ref, V(T(-1)), s), 0.f);
+          }
+      }
+    };
+
+    ADD_TEST(Cbrt, is_math_type) {
+      std::tuple{positive, medium, large, special},
+      [](auto& t, V w, V x, V y, V s) {
+        // glibc's cbrt is off by more than 1 ulp
+        auto cbrt_ref = [](T v) { return T(std::cbrt((long double)(v))); };
+        t.verify_equal_to_ulp(cbrt(w), ref(cbrt_ref, w), 1.5f);
+        t.verify_equal_to_ulp(cbrt(x), ref(cbrt_ref, x), 1.5f);
+        t.verify_equal_to_ulp(cbrt(y), ref(cbrt_ref, y), 1.5f);
+        // ±∞ and NaN are not constant
+        if not consteval
+          {
+            t.verify_equal_to_ulp(cbrt(s), ref(cbrt_ref, s), 1.5f);
+            t.verify_equal(signbit(cbrt(s)), signbit(ref(cbrt_ref, s)));
+          }
+      }
+    };
+
+    ADD_TEST(Hypot, is_math_type) {
+      std::tuple{medium, near_pio2, large, special},
+      [](auto& t, V x, V y, V z, V s) {
+        auto hypot_ref = [](T a, T b) { return std::hypot(a, b); };
+        t.verify_equal_to_ulp(hypot(x, y), ref(hypot_ref, x, y), 1.f);
+        t.verify_equal_to_ulp(hypot(z, x), ref(hypot_ref, z, x), 1.f);
+        // no spurious overflow or underflow of the squares
+        const V huge = x * (L::max() / T(32));
+        const V tiny = L::denorm_min() * T(1000) * x;
+        const V big = y * (L::max() / T(64));
+        t.verify_equal_to_ulp(hypot(huge, big), ref(hypot_ref, huge, big), 1.f);
+        // subnormal results, ±∞, and NaN are not constant
+        if not consteval
+          {
+            t.verify_equal_to_ulp(hypot(tiny, tiny), ref(hypot_ref, tiny, tiny), 1.f);
+            t.verify_equal_to_ulp(hypot(s, x), ref(hypot_ref, s, x), 1.f);
+            t.verify_equal_to_ulp(hypot(s, V(L::quiet_NaN())),
+                                  ref(hypot_ref, s, V(L::quiet_NaN())), 0.f);
+          }
+        // the three-argument std::hypot is not constexpr, neither is hypot(V, V, V) therefore
+        if not consteval
+          {
+            auto hypot3_ref = [](const V& a, const V& b, const V& c) {
+              return V([&](int i) {
+                       if (std::isinf(a[i]) or std::isinf(b[i]) or std::isinf(c[i]))
+                         return L::infinity();
+                       return T(std::sqrt((long double)a[i] * a[i] + (long double)b[i] * b[i]
+                                            + (long double)c[i] * c[i]));
+                     });
+            };
+            t.verify_equal_to_ulp(hypot(x, y, z), hypot3_ref(x, y, z), 1.f);
+            t.verify_equal_to_ulp(hypot(huge, huge, x), hypot3_ref(huge, huge, x), 1.f);
+            t.verify_equal_to_ulp(hypot(x, s, y), hypot3_ref(x, s, y), 1.f);
+          }
+      }
+    };
+  };
@@ -13,6 +13,25 @@
 
 using namespace vir::literals;
 
+// kernels for simd_dispatch need linkage
+template <typename V>
+  V
+  dispatch_inc(V x)
+  { return x + typename V::value_type(1); }
+
+template <typename V>
+  V
+  dispatch_dec(V x)
+  { return x - typename V::value_type(1); }
+
+template <typename T>
+  struct soa_point
+  {
+    T x;
+    T y;
+    int i;
+  };
+
 template <typename V>
   struct Tests
   {
@@ -100,6 +119,95 @@ template <typename V>
       }
     };
 
+    ADD_TEST(mask_bitset) {
+      std::tuple{test_iota<V>},
+      [](auto& t, V x) {
+        const M k = x > T(1);
+        const std::bitset<V::size()> b = k.to_bitset();
+        for (int i = 0; i < V::size(); ++i)
+          t.verify_equal(b[i], k[i])(i);
+        t.verify_equal(M(b), k);
+        t.verify_equal(M(~b), not k);
+        t.verify_equal(M(std::bitset<V::size()>()), M(false));
+        if constexpr (V::size() <= 64)
+          t.verify_equal(k.to_ullong(), b.to_ullong());
+      }
+    };
+
+    ADD_TEST(mask_to_bits, V::size() <= 64) {
+      std::tuple{test_iota<V>},
+      [](auto& t, V x) {
+        constexpr int N = V::size();
+        constexpr int count = 5;
+        std::array<M, count> masks = {};
+        for (int i = 0; i < count; ++i)
+          masks[i] = (x > T(i)) != M([i](int j) { return j % (i + 2) == 0; });
+        std::array<std::uint64_t, (count * N + 63) / 64 + 1> bits = {};
+        bits.back() = ~std::uint64_t();
+        std::uint64_t* end = std::simd_mask_to_bits(masks, bits.data());
+        t.verify_equal(end - bits.data(), (count * N + 63) / 64);
+        t.verify_equal(bits.back(), ~std::uint64_t());
+        for (int i = 0; i < count * N; ++i)
+          t.verify_equal(bool((bits[i / 64] >> (i % 64)) & 1), masks[i / N][i % N])(i);
+        for (int i = count * N; i < 64 * int(end - bits.data()); ++i)
+          t.verify_equal(bool((bits[i / 64] >> (i % 64)) & 1), false)(i);
+        // input range without random access takes the generic path
+        bits = {};
+        std::simd_mask_to_bits(masks | std::views::filter([](const M&) { return true; }),
+                               bits.data());
+        for (int i = 0; i < count * N; ++i)
+          t.verify_equal(bool((bits[i / 64] >> (i % 64)) & 1), masks[i / N][i % N])(i);
+      }
+    };
+
+    ADD_TEST(reduce_index_opt) {
+      std::tuple{test_iota<V>},
+      [](auto& t, V x) {
+        t.verify_equal(std::reduce_min_index_opt(x == x).value_or(-1), 0);
+        t.verify_equal(std::reduce_max_index_opt(x == x).value_or(-1), V::size() - 1);
+        t.verify(not std::reduce_min_index_opt(x != x).has_value());
+        t.verify(not std::reduce_max_index_opt(x != x).has_value());
+        const M k = M([](int i) { return i % 3 == 1; });
+        if (std::any_of(k))
+          {
+            t.verify_equal(std::reduce_min_index_opt(k).value_or(-1), std::reduce_min_index(k));
+            t.verify_equal(std::reduce_max_index_opt(k).value_or(-1), std::reduce_max_index(k));
+          }
+        else
+          t.verify(not std::reduce_min_index_opt(k).has_value());
+      }
+    };
+
+    ADD_TEST(set_indices) {
+      std::tuple{test_iota<V>},
+      [](auto& t, V x) {
+        for (const M k : {x > T(1), M(true), M(false),
+                          M([](int i) { return i % 3 == 1; }) and x != T(2)})
+          {
+            int expected = 0;
+            auto next_set = [&] {
+              while (expected < V::size() and not k[expected])
+                ++expected;
+              return expected++;
+            };
+            std::for_each_set_index(k, [&](int i) {
+              t.verify_equal(i, next_set());
+            });
+            t.verify_equal(next_set(), V::size());
+            expected = 0;
+            int count = 0;
+            for (int i : std::set_indices(k))
+              {
+                t.verify_equal(i, next_set());
+                ++count;
+              }
+            t.verify_equal(next_set(), V::size());
+            t.verify_equal(count, std::reduce_count(k));
+            t.verify_equal(int(std::set_indices(k).size()), std::reduce_count(k));
+          }
+      }
+    };
+
     static_assert(std::simd_alignment_v<V> <= 256);
 
     ADD_TEST(loads) {
@@ -201,4 +309,387 @@ template <typename V>
           }
       }
     };
+
+    ADD_TEST(streaming_and_prefetch, requires {T() + T(1);}) {
+      std::tuple {test_iota<V, 1, 0>},
+      [](auto& t, const V v) {
+        alignas(256) std::array<T, V::size * 2> mem = {};
+        constexpr auto streaming = std::__flag_streaming;
+        constexpr auto prefetch = std::__flag_prefetch<>;
+
+        std::simd_partial_store(v + T(1), mem.begin() + V::size(), mem.end(), prefetch);
+        std::simd_partial_store(v + T(1), mem.begin(), mem.begin() + 1, streaming);
+        t.verify_equal(mem[0], T(2));
+        std::simd_unchecked_store(v, mem, streaming | prefetch);
+        if not consteval
+        {
+          std::__streaming_fence();
+        }
+        for (int i = 0; i < V::size; ++i)
+          {
+            t.verify_equal(mem[i], T(i + 1));
+            t.verify_equal(mem[V::size + i], T(i + 2));
+          }
+
+        t.verify_equal(std::simd_unchecked_load<V>(mem, streaming), v);
+        t.verify_equal(std::simd_unchecked_load<V>(mem, streaming | prefetch), v);
+        t.verify_equal(std::simd_unchecked_load<V>(mem, std::__flag_prefetch<0, 512>), v);
+        t.verify_equal(std::simd_partial_load<V>(mem.begin() + V::size(), mem.end(), prefetch),
+                       v + T(1));
+      }
+    };
+
+    using IV = std::rebind_simd_t<int, V>;
+
+    ADD_TEST(gather, requires {T() + T(1);}) {
+      std::tuple {[] {
+        std::array<T, V::size * 2> arr = {};
+        std::iota(arr.begin(), arr.end(), T(1));
+        return arr;
+      }(), IV([](int i) { return int(V::size) - 1 - i; }), IV([](int i) { return 2 * i; })},
+      [](auto& t, const auto& mem, IV rev, IV even) {
+        const V ref_rev([](int i) { return T(V::size - i); });
+        const V ref_even([](int i) { return T(2 * i + 1); });
+        const M k([](int i) { return i % 3 != 1; });
+
+        t.verify_equal(std::simd_gather_from<V>(mem, rev), ref_rev);
+        t.verify_equal(std::simd_gather_from<V>(mem, even), ref_even);
+        t.verify_equal(std::simd_gather_from<V>(mem, rev, k), std::simd_select(k, ref_rev, V()));
+        t.verify_equal(std::simd_gather_from<V>(mem, IV()), V(T(1)));
+
+        // index 2 * V::size is the first out-of-bounds index
+        const IV oob = even + IV(V::size);
+        const V ref_oob([](int i) { return 2 * i < int(V::size) ? T(2 * i + V::size + 1) : T(); });
+        t.verify_equal(std::simd_partial_gather_from<V>(mem, oob), ref_oob);
+        t.verify_equal(std::simd_partial_gather_from<V>(mem, oob, k),
+                       std::simd_select(k, ref_oob, V()));
+        t.verify_equal(std::simd_partial_gather_from<V>(mem, -rev - 1), V());
+      }
+    };
+
+    ADD_TEST(scatter, requires {T() + T(1);}) {
+      std::tuple {test_iota<V, 1, 0>, IV([](int i) { return int(V::size) - 1 - i; }),
+                  IV([](int i) { return 2 * i; })},
+      [](auto& t, const V v, IV rev, IV even) {
+        const M k([](int i) { return i % 3 != 1; });
+        std::array<T, V::size * 2> mem = {};
+
+        std::simd_scatter_to(v, mem, rev);
+        for (int i = 0; i < V::size; ++i)
+          t.verify_equal(mem[V::size - 1 - i], v[i]);
+
+        mem = {};
+        std::simd_scatter_to(v, mem, even, k);
+        for (int i = 0; i < V::size; ++i)
+          t.verify_equal(mem[2 * i], k[i] ? v[i] : T())("i =", i);
+
+        // equal indexes: the element with the highest index wins
+        mem = {};
+        std::simd_scatter_to(v, mem, IV());
+        t.verify_equal(mem[0], v[V::size - 1]);
+
+        mem = {};
+        std::simd_partial_scatter_to(v, mem, even + IV(V::size));
+        for (int i = 0; i < V::size; ++i)
+          t.verify_equal(mem[i], T());
+        for (int i = 0; 2 * i < V::size; ++i)
+          t.verify_equal(mem[2 * i + V::size], v[i]);
+      }
+    };
+
+    ADD_TEST(interleaved_loadstore, requires {T() + T(1);}) {
+      std::tuple {[] {
+        std::array<T, V::size * 5> arr = {};
+        std::iota(arr.begin(), arr.end(), T(1));
+        return arr;
+      }()},
+      [](auto& t, const auto& mem) {
+        [&]<int... Ns>(std::integer_sequence<int, Ns...>) {
+          ([&] {
+            constexpr int N = Ns + 1;
+            const std::array<V, N> v = std::simd_load_interleaved<N, V>(mem);
+            for (int j = 0; j < N; ++j)
+              t.verify_equal(v[j], V([&](int i) { return mem[i * N + j]; }))("N =", N, "j =", j);
+
+            std::array<T, V::size * 5> out = {};
+            std::simd_store_interleaved(v, out);
+            for (int i = 0; i < V::size * N; ++i)
+              t.verify_equal(out[i], mem[i])("N =", N, "i =", i);
+            for (int i = V::size * N; i < V::size * 5; ++i)
+              t.verify_equal(out[i], T())("N =", N, "i =", i);
+          }(), ...);
+        }(std::make_integer_sequence<int, 5>());
+      }
+    };
+
+    ADD_TEST(soa_vector, requires {T() + T(1);}) {
+      std::tuple {test_iota<V, 1, 0>},
+      [](auto& t, V x) {
+        // simd_soa_vector allocates
+        if not consteval
+        {
+          std::simd_soa_vector<soa_point<T>, V::size()> soa;
+          t.verify(soa.empty());
+          const int n = V::size() * 2 + 1;
+          for (int i = 0; i < n; ++i)
+            soa.push_back({x[i % V::size()], T(1), i});
+          t.verify_equal(soa.size(), size_t(n));
+          t.verify_equal(soa.block_count(), size_t(3));
+          t.verify_equal(soa.capacity() % V::size(), size_t(0));
+          t.verify_equal(soa[V::size()].x, x[0]);
+          t.verify_equal(soa[n - 1].i, n - 1);
+          t.verify_equal(soa.template column<2>().size(), size_t(n));
+
+          // the padding of the last block is value-initialized
+          size_t b = 0;
+          for (const auto& [bx, by, bi] : soa)
+            {
+              const auto valid = [&](int i) { return int(b * V::size()) + i < n; };
+              t.verify_equal(bx, V([&](int i) { return valid(i) ? x[i] : T(); }))("b =", b);
+              t.verify_equal(by, V([&](int i) { return valid(i) ? T(1) : T(); }))("b =", b);
+              t.verify_equal(bi, std::remove_cvref_t<decltype(bi)>([&](int i) {
+                               return valid(i) ? int(b * V::size()) + i : 0;
+                             }))("b =", b);
+              ++b;
+            }
+          t.verify_equal(b, soa.block_count());
+
+          for (size_t b = 0; b < soa.block_count(); ++b)
+            {
+              auto [bx, by, bi] = soa.load_block(b);
+              soa.store_block(b, {bx + by, by, bi});
+            }
+          for (int i = 0; i < n; ++i)
+            t.verify_equal(soa[i].x, T(x[i % V::size()] + T(1)))("i =", i);
+
+          auto copy = soa;
+          copy.resize(n + 3);
+          t.verify_equal(copy.size(), size_t(n + 3));
+          t.verify_equal(copy[n - 1].i, n - 1);
+          t.verify_equal(copy[n + 2].i, 0);
+          t.verify_equal(soa.size(), size_t(n));
+
+          // shrinking and clear() value-initialize the removed elements, which become padding
+          copy.resize(1);
+          {
+            const auto [cx, cy, ci] = copy.load_block(0);
+            t.verify_equal(cx, V([&](int i) { return i == 0 ? T(x[0] + T(1)) : T(); }));
+            t.verify_equal(cy, V([&](int i) { return i == 0 ? T(1) : T(); }));
+            t.verify_equal(ci, std::remove_cvref_t<decltype(ci)>(0));
+          }
+          soa.clear();
+          t.verify(soa.empty());
+          soa.push_back({x[0], T(2), 7});
+          {
+            const auto [sx, sy, si] = soa.load_block(0);
+            t.verify_equal(sx, V([&](int i) { return i == 0 ? x[0] : T(); }));
+            t.verify_equal(sy, V([&](int i) { return i == 0 ? T(2) : T(); }));
+            t.verify_equal(si, std::remove_cvref_t<decltype(si)>([](int i) {
+                             return i == 0 ? 7 : 0;
+                           }));
+          }
+        }
+      }
+    };
+
+    ADD_TEST(compress_expand, requires {T() + T(1);}) {
+      std::tuple {test_iota<V, 1, 0>, M([](int i) { return i % 3 != 1; })},
+      [](auto& t, const V v, const M k) {
+        const int n = std::reduce_count(k);
+        const V ref_c([&](int i) { return i < n ? T(i / 2 * 3 + i % 2 * 2 + 1) : T(); });
+        const V ref_e([&](int i) { return k[i] ? T(i - (i + 1) / 3 + 1) : T(); });
+
+        t.verify_equal(compress(v, k), ref_c);
+        t.verify_equal(compress(v, M(true)), v);
+        t.verify_equal(compress(v, M(false)), V());
+        const M first_n([&](int i) { return i < n; });
+        t.verify_equal(compress(v, k, T(2)), std::simd_select(first_n, ref_c, V(T(2))));
+        if constexpr (V::size() > 1)
+          t.verify_equal(compress(v, !k)[0], T(2));
+
+        t.verify_equal(expand(v, k), ref_e);
+        t.verify_equal(expand(v, k, V(T(3))), std::simd_select(k, ref_e, V(T(3))));
+        t.verify_equal(expand(v, M(true)), v);
+        t.verify_equal(expand(v, M(false), v + T(1)), v + T(1));
+        t.verify_equal(expand(compress(v, k), k), std::simd_select(k, v, V()));
+        t.verify_equal(compress(expand(v, k), k), compress(v, first_n));
+      }
+    };
+
+    ADD_TEST(compress_store, requires {T() + T(1);}) {
+      std::tuple {test_iota<V, 1, 0>, M([](int i) { return i % 3 != 1; })},
+      [](auto& t, const V v, const M k) {
+        const int n = std::reduce_count(k);
+        std::array<T, V::size + 1> mem = {};
+
+        t.verify_equal(compress_store(v, k, mem.begin()), n);
+        for (int i = 0; i < n; ++i)
+          t.verify_equal(mem[i], T(i / 2 * 3 + i % 2 * 2 + 1))("i =", i);
+        for (int i = n; i <= V::size; ++i)
+          t.verify_equal(mem[i], T())("i =", i);
+
+        // only the selected elements are written
+        t.verify_equal(compress_store(v, M(false), mem.begin()), 0);
+        t.verify_equal(mem[0], T(1));
+        t.verify_equal(compress_store(v, M(true), mem.begin() + 1), int(V::size));
+        t.verify_equal(mem[0], T(1));
+        for (int i = 0; i < V::size; ++i)
+          t.verify_equal(mem[i + 1], v[i]);
+      }
+    };
+
+    ADD_TEST(scans, requires {T() + T(1);}) {
+      std::tuple {V(T(1)), test_iota<V, 1, 0>, M([](int i) { return i % 3 != 1; })},
+      [](auto& t, const V ones, const V v, const M k) {
+        t.verify_equal(inclusive_scan(ones), V([](int i) { return T(i + 1); }));
+        t.verify_equal(inclusive_scan(ones, std::plus<>(), T(2)),
+                       V([](int i) { return T(i + 3); }));
+        t.verify_equal(exclusive_scan(ones, T(2)), V([](int i) { return T(i + 2); }));
+        t.verify_equal(inclusive_scan(ones, k), V([](int i) { return T(i + 1 - (i + 2) / 3); }));
+        t.verify_equal(exclusive_scan(ones, k, T()), V([](int i) { return T(i - (i + 1) / 3); }));
+
+        // associative but not commutative: the left operand must be the earlier element
+        constexpr auto left = [](auto a, auto) { return a; };
+        constexpr auto right = [](auto, auto b) { return b; };
+        t.verify_equal(inclusive_scan(v, left), V(v[0]));
+        t.verify_equal(inclusive_scan(v, right), v);
+        t.verify_equal(exclusive_scan(v, T(3), left), V(T(3)));
+      }
+    };
+
+    ADD_TEST(range_scans, requires {T() + T(1);}) {
+      std::tuple {[] {
+        std::array<T, 3 * V::size + 1> arr = {};
+        for (std::size_t i = 0; i < arr.size(); ++i)
+          arr[i] = i % 2 ? T(-1) : T(1);
+        return arr;
+      }()},
+      [](auto& t, const auto& in) {
+        std::array<T, 3 * V::size + 1> out = {};
+        t.verify_equal(std::simd_inclusive_scan<V>(in, out.begin()) - out.begin(), in.size());
+        for (std::size_t i = 0; i < in.size(); ++i)
+          t.verify_equal(out[i], T(i % 2 ? 0 : 1))("i =", i);
+
+        t.verify_equal(std::simd_exclusive_scan<V>(in, out.begin(), T(1)) - out.begin(),
+                       in.size());
+        for (std::size_t i = 0; i < in.size(); ++i)
+          t.verify_equal(out[i], T(i % 2 ? 2 : 1))("i =", i);
+
+        std::simd_inclusive_scan<V>(std::span(in).first(2), out.begin(), std::plus<>(), T(3));
+        t.verify_equal(out[0], T(4));
+        t.verify_equal(out[1], T(3));
+
+        // in-place
+        out = in;
+        std::simd_inclusive_scan<V>(out, out.begin());
+        for (std::size_t i = 0; i < in.size(); ++i)
+          t.verify_equal(out[i], T(i % 2 ? 0 : 1))("i =", i);
+      }
+    };
+
+    ADD_TEST(range_algorithms, requires {T() + T(1);}) {
+      std::tuple {[] {
+        std::array<T, 5 * V::size + 3> arr = {};
+        for (std::size_t i = 0; i < arr.size(); ++i)
+          arr[i] = T(i % 7);
+        return arr;
+      }()},
+      [](auto& t, const auto& arr) {
+        // skip the first element so that the range is not aligned
+        const auto in = std::span(arr).subspan(1);
+        std::array<T, 5 * V::size + 2> out = {};
+
+        t.verify_equal(std::simd_transform<V>(in, out.begin(), [](V x) { return x + T(1); })
+                         - out.begin(), in.size());
+        for (std::size_t i = 0; i < in.size(); ++i)
+          t.verify_equal(out[i], T(in[i] + 1))("i =", i);
+
+        std::simd_transform<V>(in, out, out.begin(), [](V x, V y) { return x + y; });
+        for (std::size_t i = 0; i < in.size(); ++i)
+          t.verify_equal(out[i], T(2 * in[i] + 1))("i =", i);
+
+        std::simd_for_each<V>(out, [](V& x) { x -= T(1); });
+        for (std::size_t i = 0; i < in.size(); ++i)
+          t.verify_equal(out[i], T(2 * in[i]))("i =", i);
+
+        int lanes = 0;
+        std::simd_for_each<V>(std::as_const(out), [&](const V&, const M& k) {
+          lanes += std::reduce_count(k);
+        });
+        t.verify_equal(lanes, out.size());
+
+        const auto n3 = std::count(in.begin(), in.end(), T(3));
+        t.verify_equal(std::simd_count_if<V>(in, [](V x) { return x == T(3); }), n3);
+        t.verify_equal(std::simd_transform_reduce<V>(in, T(1), std::plus<>(), [](V x) {
+                         return std::simd_select(x == T(3), V(T(1)), V());
+                       }), T(n3 + 1));
+
+        const T sum = std::accumulate(in.begin(), in.end(), T());
+        t.verify_equal(std::simd_reduce<V>(in), sum);
+        t.verify_equal(std::simd_reduce<V>(std::simd_reduction_reproducible, in), sum);
+        t.verify_equal(std::simd_reduce<V>(std::simd_reduction_ordered, in), sum);
+        t.verify_equal(std::simd_reduce_min<V>(in), T(0));
+        t.verify_equal(std::simd_reduce_max<V>(in), T(6));
+
+        t.verify_equal(std::simd_find_if<V>(in, [](V x) { return x == T(5); }) - in.begin(),
+                       std::find(in.begin(), in.end(), T(5)) - in.begin());
+        t.verify_equal(std::simd_find_if<V>(in, [](V x) { return x > T(6); }) - in.begin(),
+                       in.size());
+        t.verify_equal(std::simd_find<V>(in, T(4)) - in.begin(),
+                       std::find(in.begin(), in.end(), T(4)) - in.begin());
+        t.verify_equal(std::simd_find<V>(in, T(7)) - in.begin(), in.size());
+
+        std::array<T, 5 * V::size + 2> other = {};
+        std::copy(in.begin(), in.end(), other.begin());
+        t.verify_equal(std::simd_mismatch<V>(in, other).in1 - in.begin(), in.size());
+        other[in.size() - 2] = T(7);
+        auto [m1, m2] = std::simd_mismatch<V>(in, other);
+        t.verify_equal(m1 - in.begin(), in.size() - 2);
+        t.verify_equal(m2 - other.begin(), in.size() - 2);
+        t.verify_equal(std::simd_mismatch<V>(in, std::span(other).first(3)).in1 - in.begin(), 3);
+
+        for (std::size_t len : {1, 2, 3, 7})
+          for (std::size_t pos : {std::size_t(0), std::size_t(3), in.size() - len})
+            {
+              const auto needle = in.subspan(pos, len);
+              const auto expected = std::ranges::search(in, needle);
+              const auto found = std::simd_search<V>(in, needle);
+              t.verify_equal(found.begin() - in.begin(), expected.begin() - in.begin())(len, pos);
+              t.verify_equal(found.size(), expected.size())(len, pos);
+            }
+        const std::array<T, 3> missing = {T(1), T(3), T(5)};
+        t.verify_equal(std::simd_search<V>(in, missing).begin() - in.begin(), in.size());
+        t.verify(std::simd_search<V>(in, std::span(missing).first(0)).begin() == in.begin());
+      }
+    };
+
+    ADD_TEST(dispatch, requires {T() + T(1);}) {
+      std::tuple {test_iota<V>},
+      [](auto& t, V x) {
+        // simd_host_isa and simd_dispatch query the CPU
+        if not consteval
+        {
+          // check_cpu_support() guarantees that the CPU supports what the TU was compiled for
+          t.verify(std::simd_host_isa() >= std::simd_compiled_isa);
+
+          constexpr auto inc = &dispatch_inc<V>;
+          constexpr auto dec = &dispatch_dec<V>;
+          t.verify(std::simd_select_kernel(std::simd_isa::x86_64_v2,
+                                           std::simd_kernel{std::simd_isa::generic, inc},
+                                           std::simd_kernel{std::simd_isa::x86_64_v3, dec}) == inc);
+          t.verify(std::simd_select_kernel(std::simd_isa::x86_64_v4,
+                                           std::simd_kernel{std::simd_isa::generic, inc},
+                                           std::simd_kernel{std::simd_isa::x86_64_v3, dec}) == dec);
+          t.verify(std::simd_select_kernel(std::simd_isa::generic,
+                                           std::simd_kernel{std::simd_isa::x86_64_v2, inc})
+                     == nullptr);
+
+          // the generic kernel is the only one that can execute everywhere
+          t.verify_equal(std::simd_dispatch<inc, nullptr, nullptr, nullptr>(x), x + T(1));
+          t.verify_equal(std::simd_dispatch<inc>(x), x + T(1));
+          t.verify_equal(std::simd_dispatch<inc, nullptr, dec>(x),
+                         std::simd_host_isa() >= std::simd_isa::x86_64_v3 ? x - T(1) : x + T(1));
+        }
+      }
+    };
   };
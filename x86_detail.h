@@ -266,6 +266,77 @@ namespace std::__detail
         return reinterpret_cast<_RV>(__x);
     }
 
+  template <typename _Tp>
+    concept __half_float = is_floating_point_v<_Tp> and sizeof(_Tp) == 2;
+
+  /**
+   * Conversions from and to float16_t. Unless AVX512-FP16 supports float16_t natively, GCC
+   * converts these vectors element by element. Instead, convert via float using F16C
+   * (vcvtph2ps / vcvtps2ph).
+   */
+  template <__vec_builtin _To, __vec_builtin _From>
+    requires (__half_float<__value_type_of<_From>> or __half_float<__value_type_of<_To>>)
+      and (not is_same_v<__value_type_of<_From>, __value_type_of<_To>>)
+    _GLIBCXX_SIMD_INTRINSIC constexpr _To
+    __vec_convert(_From __a)
+    {
+      if (__builtin_is_constant_evaluated())
+        return __builtin_convertvector(__a, _To);
+      using _FromT = __value_type_of<_From>;
+      using _ToT = __value_type_of<_To>;
+      constexpr int _Np = __width_of<_From>;
+      using _FloatV = __vec_builtin_type<float, _Np>;
+      constexpr bool __from_half = __half_float<_FromT>;
+      constexpr _ArchFlags __flags = {};
+      // split into two conversions where no single instruction covers the float vector
+      auto __split = [](auto __x) {
+        using _ToHalf = __vec_builtin_type<_ToT, _Np / 2>;
+        return __vec_concat(__vec_convert<_ToHalf>(__vec_extract_part<0, 2>(__x)),
+                            __vec_convert<_ToHalf>(__vec_extract_part<1, 2>(__x)));
+      };
+      if constexpr (__flags._M_have_avx512fp16())
+        return __builtin_convertvector(__a, _To);
+      else if constexpr (__from_half and not is_same_v<_ToT, float>)
+        // widening to float is exact, rounding happens only once
+        return __vec_convert<_To>(__vec_convert<_FloatV>(__a));
+      else if constexpr (not __from_half and not is_same_v<_FromT, float>)
+        {
+          if constexpr (is_integral_v<_FromT> and sizeof(_FromT) <= 2)
+            return __vec_convert<_To>(__vec_convert<_FloatV>(__a));
+          else // double and wider integers would be rounded twice
+            return __builtin_convertvector(__a, _To);
+        }
+      else if constexpr (not __flags._M_have_f16c())
+        return __builtin_convertvector(__a, _To);
+      else if constexpr (__from_half)
+        {
+          if constexpr (sizeof(_From) <= 8)
+            return __vec_bitcast_trunc<_To>(
+                     __builtin_ia32_vcvtph2ps(__vec_bitcast<int16_t>(__vec_zero_pad_to_16(__a))));
+          else if constexpr (sizeof(_From) == 16)
+            return __builtin_ia32_vcvtph2ps256(__vec_bitcast<int16_t>(__a));
+          else if constexpr (sizeof(_From) == 32 and __flags._M_have_avx512f())
+            return __builtin_ia32_vcvtph2ps512_mask(__vec_bitcast<int16_t>(__a), __v16float(), -1,
+                                                    4 /*_MM_FROUND_CUR_DIRECTION*/);
+          else
+            return __split(__a);
+        }
+      else
+        {
+          // imm8 = 4 uses the rounding mode in MXCSR
+          if constexpr (sizeof(_From) <= 16)
+            return __vec_bitcast_trunc<_To>(
+                     __builtin_ia32_vcvtps2ph(__vec_zero_pad_to_16(__a), 4));
+          else if constexpr (sizeof(_From) == 32)
+            return __builtin_bit_cast(_To, __builtin_ia32_vcvtps2ph256(__a, 4));
+          else if constexpr (sizeof(_From) == 64 and __flags._M_have_avx512f())
+            return __builtin_bit_cast(_To, __builtin_ia32_vcvtps2ph512_mask(__a, 4, __v16int16(),
+                                                                            -1));
+          else
+            return __split(__a);
+        }
+    }
+
   _GLIBCXX_SIMD_INTRINSIC int
   __movmsk(__vec_builtin_sizeof<8, 16> auto __x) noexcept
   { return __builtin_ia32_movmskpd(reinterpret_cast<__v2double>(__x)); }